@@ -1,130 +1,175 @@
-/**
-\file
-\author JavaLandau
-\copyright MIT License
-\brief Header of flash configuration
-*/
-
-#ifndef __CONFIG_H__
-#define __CONFIG_H__
-
-#include "common.h"
-#include "stm32f4xx_hal.h"
-#include "sniffer_rs232.h"
-
-/** 
- * \addtogroup config
- * @{
-*/
-
-/** MACRO RS-S232 trace type is valid
- * 
- * The macro decides whether \p X is valid RS-232 trace type
- * 
- * \param[in] X RS-232 trace type
- * \result true if \p X is valid RS-232 trace type false otherwise
-*/
-#define RS232_TRACE_TYPE_VALID(X)       ((X) < RS232_TRACE_MAX)
-
-/** MACRO RS-S232 interspace type is valid
- * 
- * The macro decides whether \p X is valid RS-232 interspace type
- * 
- * \param[in] X RS-232 interspace type
- * \result true if \p X is valid RS-232 interspace type false otherwise
-*/
-#define RS232_INTERSPACE_TYPE_VALID(X)  ((X) < RS232_INTERSPCACE_MAX)
-
-/// Trace type of RS-232 data
-enum rs232_trace_type {
-    RS232_TRACE_HEX = 0,            ///< Data is traced in HEX format
-    RS232_TRACE_HYBRID,             ///< Data is traced as char if printable and as HEX if not
-    RS232_TRACE_MAX                 ///< Count of trace types
-};
-
-/// Type of interspaces between RS-232 data
-enum rs232_interspace_type {
-    RS232_INTERSPCACE_NONE = 0,     ///< No interspaces
-    RS232_INTERSPCACE_SPACE,        ///< Space between RS-232 data
-    RS232_INTERSPCACE_NEW_LINE,     ///< New line symbol between RS-232 data
-    RS232_INTERSPCACE_MAX           ///< Count of interspace types
-};
-
-/// UART presettings
-struct uart_presettings {
-    bool enable;                    ///< Flag whether presettings are enabled
-    uint32_t baudrate;              ///< UART baudrate in bods
-    enum uart_wordlen wordlen;      ///< Size of UART frame in bits
-    enum uart_parity parity;        ///< Parity type
-    enum uart_stopbits stopbits;    ///< Count of stop bits
-    bool lin_enabled;               ///< Flag whether LIN protocol is supported
-};
-
-/// Firmware configuration
-#pragma pack(1)
-struct flash_config {
-    /** Algorithm settings \ref sniffer_rs232_config */
-    struct sniffer_rs232_config alg_config;
-    /** UART presettings \ref uart_presettings */
-    struct uart_presettings presettings;
-    /** Trace type of RS-232 data \ref rs232_trace_type */
-    enum rs232_trace_type trace_type;
-    /** IDLE symbol for RS-232 data */
-    enum rs232_interspace_type idle_presence;
-    /** Delimiter symbol between RS-232 TX & RX data */
-    enum rs232_interspace_type txrx_delimiter;
-    /** Flag whether result of the algorithm \ref sniffer_rs232 
-     * is stored into \ref uart_presettings */
-    bool save_to_presettings;
-    /** CRC of configuration */
-    uint32_t crc;
-};
-#pragma pack()
-
-/** MACRO Default UART presettings
- * 
- * \result initializer for \ref uart_presettings
-*/
-#define UART_PRESETTINGS_DEFAULT()  {\
-    .enable = false,\
-    .parity = BSP_UART_PARITY_NONE,\
-    .baudrate = 0,\
-    .stopbits = BSP_UART_STOPBITS_1,\
-    .wordlen = BSP_UART_WORDLEN_8,\
-    .lin_enabled = false\
-}
-
-/** MACRO Default configuration
- * 
- * \result initializer for \ref flash_config
-*/
-#define FLASH_CONFIG_DEFAULT()  {\
-    .alg_config = SNIFFER_RS232_CONFIG_DEFAULT(),\
-    .presettings = UART_PRESETTINGS_DEFAULT(),\
-    .trace_type = RS232_TRACE_HEX,\
-    .idle_presence = RS232_INTERSPCACE_NONE,\
-    .txrx_delimiter = RS232_INTERSPCACE_NONE,\
-    .save_to_presettings = true\
-}
-
-/** Save configuration
- * 
- * The function saves configuration into flash
- * 
- * \param[in] config saved configuration
- * \return \ref RES_OK on success error otherwise
- */
-uint8_t config_save(struct flash_config *config);
-
-/** Read configuration
- * 
- * The function reads configuration from flash
- * 
- * \param[out] config read configuration
- * \return \ref RES_OK on success error otherwise
- */
-uint8_t config_read(struct flash_config *config);
-
-/** @} */
-
+/**
+\file
+\author JavaLandau
+\copyright MIT License
+\brief Header of flash configuration
+*/
+
+#ifndef __CONFIG_H__
+#define __CONFIG_H__
+
+#include "common.h"
+#include "stm32f4xx_hal.h"
+#include "sniffer_rs232.h"
+
+/** 
+ * \addtogroup config
+ * @{
+*/
+
+/// Count of recently detected UART parameters stored in flash_config::history
+#define CONFIG_HISTORY_SIZE             (4)
+
+/// Maximum value of flash_config::redetect_errors
+#define CONFIG_REDETECT_ERRORS_MAX      (1000)
+
+/// Minimum value of flash_config::drift_threshold
+#define CONFIG_DRIFT_THRESHOLD_MIN      (2000)
+
+/// Maximum value of flash_config::drift_threshold
+#define CONFIG_DRIFT_THRESHOLD_MAX      (50000)
+
+/** MACRO RS-S232 trace type is valid
+ * 
+ * The macro decides whether \p X is valid RS-232 trace type
+ * 
+ * \param[in] X RS-232 trace type
+ * \result true if \p X is valid RS-232 trace type false otherwise
+*/
+#define RS232_TRACE_TYPE_VALID(X)       ((X) < RS232_TRACE_MAX)
+
+/** MACRO RS-S232 interspace type is valid
+ * 
+ * The macro decides whether \p X is valid RS-232 interspace type
+ * 
+ * \param[in] X RS-232 interspace type
+ * \result true if \p X is valid RS-232 interspace type false otherwise
+*/
+#define RS232_INTERSPACE_TYPE_VALID(X)  ((X) < RS232_INTERSPCACE_MAX)
+
+/// Trace type of RS-232 data
+enum rs232_trace_type {
+    RS232_TRACE_HEX = 0,            ///< Data is traced in HEX format
+    RS232_TRACE_HYBRID,             ///< Data is traced as char if printable and as HEX if not
+    RS232_TRACE_MAX                 ///< Count of trace types
+};
+
+/// Type of interspaces between RS-232 data
+enum rs232_interspace_type {
+    RS232_INTERSPCACE_NONE = 0,     ///< No interspaces
+    RS232_INTERSPCACE_SPACE,        ///< Space between RS-232 data
+    RS232_INTERSPCACE_NEW_LINE,     ///< New line symbol between RS-232 data
+    RS232_INTERSPCACE_MAX           ///< Count of interspace types
+};
+
+/// UART presettings
+struct uart_presettings {
+    bool enable;                    ///< Flag whether presettings are enabled
+    uint32_t baudrate;              ///< UART baudrate in bods
+    enum uart_wordlen wordlen;      ///< Size of UART frame in bits
+    enum uart_parity parity;        ///< Parity type
+    enum uart_stopbits stopbits;    ///< Count of stop bits
+    bool lin_enabled;               ///< Flag whether LIN protocol is supported
+};
+
+/// Firmware configuration
+#pragma pack(1)
+struct flash_config {
+    /** Algorithm settings \ref sniffer_rs232_config */
+    struct sniffer_rs232_config alg_config;
+    /** UART presettings \ref uart_presettings */
+    struct uart_presettings presettings;
+    /** UART presettings of RS-232 RX line \ref uart_presettings,  
+     * used instead of flash_config::presettings for RX line if both are enabled */
+    struct uart_presettings rx_presettings;
+    /** Trace type of RS-232 data \ref rs232_trace_type */
+    enum rs232_trace_type trace_type;
+    /** IDLE symbol for RS-232 data */
+    enum rs232_interspace_type idle_presence;
+    /** Delimiter symbol between RS-232 TX & RX data */
+    enum rs232_interspace_type txrx_delimiter;
+    /** Flag whether result of the algorithm \ref sniffer_rs232 
+     * is stored into \ref uart_presettings */
+    bool save_to_presettings;
+    /** Count of UART errors per second on RS-232 line during monitoring  
+     * to start re-detection of UART parameters on the line, 0 if re-detection is disabled */
+    uint32_t redetect_errors;
+    /** Drift of baudrate on RS-232 line in ppm measured during monitoring  
+     * to retune baudrate of UART on the line, 0 if drift tracking is disabled */
+    uint32_t drift_threshold;
+    /** Recently detected UART parameters from the most recent one,  
+     * uart_presettings::enable is set for used items */
+    struct uart_presettings history[CONFIG_HISTORY_SIZE];
+    /** CRC of configuration */
+    uint32_t crc;
+};
+#pragma pack()
+
+/** MACRO Default UART presettings
+ * 
+ * \result initializer for \ref uart_presettings
+*/
+#define UART_PRESETTINGS_DEFAULT()  {\
+    .enable = false,\
+    .parity = BSP_UART_PARITY_NONE,\
+    .baudrate = 0,\
+    .stopbits = BSP_UART_STOPBITS_1,\
+    .wordlen = BSP_UART_WORDLEN_8,\
+    .lin_enabled = false\
+}
+
+/** MACRO Default configuration
+ * 
+ * \result initializer for \ref flash_config
+*/
+#define FLASH_CONFIG_DEFAULT()  {\
+    .alg_config = SNIFFER_RS232_CONFIG_DEFAULT(),\
+    .presettings = UART_PRESETTINGS_DEFAULT(),\
+    .rx_presettings = UART_PRESETTINGS_DEFAULT(),\
+    .trace_type = RS232_TRACE_HEX,\
+    .idle_presence = RS232_INTERSPCACE_NONE,\
+    .txrx_delimiter = RS232_INTERSPCACE_NONE,\
+    .save_to_presettings = true,\
+    .redetect_errors = 0,\
+    .drift_threshold = 0\
+}
+
+/** Save configuration
+ * 
+ * The function saves configuration into flash, log of hits  
+ * of flash_config::history is cleared, see \ref config_history_add
+ * 
+ * \param[in] config saved configuration
+ * \return \ref RES_OK on success error otherwise
+ */
+uint8_t config_save(struct flash_config *config);
+
+/** Read configuration
+ * 
+ * The function reads configuration from flash and applies hits  
+ * of flash_config::history logged since the last save, see \ref config_history_add
+ * 
+ * \param[out] config read configuration
+ * \return \ref RES_OK on success error otherwise
+ */
+uint8_t config_read(struct flash_config *config);
+
+/** Add UART parameters into history
+ * 
+ * The function puts \p uart_params on the top of flash_config::history,  
+ * the least recent item is removed if history is full  
+ * Hit of existing item is recorded into log of hits in erased words of flash  
+ * without erase of the sector, the log is replayed by \ref config_read
+ * \note The function does not erase flash, configuration is saved by \ref config_save
+ * 
+ * \param[in,out] config configuration
+ * \param[in] uart_params UART parameters
+ * \param[out] changed flag whether configuration should be saved by \ref config_save:  
+ * new item is added or the log of hits is full
+ * \return \ref RES_OK on success error otherwise
+ */
+uint8_t config_history_add(struct flash_config *config, struct uart_init_ctx *uart_params, bool *changed);
+
+/** @} */
+
 #endif //__CONFIG_H__
\ No newline at end of file
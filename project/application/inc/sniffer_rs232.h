@@ -1,141 +1,466 @@
-/**
-\file
-\author JavaLandau
-\copyright MIT License
-\brief Header of algorithm of Sniffer RS-232
-*/
-
-#ifndef __SNIFFER_RS232_H__
-#define __SNIFFER_RS232_H__
-
-#include "common.h"
-#include "stm32f4xx_hal.h"
-#include "bsp_uart.h"
-#include <stdbool.h>
-
-/** 
- * \addtogroup sniffer_rs232
- * @{
-*/
-
-/** RS-232 channel detection type */
-enum rs232_channel_type {
-    RS232_CHANNEL_TX = 0,       ///< Algorithm works only on RS-232 TX
-    RS232_CHANNEL_RX,           ///< Algorithm works only on RS-232 RX
-    RS232_CHANNEL_ANY,          ///< Algorithm works until one of the RS-232 channels calculated successfully
-    RS232_CHANNEL_ALL,          ///< Algorithm works on both RS-232 lines
-    RS232_CHANNEL_MAX           ///< Count of RS-232 channel detection types
-};
-
-/** MACRO Check if RS-232 channel detection type is valid
- * 
- * The macro checks whether \a TYPE is valid RS-232 channel detection type
- * 
- * \param[in] TYPE RS-232 channel detection type
- * \return true if valid false otherwise
-*/
-#define RS232_CHANNEL_TYPE_VALID(TYPE)          (((uint32_t)(TYPE)) < RS232_CHANNEL_MAX)
-
-/// Algorithm settings
-struct sniffer_rs232_config {
-    enum rs232_channel_type channel_type;   ///< RS-232 channel detection type
-    uint32_t valid_packets_count;           ///< Count of received bytes to approve a hypothesis
-    uint32_t uart_error_count;              ///< Count of UART frame errors when hypothesis is failed
-    uint8_t baudrate_tolerance;             ///< Tolerance of UART baudrate in percents
-    uint32_t min_detect_bits;               ///< Minimum count of lower levels on RS-232 line to analyse baudrate
-    uint32_t exec_timeout;                  ///< Maximum time of algorithm execution
-    uint32_t calc_attempts;                 ///< Count of tries of algorithm calculation
-    bool lin_detection;                     ///< Flag whether LIN protocol should be detected
-};
-
-/** MACRO Get minimum valid value of a parameter
- * 
- * The macro returns minimum valid value of a parameter  
- * from algoritm settings \ref sniffer_rs232_config  
- * The macro is wrapper over \ref sniffer_rs232_config_item_range
- * 
- * \param[in] X parameter name
- * \return minimum valid value
-*/
-#define SNIFFER_RS232_CFG_PARAM_MIN(X)          sniffer_rs232_config_item_range((uint32_t)&((struct sniffer_rs232_config*)0)->X, true)
-
-/** MACRO Get maximum valid value of a parameter
- * 
- * The macro returns maximum valid value of a parameter  
- * from algoritm settings \ref sniffer_rs232_config  
- * The macro is wrapper over \ref sniffer_rs232_config_item_range
- * 
- * \param[in] X parameter name
- * \return maximum valid value
-*/
-#define SNIFFER_RS232_CFG_PARAM_MAX(X)          sniffer_rs232_config_item_range((uint32_t)&((struct sniffer_rs232_config*)0)->X, false)
-
-/** MACRO Check whether parameter is valid
- * 
- * The macro checks whether parameter from algorithm settings is valid
- * 
- * \param[in] X parameter name
- * \param[in] V value of a parameter
- * \return true if a parameter is valid false otherwise
- */
-#define SNIFFER_RS232_CFG_PARAM_IS_VALID(X, V)  (((V) >= SNIFFER_RS232_CFG_PARAM_MIN(X)) && ((V) <= SNIFFER_RS232_CFG_PARAM_MAX(X)))
-
-/** MACRO Default algorithm settings
- * 
- * \result initializer for \ref sniffer_rs232_config
-*/
-#define SNIFFER_RS232_CONFIG_DEFAULT() {\
-                .channel_type = RS232_CHANNEL_ANY,\
-                .valid_packets_count = 20,\
-                .uart_error_count = 2,\
-                .baudrate_tolerance = 10,\
-                .min_detect_bits = 48,\
-                .exec_timeout = 600,\
-                .calc_attempts = 3,\
-                .lin_detection = false\
-            }
-
-/** Algorithm initialization
- * 
- * \param[in] __config algorithm settings
- * \return \ref RES_OK on success error otherwise
- */
-uint8_t sniffer_rs232_init(struct sniffer_rs232_config *__config);
-
-/** Algorithm deinitialization
- * 
- * \return \ref RES_OK on success error otherwise
- */
-uint8_t sniffer_rs232_deinit(void);
-
-/** Algorithm calculation
- * 
- * The function executes the algorithm
- * \note uart_init_ctx::baudrate is 0 if calculation failed  
- * Despite of it the function returns \ref RES_OK if all hypotheses have been tried
- * 
- * \param[out] uart_params UART parameters of RS-232 lines
- * \return \ref RES_OK on success error otherwise
- */
-uint8_t sniffer_rs232_calc(struct uart_init_ctx *uart_params);
-
-/** Valid value range of items from algorithm settings
- * 
- * The function is used to validate settings for the algorithm
- * 
- * \param[in] shift memory shift of an item over \ref sniffer_rs232_config
- * \param[in] is_min flag indicating lower border of an range if true, upper border if false
- * \return value of a border of a range
- */
-uint32_t sniffer_rs232_config_item_range(uint32_t shift, bool is_min);
-
-/** Check algorithm settings
- * 
- * \param[in] __config algorithm settings
- * \return true if settings are valid false otherwise
-*/
-bool sniffer_rs232_config_check(struct sniffer_rs232_config *__config);
-
-/** @} */
-
+/**
+\file
+\author JavaLandau
+\copyright MIT License
+\brief Header of algorithm of Sniffer RS-232
+*/
+
+#ifndef __SNIFFER_RS232_H__
+#define __SNIFFER_RS232_H__
+
+#include "common.h"
+#include "stm32f4xx_hal.h"
+#include "bsp_uart.h"
+#include <stdbool.h>
+#include <stddef.h>
+
+/** 
+ * \addtogroup sniffer_rs232
+ * @{
+*/
+
+/** RS-232 channel detection type */
+enum rs232_channel_type {
+    RS232_CHANNEL_TX = 0,       ///< Algorithm works only on RS-232 TX
+    RS232_CHANNEL_RX,           ///< Algorithm works only on RS-232 RX
+    RS232_CHANNEL_ANY,          ///< Algorithm works until one of the RS-232 channels calculated successfully
+    RS232_CHANNEL_ALL,          ///< Algorithm works on both RS-232 lines concurrently, each line gets its own UART parameters
+    RS232_CHANNEL_MAX           ///< Count of RS-232 channel detection types
+};
+
+/** MACRO Check if RS-232 channel detection type is valid
+ * 
+ * The macro checks whether \a TYPE is valid RS-232 channel detection type
+ * 
+ * \param[in] TYPE RS-232 channel detection type
+ * \return true if valid false otherwise
+*/
+#define RS232_CHANNEL_TYPE_VALID(TYPE)          (((uint32_t)(TYPE)) < RS232_CHANNEL_MAX)
+
+/** Type of baudrate calculation */
+enum rs232_baudrate_calc_type {
+    RS232_BAUDRATE_CALC_MIN_WIDTH = 0,  ///< Baudrate is calculated by minimum width of lower level on RS-232 line
+    RS232_BAUDRATE_CALC_HISTOGRAM,      ///< Baudrate is calculated by histogram of widths of both levels on RS-232 line
+    RS232_BAUDRATE_CALC_MAX             ///< Count of types of baudrate calculation
+};
+
+/** MACRO Check if type of baudrate calculation is valid
+ * 
+ * The macro checks whether \a TYPE is valid type of baudrate calculation
+ * 
+ * \param[in] TYPE type of baudrate calculation
+ * \return true if valid false otherwise
+*/
+#define RS232_BAUDRATE_CALC_TYPE_VALID(TYPE)    (((uint32_t)(TYPE)) < RS232_BAUDRATE_CALC_MAX)
+
+/** Type of capture of edges on RS-232 lines */
+enum rs232_capture_type {
+    RS232_CAPTURE_EXTI = 0,             ///< Timestamps of edges are read from timer in EXTI interrupts
+    RS232_CAPTURE_TIM_DMA,              ///< Timestamps of edges are latched by timer input capture and stored by DMA  
+                                        ///< \note Only RS-232 TX line supports it, RS-232 RX line always uses \ref RS232_CAPTURE_EXTI
+    RS232_CAPTURE_EXTI_STREAM,          ///< Widths between edges are accumulated into statistics in EXTI interrupts,  
+                                        ///< count of captured edges is not limited  
+                                        ///< \note Parameter part of the algorithm is always made in UART mode
+    RS232_CAPTURE_MAX                   ///< Count of types of capture of edges
+};
+
+/** MACRO Check if type of capture of edges is valid
+ * 
+ * The macro checks whether \a TYPE is valid type of capture of edges
+ * 
+ * \param[in] TYPE type of capture of edges
+ * \return true if valid false otherwise
+*/
+#define RS232_CAPTURE_TYPE_VALID(TYPE)          (((uint32_t)(TYPE)) < RS232_CAPTURE_MAX)
+
+/** Type of check of hypotheses regarding UART parameters */
+enum rs232_hyp_check_type {
+    RS232_HYP_CHECK_COUNT = 0,          ///< Hypothesis is approved after sniffer_rs232_config::valid_packets_count bytes  
+                                        ///< and failed after sniffer_rs232_config::uart_error_count errors
+    RS232_HYP_CHECK_SEQUENTIAL,         ///< Hypothesis is approved or failed by sequential probability ratio test  
+                                        ///< as soon as sniffer_rs232_config::hyp_confidence is reached, ratio of  
+                                        ///< sniffer_rs232_config::uart_error_count and sniffer_rs232_config::valid_packets_count  
+                                        ///< is expected rate of errors for valid hypothesis
+    RS232_HYP_CHECK_MAX                 ///< Count of types of check of hypotheses
+};
+
+/** MACRO Check if type of check of hypotheses is valid
+ * 
+ * The macro checks whether \a TYPE is valid type of check of hypotheses
+ * 
+ * \param[in] TYPE type of check of hypotheses
+ * \return true if valid false otherwise
+*/
+#define RS232_HYP_CHECK_TYPE_VALID(TYPE)        (((uint32_t)(TYPE)) < RS232_HYP_CHECK_MAX)
+
+/// Count of user baudrates in algorithm settings, see sniffer_rs232_config::user_baudrates
+#define SNIFFER_RS232_USER_BAUDRATES    (4)
+
+/// Minimum baudrate which can be detected by the algorithm
+#define SNIFFER_RS232_BAUDRATE_MIN      (1200)
+
+/// Maximum baudrate which can be detected by the algorithm
+#define SNIFFER_RS232_BAUDRATE_MAX      (1000000)
+
+/// Maximum baudrate which can be detected by the algorithm if sniffer_rs232_config::high_resolution is set
+#define SNIFFER_RS232_BAUDRATE_HIGH_MAX (3000000)
+
+/// Algorithm settings
+struct sniffer_rs232_config {
+    enum rs232_channel_type channel_type;   ///< RS-232 channel detection type
+    uint32_t valid_packets_count;           ///< Count of received bytes to approve a hypothesis
+    uint32_t uart_error_count;              ///< Count of UART frame errors when hypothesis is failed
+    uint8_t baudrate_tolerance;             ///< Tolerance of UART baudrate in percents
+    uint32_t min_detect_bits;               ///< Minimum count of lower levels (bits for \ref RS232_BAUDRATE_CALC_HISTOGRAM) on RS-232 line to analyse baudrate,  
+                                            ///< calculation is also finished when internal buffers are filled in unless \ref RS232_CAPTURE_EXTI_STREAM is used
+    uint32_t exec_timeout;                  ///< Maximum time of algorithm execution in seconds, on expiration the calculation  
+                                            ///< is finished with the best candidate, see \ref timeout_confidence
+    uint32_t calc_attempts;                 ///< Count of tries of algorithm calculation
+    bool lin_detection;                     ///< Flag whether LIN protocol should be detected
+    enum rs232_baudrate_calc_type baudrate_calc_type;   ///< Type of baudrate calculation
+    bool arbitrary_baudrate;                ///< Flag whether measured baudrate is used if it does not match any known baudrate
+    uint32_t user_baudrates[SNIFFER_RS232_USER_BAUDRATES];  ///< Baudrates detected in addition to the standard ones, 0 if not used
+    enum rs232_capture_type capture_type;   ///< Type of capture of edges on RS-232 lines
+    bool high_resolution;                   ///< Flag whether timer of the algorithm runs at full clock, baudrates up to  
+                                            ///< \ref SNIFFER_RS232_BAUDRATE_HIGH_MAX are detected  
+                                            ///< \note Baudrates above \ref SNIFFER_RS232_BAUDRATE_MAX are reliable only with \ref RS232_CAPTURE_TIM_DMA
+    enum rs232_hyp_check_type hyp_check_type;   ///< Type of check of hypotheses regarding UART parameters
+    uint8_t hyp_confidence;                 ///< Confidence of decision about hypothesis in percents for \ref RS232_HYP_CHECK_SEQUENTIAL
+    uint32_t verify_timeout;                ///< Maximum time of verification of known UART parameters in ms (see \ref sniffer_rs232_verify),  
+                                            ///< 0 if verification is disabled
+    bool raw_params_check;                  ///< Flag whether word length & parity are checked in software over raw 9 bits words  
+                                            ///< received in one UART window before UART reconfiguration for each hypothesis
+    uint32_t glitch_filter;                 ///< Minimum width of pulse on RS-232 lines in ns, narrower pulses are removed from capture  
+                                            ///< of edges as glitches, 0 if filter is disabled  
+                                            ///< \note Should be less than half of a bit at maximum baudrate
+    uint8_t timeout_confidence;             ///< Minimum confidence in percents of the best candidate of UART parameters to be  
+                                            ///< taken as result on \ref exec_timeout, 0 if the candidate is not taken
+};
+
+/// State of a RS-232 line detected by the algorithm before capture of edges
+enum sniffer_rs232_line_state {
+    SNIFFER_RS232_LINE_UNKNOWN = 0,         ///< State is not detected yet
+    SNIFFER_RS232_LINE_NORMAL,              ///< IDLE level of the line is upper one
+    SNIFFER_RS232_LINE_INVERTED,            ///< IDLE level of the line is lower one (e.g. TTL-level line with inverted polarity),  
+                                            ///< not supported by UART of MCU
+    SNIFFER_RS232_LINE_ABSENT               ///< The line is held in lower level without edges (e.g. not connected)
+};
+
+/// Baudrate measurement on a RS-232 line
+struct sniffer_rs232_baud_info {
+    uint32_t baudrate;                      ///< Detected baudrate in bods, 0 if not detected
+    uint32_t meas_baudrate;                 ///< Measured baudrate in bods, 0 if not measured
+    uint32_t nominal_baudrate;              ///< Known baudrate (standard or user one) nearest to \ref meas_baudrate
+    int32_t error_ppm;                      ///< Error of \ref meas_baudrate relative to \ref nominal_baudrate in ppm
+    enum sniffer_rs232_line_state line_state;   ///< State of the line, the calculation on absent or inverted line is finished without result
+};
+
+/// Quality of signal on a RS-232 line measured by captured edges
+struct sniffer_rs232_quality {
+    uint32_t widths_cnt;                    ///< Count of widths of levels the quality is measured by, 0 if not measured
+    int32_t baud_error_ppm;                 ///< Error of measured baudrate relative to the expected one in ppm
+    uint32_t jitter_ns;                     ///< RMS deviation of widths of levels from integer count of bits in ns excluding duty distortion
+    int32_t duty_distortion_ns;             ///< Widening of lower level (and narrowing of upper one) in ns caused by  
+                                            ///< asymmetry of falling & rising edges, negative if lower level is narrowed
+    uint32_t glitch_cnt;                    ///< Count of pulses removed since start of capture, see sniffer_rs232_config::glitch_filter
+};
+
+/// Best candidate of UART parameters of the algorithm calculation on a RS-232 line
+struct sniffer_rs232_candidate {
+    uint32_t baudrate;                      ///< Baudrate in bods, 0 if there is no candidate
+    enum uart_wordlen wordlen;              ///< Word length
+    enum uart_parity parity;                ///< Parity type
+    enum uart_stopbits stopbits;            ///< Count of stop bits
+    uint8_t confidence;                     ///< Posterior probability of the candidate in percents by its log-likelihood ratio,  
+                                            ///< the same measure as sniffer_rs232_config::hyp_confidence
+    uint32_t valid_cnt;                     ///< Count of valid words supporting the candidate
+    uint32_t error_cnt;                     ///< Count of UART errors against the candidate
+    bool approved;                          ///< Flag whether the candidate is approved by the calculation
+    bool timeout;                           ///< Flag whether the calculation is finished by sniffer_rs232_config::exec_timeout
+};
+
+/** Stage of the algorithm calculation executed by steps, see \ref sniffer_rs232_calc_step */
+enum sniffer_rs232_stage {
+    SNIFFER_RS232_STAGE_IDLE = 0,       ///< Calculation is not started or cancelled
+    SNIFFER_RS232_STAGE_BAUDRATE,       ///< Baudrate part: capture of edges on RS-232 lines
+    SNIFFER_RS232_STAGE_DECODE,         ///< Parameter part by software decoding of frames captured in baudrate part, capture goes on
+    SNIFFER_RS232_STAGE_RAW_PARAMS,     ///< Parameter part over raw words, see sniffer_rs232_config::raw_params_check
+    SNIFFER_RS232_STAGE_PARAMS,         ///< Parameter part in UART mode, hypotheses are checked one by one
+    SNIFFER_RS232_STAGE_DONE            ///< Calculation is finished, result is available by \ref sniffer_rs232_calc_result_get
+};
+
+/// Progress of the algorithm calculation executed by steps on RS-232 line
+struct sniffer_rs232_progress {
+    enum sniffer_rs232_stage stage;     ///< Current stage of the calculation
+    uint32_t attempt;                   ///< Number of the current attempt starting from 1, see sniffer_rs232_config::calc_attempts
+    uint32_t edges_cnt;                 ///< Count of edges captured on RS-232 line in the current attempt
+    uint32_t baudrate;                  ///< Current candidate baudrate in bods, 0 if not calculated yet
+    enum uart_wordlen wordlen;          ///< Word length of the current hypothesis, valid in parameter part
+    enum uart_parity parity;            ///< Parity type of the current hypothesis, valid in parameter part
+    uint32_t valid_cnt;                 ///< Count of valid words of the current hypothesis on RS-232 line
+    uint32_t error_parity_cnt;          ///< Count of parity errors of the current hypothesis on RS-232 line
+    uint32_t error_frame_cnt;           ///< Count of frame errors of the current hypothesis on RS-232 line
+};
+
+/** MACRO Get minimum valid value of a parameter
+ * 
+ * The macro returns minimum valid value of a parameter  
+ * from algoritm settings \ref sniffer_rs232_config  
+ * The macro is wrapper over \ref sniffer_rs232_config_item_range
+ * 
+ * \param[in] X parameter name
+ * \return minimum valid value
+*/
+#define SNIFFER_RS232_CFG_PARAM_MIN(X)          sniffer_rs232_config_item_range(offsetof(struct sniffer_rs232_config, X), true)
+
+/** MACRO Get maximum valid value of a parameter
+ * 
+ * The macro returns maximum valid value of a parameter  
+ * from algoritm settings \ref sniffer_rs232_config  
+ * The macro is wrapper over \ref sniffer_rs232_config_item_range
+ * 
+ * \param[in] X parameter name
+ * \return maximum valid value
+*/
+#define SNIFFER_RS232_CFG_PARAM_MAX(X)          sniffer_rs232_config_item_range(offsetof(struct sniffer_rs232_config, X), false)
+
+/** MACRO Check whether parameter is valid
+ * 
+ * The macro checks whether parameter from algorithm settings is valid
+ * 
+ * \param[in] X parameter name
+ * \param[in] V value of a parameter
+ * \return true if a parameter is valid false otherwise
+ */
+#define SNIFFER_RS232_CFG_PARAM_IS_VALID(X, V)  (((V) >= SNIFFER_RS232_CFG_PARAM_MIN(X)) && ((V) <= SNIFFER_RS232_CFG_PARAM_MAX(X)))
+
+/** MACRO Default algorithm settings
+ * 
+ * \result initializer for \ref sniffer_rs232_config
+*/
+#define SNIFFER_RS232_CONFIG_DEFAULT() {\
+                .channel_type = RS232_CHANNEL_ANY,\
+                .valid_packets_count = 20,\
+                .uart_error_count = 2,\
+                .baudrate_tolerance = 10,\
+                .min_detect_bits = 48,\
+                .exec_timeout = 600,\
+                .calc_attempts = 3,\
+                .lin_detection = false,\
+                .baudrate_calc_type = RS232_BAUDRATE_CALC_HISTOGRAM,\
+                .arbitrary_baudrate = false,\
+                .user_baudrates = {0},\
+                .capture_type = RS232_CAPTURE_TIM_DMA,\
+                .high_resolution = false,\
+                .hyp_check_type = RS232_HYP_CHECK_COUNT,\
+                .hyp_confidence = 95,\
+                .verify_timeout = 50,\
+                .raw_params_check = false,\
+                .glitch_filter = 0,\
+                .timeout_confidence = 0\
+            }
+
+/** Algorithm initialization
+ * 
+ * \param[in] __config algorithm settings
+ * \return \ref RES_OK on success error otherwise
+ */
+uint8_t sniffer_rs232_init(struct sniffer_rs232_config *__config);
+
+/** Algorithm deinitialization
+ * 
+ * \return \ref RES_OK on success error otherwise
+ */
+uint8_t sniffer_rs232_deinit(void);
+
+/** Algorithm calculation
+ * 
+ * The function executes the algorithm
+ * \note uart_init_ctx::baudrate is 0 if calculation failed  
+ * Despite of it the function returns \ref RES_OK if all hypotheses have been tried or sniffer_rs232_config::exec_timeout expired  
+ * Parameters of both lines are the same unless sniffer_rs232_config::channel_type is \ref RS232_CHANNEL_ALL
+ * 
+ * \param[out] tx_params UART parameters of RS-232 TX line
+ * \param[out] rx_params UART parameters of RS-232 RX line
+ * \return \ref RES_OK on success error otherwise
+ */
+uint8_t sniffer_rs232_calc(struct uart_init_ctx *tx_params, struct uart_init_ctx *rx_params);
+
+/** Start of the algorithm calculation executed by steps
+ * 
+ * The function starts the algorithm without blocking, the calculation is driven  
+ * by \ref sniffer_rs232_calc_step from the main loop. Calculation in process is restarted  
+ * In \ref RS232_CHANNEL_ALL mode both lines are calculated concurrently and independently
+ * \note Lines are waited for IDLE state concurrently by steps as well, state of each line  
+ * (absent, inverted) is reported by \ref sniffer_rs232_baud_info_get
+ * 
+ * \return \ref RES_OK on success error otherwise
+ */
+uint8_t sniffer_rs232_calc_start(void);
+
+/** Start of the algorithm calculation on one RS-232 line
+ * 
+ * The function is the same as \ref sniffer_rs232_calc_start but only RS-232 line \p type is used  
+ * regardless of sniffer_rs232_config::channel_type, UART instance and calculation of the other line are not touched  
+ * \note UART instance of \p type should be deinitialized before the call
+ * 
+ * \param[in] type RS-232 line, should be \ref BSP_UART_TYPE_RS232_TX or \ref BSP_UART_TYPE_RS232_RX
+ * \return \ref RES_OK on success error otherwise
+ */
+uint8_t sniffer_rs232_line_calc_start(enum uart_type type);
+
+/** Step of the algorithm calculation
+ * 
+ * The function makes one short step of the algorithm started by \ref sniffer_rs232_calc_start  
+ * and returns without waiting for data on RS-232 lines  
+ * On error calculation is finished and hardware resources are released
+ * 
+ * \param[out] finished flag whether calculation is finished on all lines (see \ref SNIFFER_RS232_STAGE_DONE)
+ * \return \ref RES_OK on success error otherwise
+ */
+uint8_t sniffer_rs232_calc_step(bool *finished);
+
+/** Cancel of the algorithm calculation
+ * 
+ * The function stops calculation in process and releases hardware resources,  
+ * stage is set to \ref SNIFFER_RS232_STAGE_IDLE
+ * 
+ * \return \ref RES_OK on success error otherwise
+ */
+uint8_t sniffer_rs232_calc_cancel(void);
+
+/** Progress of the algorithm calculation on RS-232 line
+ * 
+ * \param[in] type RS-232 line, should be \ref BSP_UART_TYPE_RS232_TX or \ref BSP_UART_TYPE_RS232_RX
+ * \param[out] progress progress of the calculation, sniffer_rs232_progress::stage is \ref SNIFFER_RS232_STAGE_IDLE  
+ * if the line is not used by the calculation
+ * \return \ref RES_OK on success error otherwise
+ */
+uint8_t sniffer_rs232_calc_progress_get(enum uart_type type, struct sniffer_rs232_progress *progress);
+
+/** Result of the algorithm calculation executed by steps on RS-232 line
+ * 
+ * \note uart_init_ctx::baudrate is 0 if calculation failed.  
+ * If the calculation works on one line (or until one of lines is calculated),  
+ * result of the calculation is the same for both lines
+ * 
+ * \param[in] type RS-232 line, should be \ref BSP_UART_TYPE_RS232_TX or \ref BSP_UART_TYPE_RS232_RX
+ * \param[out] uart_params UART parameters of RS-232 line
+ * \return result of the calculation if it is finished, \ref RES_NOT_ALLOWED otherwise
+ */
+uint8_t sniffer_rs232_calc_result_get(enum uart_type type, struct uart_init_ctx *uart_params);
+
+/** Best candidate of UART parameters of the algorithm calculation on RS-232 line
+ * 
+ * The function returns the most likely UART parameters by evidence collected so far  
+ * (software decoding and UART checks of hypotheses over all attempts), so it may be called  
+ * during the calculation as well. The candidate is the result if it is approved or accepted  
+ * on sniffer_rs232_config::exec_timeout by sniffer_rs232_config::timeout_confidence
+ * 
+ * \param[in] type RS-232 line, should be \ref BSP_UART_TYPE_RS232_TX or \ref BSP_UART_TYPE_RS232_RX
+ * \param[out] candidate best candidate, sniffer_rs232_candidate::baudrate is 0 if there is no one
+ * \return \ref RES_OK on success error otherwise
+ */
+uint8_t sniffer_rs232_candidate_get(enum uart_type type, struct sniffer_rs232_candidate *candidate);
+
+/** Verification of known UART parameters
+ * 
+ * The function checks whether data on RS-232 lines is received without errors with UART parameters \p uart_params  
+ * during sniffer_rs232_config::verify_timeout. Decision is made the same way as for hypotheses  
+ * of the algorithm, see sniffer_rs232_config::hyp_check_type
+ * \note The function is much faster than \ref sniffer_rs232_calc so it is used to check recently detected parameters.  
+ * In \ref RS232_CHANNEL_ALL mode decision is made for each line separately
+ * 
+ * \param[in] uart_params UART parameters of RS-232 lines
+ * \param[out] tx_verified flag whether \p uart_params are verified on RS-232 TX line
+ * \param[out] rx_verified flag whether \p uart_params are verified on RS-232 RX line
+ * \return \ref RES_OK on success error otherwise
+ */
+uint8_t sniffer_rs232_verify(struct uart_init_ctx *uart_params, bool *tx_verified, bool *rx_verified);
+
+/** Baudrate measurement of the last calculation
+ * 
+ * \param[in] type RS-232 line, should be \ref BSP_UART_TYPE_RS232_TX or \ref BSP_UART_TYPE_RS232_RX
+ * \param[out] info baudrate measurement on the line
+ * \return \ref RES_OK on success error otherwise
+ */
+uint8_t sniffer_rs232_baud_info_get(enum uart_type type, struct sniffer_rs232_baud_info *info);
+
+/** Start of drift tracking of baudrate
+ * 
+ * The function starts background capture of widths on RS-232 lines via EXTI while  
+ * UART instances keep receiving data on the same pins. Widths are accumulated  
+ * by windows of limited count of edges to bound interrupt load
+ * \note Calculation of the algorithm stops drift tracking as they share the same resources
+ * 
+ * \return \ref RES_OK on success error otherwise
+ */
+uint8_t sniffer_rs232_drift_start(void);
+
+/** Stop of drift tracking of baudrate
+ * 
+ * \return \ref RES_OK on success error otherwise
+ */
+uint8_t sniffer_rs232_drift_stop(void);
+
+/** Measured baudrate of drift tracking
+ * 
+ * The function measures actual baudrate on RS-232 line by widths accumulated  
+ * since the previous call and starts the next window of drift tracking
+ * 
+ * \param[in] type RS-232 line, should be \ref BSP_UART_TYPE_RS232_TX or \ref BSP_UART_TYPE_RS232_RX
+ * \param[out] baudrate measured baudrate, 0 if less than sniffer_rs232_config::min_detect_bits bits are captured
+ * \return \ref RES_OK on success error otherwise
+ */
+uint8_t sniffer_rs232_drift_get(enum uart_type type, uint32_t *baudrate);
+
+/** Quality of signal on RS-232 line
+ * 
+ * The function measures quality of signal by edges captured on RS-232 line  
+ * during the recent calculation of the algorithm or window of drift tracking  
+ * (see \ref sniffer_rs232_drift_start), widths of levels are related to \p baudrate
+ * \note Glitches are counted only in EXTI capture, \ref RS232_CAPTURE_TIM_DMA uses input filter of the timer
+ * 
+ * \param[in] type RS-232 line, should be \ref BSP_UART_TYPE_RS232_TX or \ref BSP_UART_TYPE_RS232_RX
+ * \param[in] baudrate expected baudrate on the line in bods
+ * \param[out] quality quality of signal on the line, sniffer_rs232_quality::widths_cnt is 0 if not enough edges are captured
+ * \return \ref RES_OK on success error otherwise
+ */
+uint8_t sniffer_rs232_quality_get(enum uart_type type, uint32_t baudrate, struct sniffer_rs232_quality *quality);
+
+/** Replay of traffic captured during the algorithm calculation
+ * 
+ * The function decodes by \p uart_params edges captured on RS-232 line in baudrate stage  
+ * and appends words received over UART during check of the last hypothesis,  
+ * so traffic passed during the calculation is not lost for the user
+ * \note Words passed between the captured edges and the last hypothesis are lost,  
+ * raw words (see sniffer_rs232_config::raw_params_check) are not appended for 7 bits frames
+ * 
+ * \param[in] type RS-232 line, should be \ref BSP_UART_TYPE_RS232_TX or \ref BSP_UART_TYPE_RS232_RX
+ * \param[in] uart_params UART parameters of the line, result of the calculation
+ * \param[out] data captured words masked by data bits
+ * \param[in,out] len size of \p data on input, count of captured words on output
+ * \return \ref RES_OK on success error otherwise
+ */
+uint8_t sniffer_rs232_replay_get(enum uart_type type, const struct uart_init_ctx *uart_params, uint16_t *data, uint32_t *len);
+
+/** Valid value range of items from algorithm settings
+ * 
+ * The function is used to validate settings for the algorithm
+ * 
+ * \param[in] shift memory shift of an item over \ref sniffer_rs232_config
+ * \param[in] is_min flag indicating lower border of an range if true, upper border if false
+ * \return value of a border of a range
+ */
+uint32_t sniffer_rs232_config_item_range(uint32_t shift, bool is_min);
+
+/** Check algorithm settings
+ * 
+ * \param[in] __config algorithm settings
+ * \return true if settings are valid false otherwise
+*/
+bool sniffer_rs232_config_check(struct sniffer_rs232_config *__config);
+
+/** @} */
+
 #endif //__SNIFFER_RS232_H__
\ No newline at end of file
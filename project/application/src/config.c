@@ -1,127 +1,260 @@
-/**
-\file
-\author JavaLandau
-\copyright MIT License
-\brief Flash configuration
-
-The file includes API to save/load configuration into/from internal MPU flash
-*/
-
-#include "config.h"
-#include "bsp_crc.h"
-#include <string.h>
-
-/** 
- * \defgroup config Configuration
- * \brief Module of firmware configuration stored in internal flash
- * \ingroup application
- * @{
-*/
-
-/// Address of internal flash where configuration is stored
-#define FLASH_SECTOR_CFG_ADDR   (0x08060000)
-
-/* Save configuration, see header file for details */
-uint8_t config_save(struct flash_config *config)
-{
-    if (!config)
-        return RES_INVALID_PAR;
-
-    /* CRC calculation */
-    uint32_t crc = 0;
-    uint8_t res = bsp_crc_calc((uint8_t*)config, sizeof(struct flash_config) - sizeof(uint32_t), &crc);
-
-    if (res != RES_OK)
-        return RES_NOK;
-
-    config->crc = crc;
-
-    /* Erase necessary sectors of INT FLASH */
-    uint32_t sec_error = 0;
-
-    FLASH_EraseInitTypeDef erase_init;
-    erase_init.Banks = FLASH_BANK_1;
-    erase_init.VoltageRange = FLASH_VOLTAGE_RANGE_3;
-    erase_init.Sector = FLASH_SECTOR_7;
-    erase_init.TypeErase = FLASH_TYPEERASE_SECTORS;
-    erase_init.NbSectors = 1;
-
-    HAL_StatusTypeDef hal_res = HAL_FLASH_Unlock();
-
-    if(hal_res != HAL_OK)
-        return RES_NOK;
-
-    do {
-        hal_res = HAL_FLASHEx_Erase(&erase_init, &sec_error);
-
-        if(hal_res != HAL_OK) {
-            res = RES_NOK;
-            break;
-        }
-
-        /* Write into INT FLASH */
-        uint32_t size = sizeof(struct flash_config);
-        uint8_t size_tail = size % sizeof(uint32_t);
-        uint8_t *p_config = (uint8_t*)config;
-        uint32_t int_addr = FLASH_SECTOR_CFG_ADDR;
-
-        for(uint32_t i = 0; i < (size - size_tail); i += sizeof(uint32_t)){
-            hal_res = HAL_FLASH_Program(FLASH_TYPEPROGRAM_WORD, int_addr, *((uint32_t*)p_config));
-
-            if (hal_res != HAL_OK)
-                break;
-
-            p_config += sizeof(uint32_t);
-            int_addr += sizeof(uint32_t);
-        }
-
-        if (hal_res != HAL_OK) {
-            res = RES_NOK;
-            break;
-        }
-
-        for(uint32_t i = 0; i < size_tail; i++){
-            hal_res = HAL_FLASH_Program(FLASH_TYPEPROGRAM_BYTE, int_addr, *p_config);
-
-            if (hal_res != HAL_OK)
-                break;
-
-            p_config += sizeof(uint8_t);
-            int_addr += sizeof(uint8_t);
-        }
-
-        if (hal_res != HAL_OK) {
-            res = RES_NOK;
-            break;
-        }
-    } while(0);
-
-    HAL_FLASH_Lock();
-
-    return res;
-}
-
-/* Read configuration, see header file for details */
-uint8_t config_read(struct flash_config *config)
-{
-    if (!config)
-        return RES_INVALID_PAR;
-
-    /* Read from flash */
-    uint32_t int_addr = FLASH_SECTOR_CFG_ADDR;
-    memcpy((uint8_t*)config, (uint8_t*)int_addr, sizeof(struct flash_config));
-
-    /* CRC check */
-    uint32_t crc = 0;
-    uint8_t res = bsp_crc_calc((uint8_t*)config, sizeof(struct flash_config) - sizeof(uint32_t), &crc);
-
-    if (res != RES_OK)
-        return RES_NOK;
-
-    if (config->crc != crc)
-        return RES_NOK;
-
-    return RES_OK;
-}
-
+/**
+\file
+\author JavaLandau
+\copyright MIT License
+\brief Flash configuration
+
+The file includes API to save/load configuration into/from internal MPU flash
+*/
+
+#include "config.h"
+#include "bsp_crc.h"
+#include <string.h>
+
+/** 
+ * \defgroup config Configuration
+ * \brief Module of firmware configuration stored in internal flash
+ * \ingroup application
+ * @{
+*/
+
+/// Address of internal flash where configuration is stored
+#define FLASH_SECTOR_CFG_ADDR   (0x08060000)
+
+/// Size of sector of internal flash where configuration is stored
+#define FLASH_SECTOR_CFG_SIZE   (0x20000)
+
+/// Address of log of hits of flash_config::history, the first word following configuration
+#define FLASH_HISTORY_LOG_ADDR  (FLASH_SECTOR_CFG_ADDR + ((sizeof(struct flash_config) + 3) & ~3u))
+
+/// Count of words of log of hits of flash_config::history
+#define FLASH_HISTORY_LOG_SIZE  (1024)
+
+/// Value of erased word of internal flash, it terminates log of hits of flash_config::history
+#define FLASH_ERASED_WORD       (0xFFFFFFFF)
+
+_Static_assert((FLASH_HISTORY_LOG_ADDR - FLASH_SECTOR_CFG_ADDR) + FLASH_HISTORY_LOG_SIZE * sizeof(uint32_t) <= FLASH_SECTOR_CFG_SIZE,
+               "Log of hits of history exceeds flash sector of configuration");
+
+/** Count of records in log of hits of flash_config::history
+ * 
+ * Hit of existing item of history is programmed into erased word of the log  
+ * instead of erase of the whole sector, the log is cleared by \ref config_save
+ */
+static uint32_t history_log_cnt = FLASH_HISTORY_LOG_SIZE;
+
+/** Comparison of items of history
+ * 
+ * \param[in] a item of flash_config::history
+ * \param[in] b item of flash_config::history
+ * \return true if items are equal false otherwise
+ */
+static bool __config_history_item_equal(const struct uart_presettings *a, const struct uart_presettings *b)
+{
+    return (a->enable == b->enable) && (a->baudrate == b->baudrate) && (a->wordlen == b->wordlen) &&
+           (a->parity == b->parity) && (a->stopbits == b->stopbits) && (a->lin_enabled == b->lin_enabled);
+}
+
+/** Move of item of history on the top
+ * 
+ * \param[in,out] config configuration
+ * \param[in] idx index of moved item of flash_config::history
+ * \param[in] item moved item
+ */
+static void __config_history_top_set(struct flash_config *config, uint32_t idx, const struct uart_presettings *item)
+{
+    for (uint32_t i = idx; i > 0; i--)
+        config->history[i] = config->history[i - 1];
+
+    config->history[0] = *item;
+}
+
+/** Record of hit of item of history into the log
+ * 
+ * \param[in] idx index of hit item of flash_config::history
+ * \return \ref RES_OK on success, \ref RES_OVERFLOW if the log is full, error otherwise
+ */
+static uint8_t __config_history_log_add(uint32_t idx)
+{
+    if (history_log_cnt >= FLASH_HISTORY_LOG_SIZE)
+        return RES_OVERFLOW;
+
+    if (HAL_FLASH_Unlock() != HAL_OK)
+        return RES_NOK;
+
+    /* Erased word is programmed without erase of the sector */
+    HAL_StatusTypeDef hal_res = HAL_FLASH_Program(FLASH_TYPEPROGRAM_WORD, FLASH_HISTORY_LOG_ADDR + history_log_cnt * sizeof(uint32_t), idx);
+
+    HAL_FLASH_Lock();
+
+    /* Word is skipped on failure, it is not erased any more */
+    history_log_cnt++;
+
+    return (hal_res == HAL_OK) ? RES_OK : RES_NOK;
+}
+
+/* Save configuration, see header file for details */
+uint8_t config_save(struct flash_config *config)
+{
+    if (!config)
+        return RES_INVALID_PAR;
+
+    /* CRC calculation */
+    uint32_t crc = 0;
+    uint8_t res = bsp_crc_calc((uint8_t*)config, sizeof(struct flash_config) - sizeof(uint32_t), &crc);
+
+    if (res != RES_OK)
+        return RES_NOK;
+
+    config->crc = crc;
+
+    /* Erase necessary sectors of INT FLASH */
+    uint32_t sec_error = 0;
+
+    FLASH_EraseInitTypeDef erase_init;
+    erase_init.Banks = FLASH_BANK_1;
+    erase_init.VoltageRange = FLASH_VOLTAGE_RANGE_3;
+    erase_init.Sector = FLASH_SECTOR_7;
+    erase_init.TypeErase = FLASH_TYPEERASE_SECTORS;
+    erase_init.NbSectors = 1;
+
+    HAL_StatusTypeDef hal_res = HAL_FLASH_Unlock();
+
+    if(hal_res != HAL_OK)
+        return RES_NOK;
+
+    do {
+        hal_res = HAL_FLASHEx_Erase(&erase_init, &sec_error);
+
+        if(hal_res != HAL_OK) {
+            res = RES_NOK;
+            break;
+        }
+
+        /* Write into INT FLASH */
+        uint32_t size = sizeof(struct flash_config);
+        uint8_t size_tail = size % sizeof(uint32_t);
+        uint8_t *p_config = (uint8_t*)config;
+        uint32_t int_addr = FLASH_SECTOR_CFG_ADDR;
+
+        for(uint32_t i = 0; i < (size - size_tail); i += sizeof(uint32_t)){
+            hal_res = HAL_FLASH_Program(FLASH_TYPEPROGRAM_WORD, int_addr, *((uint32_t*)p_config));
+
+            if (hal_res != HAL_OK)
+                break;
+
+            p_config += sizeof(uint32_t);
+            int_addr += sizeof(uint32_t);
+        }
+
+        if (hal_res != HAL_OK) {
+            res = RES_NOK;
+            break;
+        }
+
+        for(uint32_t i = 0; i < size_tail; i++){
+            hal_res = HAL_FLASH_Program(FLASH_TYPEPROGRAM_BYTE, int_addr, *p_config);
+
+            if (hal_res != HAL_OK)
+                break;
+
+            p_config += sizeof(uint8_t);
+            int_addr += sizeof(uint8_t);
+        }
+
+        if (hal_res != HAL_OK) {
+            res = RES_NOK;
+            break;
+        }
+    } while(0);
+
+    HAL_FLASH_Lock();
+
+    /* Log of hits is erased together with configuration */
+    history_log_cnt = (res == RES_OK) ? 0 : FLASH_HISTORY_LOG_SIZE;
+
+    return res;
+}
+
+/* Read configuration, see header file for details */
+uint8_t config_read(struct flash_config *config)
+{
+    if (!config)
+        return RES_INVALID_PAR;
+
+    /* Read from flash */
+    uint32_t int_addr = FLASH_SECTOR_CFG_ADDR;
+    memcpy((uint8_t*)config, (uint8_t*)int_addr, sizeof(struct flash_config));
+
+    /* CRC check */
+    uint32_t crc = 0;
+    uint8_t res = bsp_crc_calc((uint8_t*)config, sizeof(struct flash_config) - sizeof(uint32_t), &crc);
+
+    if (res != RES_OK)
+        return RES_NOK;
+
+    if (config->crc != crc)
+        return RES_NOK;
+
+    /* Hits of history since the last save are replayed in order */
+    const uint32_t *log = (const uint32_t*)FLASH_HISTORY_LOG_ADDR;
+
+    for (history_log_cnt = 0; history_log_cnt < FLASH_HISTORY_LOG_SIZE; history_log_cnt++) {
+        uint32_t idx = log[history_log_cnt];
+
+        if (idx == FLASH_ERASED_WORD)
+            break;
+
+        if (idx < CONFIG_HISTORY_SIZE) {
+            struct uart_presettings item = config->history[idx];
+            __config_history_top_set(config, idx, &item);
+        }
+    }
+
+    return RES_OK;
+}
+
+/* Add UART parameters into history, see header file for details */
+uint8_t config_history_add(struct flash_config *config, struct uart_init_ctx *uart_params, bool *changed)
+{
+    if (!config || !uart_params || !changed || !uart_params->baudrate)
+        return RES_INVALID_PAR;
+
+    struct uart_presettings item = {
+        .enable = true,
+        .baudrate = uart_params->baudrate,
+        .wordlen = uart_params->wordlen,
+        .parity = uart_params->parity,
+        .stopbits = uart_params->stopbits,
+        .lin_enabled = uart_params->lin_enabled
+    };
+
+    /* Position of the same item, otherwise the least recent one is removed */
+    uint32_t idx = CONFIG_HISTORY_SIZE - 1;
+    bool found = false;
+
+    for (uint32_t i = 0; i < CONFIG_HISTORY_SIZE; i++) {
+        if (__config_history_item_equal(&config->history[i], &item)) {
+            idx = i;
+            found = true;
+            break;
+        }
+    }
+
+    *changed = false;
+
+    if (found && !idx)
+        return RES_OK;
+
+    __config_history_top_set(config, idx, &item);
+
+    /* Hit of existing item is logged, the sector is erased only for new item or full log */
+    if (found && __config_history_log_add(idx) == RES_OK)
+        return RES_OK;
+
+    *changed = true;
+
+    return RES_OK;
+}
+
 /** @} */
\ No newline at end of file
@@ -1,494 +1,1264 @@
-/**
-\file
-\author JavaLandau
-\copyright MIT License
-\brief Main project file
-
-The file includes main routine of the firmware: start menu of configuration,  
-algorithm usage, error handlers and etc.
-*/
-
-#include "common.h"
-#include "stm32f4xx_hal.h"
-#include "app_led.h"
-#include "bsp_rcc.h"
-#include "bsp_lcd1602.h"
-#include "bsp_uart.h"
-#include "bsp_crc.h"
-#include "bsp_button.h"
-#include "sniffer_rs232.h"
-#include "config.h"
-#include "cli.h"
-#include <stdbool.h>
-#include <stdio.h>
-#include <string.h>
-
-/** 
- * \defgroup application Application
- * \brief Application layer of the firmware
-*/
-
-/** 
- * \defgroup main Main
- * \brief Firmware main routine
- * \ingroup application
- * @{
-*/
-
-/// Firmware version
-#define APP_VERSION             "1.0"
-
-/// Size of RX buffer to store data received from \ref bsp_uart
-#define UART_RX_BUFF            (256)
-
-/** MACRO Flag whether UART errors occured
- * 
- * \param[in] X type of UART, see \ref uart_type
- * \result true if some errors took place, false otherwise
-*/
-#define IS_UART_ERROR(X)        (uart_flags[X].error || uart_flags[X].overflow)
-
-/// Array of char aliases for \ref uart_parity for output purposes
-static const char uart_parity_sym[] = {'N', 'E', 'O'};
-
-/// Array of string aliases for \ref uart_type for output purposes
-static const char *display_uart_type_str[] = {"CLI", "TX", "RX"};
-
-/// Flag whether press event on the button is occured
-static bool press_event = false;
-
-///UART flags
-static struct {
-    uint32_t error;                     ///< Mask of UART errors
-    bool overflow;                      ///< Flag whether UART RX buffer is overflown before call \ref bsp_uart_read
-    bool lin_break;                     ///< Flag whether LIN break detection is occured
-} uart_flags[BSP_UART_TYPE_MAX] = {0};
-
-/** Callback for UART LIN break detection
- * 
- * Callback is called from \ref bsp_uart when LIN break is detected
- * 
- * \param[in] type UART type
- * \param[in] params optional parameters
- */
-static void uart_lin_break_cb(enum uart_type type, void *params)
-{
-    if (!UART_TYPE_VALID(type))
-        return;
-
-    uart_flags[type].lin_break = true;
-}
-
-/** Callback for UART overflow
- * 
- * Callback is called from \ref bsp_uart when overflow of RX buffer is occured
- * 
- * \param[in] type UART type
- * \param[in] params optional parameters
- */
-static void uart_overflow_cb(enum uart_type type, void *params)
-{
-    if (!UART_TYPE_VALID(type))
-        return;
-
-    uart_flags[type].overflow = true;
-}
-
-/** Callback for UART errors
- * 
- * Callback is called from \ref bsp_uart when UART errors are occured
- * 
- * \param[in] type UART type
- * \param[in] error mask of occured UART errors
- * \param[in] params optional parameters
- */
-static void uart_error_cb(enum uart_type type, uint32_t error, void *params)
-{
-    if (!UART_TYPE_VALID(type))
-        return;
-
-    uart_flags[type].error |= error;
-}
-
-/** Callback for button actions
- * 
- * Callback is called from \ref bsp_button when actions on  
- * the button are occured. Algorithm of the callback is the following:
- * 
- * 1. Action \ref BUTTON_PRESSED occured:  
- * If menu is started or waiting to be started - skip menu start  
- * otherwise - start/stop toggle of UART reception from RS-232 channels
- * 
- * 2. Action \ref BUTTON_LONG_PRESSED  
- * Software reset of the chip in any cases
- * 
- * \param[in] action BUTTON action, see \ref button_action
- */
-static void button_cb(enum button_action action)
-{
-    switch(action) {
-    case BUTTON_PRESSED:
-        if (!cli_menu_is_started())
-            press_event = true;
-        else
-            cli_menu_exit();
-        break;
-
-    case BUTTON_LONG_PRESSED:
-        HAL_NVIC_SystemReset();
-
-    default:
-        break;
-    }
-}
-
-/** Wait for press event
- * 
- * The function waits when \ref BUTTON_PRESSED occured, using \ref press_event  
- * \ref press_event is cleared if was set
- * 
- * \param[in] tmt timeout in ms for event waiting
- * \return true if event occured, false otherwise
- */
-static bool button_wait_event(uint32_t tmt)
-{
-    bool __press_event = false;
-    uint32_t tick_start = HAL_GetTick();
-
-    do {
-        if (press_event) {
-            __press_event = true;
-            press_event = false;
-            break;
-        }
-    } while((HAL_GetTick() - tick_start) < tmt);
-
-    return __press_event;
-}
-
-/** Routine for internal error
- * 
- * The function calls when occured errors on the firmware  
- * do not let it working further. The function uses politics of LED signaling
- * \warning The function is firmware dead end and reset is needed to start firmware
- * 
- * \param[in] led_event politics of LED signaling
- */
-static void internal_error(enum led_event led_event)
-{
-    app_led_set(led_event);
-
-    while(1);
-}
-
-/** Main routine of the firmware 
- * 
- * \return NOT used
-*/
-int main()
-{
-    /* Basic initialization */
-    HAL_Init();
-
-    if (bsp_rcc_main_config_init() != RES_OK)
-        HAL_NVIC_SystemReset();
-
-    /* BSP LED & CRC initialization */
-    uint8_t res = app_led_init();
-
-    if (res != RES_OK)
-        HAL_NVIC_SystemReset();
-
-    res = bsp_crc_init();
-
-    if (res != RES_OK)
-        internal_error(LED_EVENT_CRC_ERROR);
-
-    /* Read/initialization of the device configuration from internal flash */
-    struct flash_config config;
-
-    if (config_read(&config) != RES_OK) {
-        struct flash_config flash_config_default = FLASH_CONFIG_DEFAULT();
-        config = flash_config_default;
-        res = config_save(&config);
-
-        if (res != RES_OK)
-            internal_error(LED_EVENT_FLASH_ERROR);
-    }
-
-    /* LCD1602 initialization */
-    struct lcd1602_settings settings = {
-        .num_line = LCD1602_NUM_LINE_2,
-        .font_size = LCD1602_FONT_SIZE_5X8,
-        .type_move_cursor = LCD1602_CURSOR_MOVE_RIGHT,
-        .shift_entire_disp = LCD1602_SHIFT_ENTIRE_PERFORMED,
-        .type_interface = LCD1602_INTERFACE_8BITS,
-        .disp_state = LCD1602_DISPLAY_ON,
-        .cursor_state = LCD1602_CURSOR_OFF,
-        .cursor_blink_state = LCD1602_CURSOR_BLINK_OFF
-    };
-
-    res = bsp_lcd1602_init(&settings);
-
-    if (res != RES_OK)
-        internal_error(LED_EVENT_LCD1602_ERROR);
-
-    /* Button initialization */
-    struct button_init_ctx button_init_ctx = {
-        .press_delay_ms = 500,
-        .press_min_dur_ms = 70,
-        .long_press_dur_ms = 1000,
-        .button_isr_cb = button_cb,
-    };
-
-    res = bsp_button_init(&button_init_ctx);
-
-    if (res != RES_OK) {
-        bsp_lcd1602_cprintf("BUTTON ERR %u", NULL, res);
-        internal_error(LED_EVENT_COMMON_ERROR);
-    }
-
-    /* Initialization of CLI */
-    res = cli_init();
-
-    if (res != RES_OK) {
-        bsp_lcd1602_cprintf("CLI ERR %u", NULL, res);
-        internal_error(LED_EVENT_COMMON_ERROR);
-    }
-
-    cli_terminal_reset();
-
-    /* Welcome stage */
-    bsp_lcd1602_cprintf("SNIFFER RS-232", "V.%s", APP_VERSION);
-
-    cli_trace("**********************************************************\r\n");
-    cli_trace("**********************SNIFFER RS-232**********************\r\n");
-    cli_trace("**********************************************************\r\n");
-    cli_trace("Version: %s\r\n", APP_VERSION);
-    cli_trace("Build date: %s %s\r\n", __DATE__, __TIME__);
-
-    bool is_pressed = false;
-    cli_welcome("Press any key to start menu or push button to skip", 5, &press_event, &is_pressed);
-    cli_terminal_reset();
-
-    press_event = false;
-    bsp_lcd1602_display_clear();
-
-    /* Stage of configuration menu */
-    if (is_pressed) {
-        bsp_lcd1602_cprintf("CONFIGURATION", NULL);
-
-        res = cli_menu_start(&config);
-
-        if (res != RES_OK) {
-            bsp_lcd1602_cprintf("MENU ERR %u", NULL, res);
-            internal_error(LED_EVENT_COMMON_ERROR);
-        }
-    }
-
-    if (!config.presettings.enable) {
-        struct sniffer_rs232_config alg_config = config.alg_config;
-        res = sniffer_rs232_init(&alg_config);
-
-        if (res != RES_OK) {
-            bsp_lcd1602_cprintf("ALG INIT ERR %u", NULL, res);
-            internal_error(LED_EVENT_COMMON_ERROR);
-        }
-    }
-
-    struct uart_init_ctx uart_params = {0};
-    bool presettings_enabled = config.presettings.enable;
-
-    /* Algorithm stage */
-    while (!uart_params.baudrate) {
-        if (!config.presettings.enable) {
-            app_led_set(LED_EVENT_IN_PROCESS);
-            cli_trace("Algorithm is in process...\r\n");
-            bsp_lcd1602_cprintf("ALG PROCESS...", NULL);
-
-            res = sniffer_rs232_calc(&uart_params);
-
-            if (res != RES_OK) {
-                bsp_lcd1602_cprintf("ALG ERR %u", NULL, res);
-                cli_trace("Algorithm error %u\r\n", res);
-                internal_error(LED_EVENT_COMMON_ERROR);
-            } else if (uart_params.baudrate) {
-                if (config.save_to_presettings) {
-                    config.presettings.enable = true;
-                    config.presettings.lin_enabled = uart_params.lin_enabled;
-                    config.presettings.baudrate = uart_params.baudrate;
-                    config.presettings.wordlen = uart_params.wordlen;
-                    config.presettings.parity = uart_params.parity;
-                    config.presettings.stopbits = uart_params.stopbits;
-
-                    res = config_save(&config);
-
-                    if (res != RES_OK) {
-                        cli_trace("Failed to save to presettings: %u\r\n", res);
-                        bsp_lcd1602_cprintf("FLASH ERR %u", NULL, res);
-                        internal_error(LED_EVENT_FLASH_ERROR);
-                    }
-                }
-            }
-        } else {
-            uart_params.lin_enabled = config.presettings.lin_enabled;
-            uart_params.baudrate = config.presettings.baudrate;
-            uart_params.wordlen = config.presettings.wordlen;
-            uart_params.parity = config.presettings.parity;
-            uart_params.stopbits = config.presettings.stopbits;
-        }
-
-        if (!uart_params.baudrate) {
-            app_led_set(LED_EVENT_FAILED);
-            cli_trace("Algorithm failed, waiting for button action\r\n");
-            bsp_lcd1602_cprintf("ALG FAILED", NULL);
-
-            while(!button_wait_event(0));
-        }
-    }
-
-    /* Monitoring stage */
-    app_led_set(LED_EVENT_SUCCESS);
-    cli_trace("Start to monitoring...\r\n");
-
-    if (!uart_params.lin_enabled) {
-        bsp_lcd1602_cprintf("%c: %u,%1u%c%1u", NULL, presettings_enabled ? 'P' : 'S', uart_params.baudrate,
-                                                     uart_params.wordlen, uart_parity_sym[uart_params.parity], 
-                                                     uart_params.stopbits);
-    } else {
-        bsp_lcd1602_cprintf("%c: %u,LIN", NULL, presettings_enabled ? 'P' : 'S', uart_params.baudrate);
-    }
-
-    uart_params.rx_size = UART_RX_BUFF;
-    uart_params.overflow_isr_cb = uart_overflow_cb;
-    uart_params.error_isr_cb = uart_error_cb;
-    uart_params.lin_break_isr_cb = uart_lin_break_cb;
-
-    res = bsp_uart_init(BSP_UART_TYPE_RS232_TX, &uart_params);
-
-    if (res != RES_OK) {
-        bsp_lcd1602_cprintf("%s INIT ERR %u", NULL, display_uart_type_str[BSP_UART_TYPE_RS232_TX], res);
-        internal_error(LED_EVENT_COMMON_ERROR);
-    }
-
-    res = bsp_uart_init(BSP_UART_TYPE_RS232_RX, &uart_params);
-
-    if (res != RES_OK) {
-        bsp_lcd1602_cprintf("%s INIT ERR %u", NULL, display_uart_type_str[BSP_UART_TYPE_RS232_RX], res);
-        internal_error(LED_EVENT_COMMON_ERROR);
-    }
-
-    bool error_displayed = false;
-    enum uart_type uart_type = BSP_UART_TYPE_RS232_TX;
-    enum uart_type prev_uart_type = uart_type;
-    uint16_t rx_buff[UART_RX_BUFF] = {0};
-    uint16_t rx_len = 0;
-    bool started = true;
-
-    uint8_t prev_rs232_tx_error = 0;
-    uint8_t prev_rs232_rx_error = 0;
-
-    bsp_lcd1602_cprintf(NULL, "%s", started ? "STARTED" : "STOPPED");
-
-    /* Routine of the monitoring */
-    while (true) {
-        if (button_wait_event(0)) {
-            if (error_displayed) {
-                error_displayed = false;
-                memset(uart_flags, 0, sizeof(uart_flags));
-                app_led_set(LED_EVENT_SUCCESS);
-            } else {
-                started = !started;
-
-                if (!started) {
-                    bsp_uart_stop(BSP_UART_TYPE_RS232_TX);
-                    bsp_uart_stop(BSP_UART_TYPE_RS232_RX);
-                } else {
-                    bsp_uart_start(BSP_UART_TYPE_RS232_TX);
-                    bsp_uart_start(BSP_UART_TYPE_RS232_RX);
-                }
-            }
-
-            bsp_lcd1602_cprintf(NULL, "%s", started ? "STARTED" : "STOPPED");
-        }
-
-        bsp_uart_read(BSP_UART_TYPE_CLI, NULL, NULL, 0);
-
-        if (!started)
-            continue;
-
-        for (enum uart_type type = BSP_UART_TYPE_CLI; type < BSP_UART_TYPE_MAX; type++) {
-            if (!bsp_uart_is_started(type) && bsp_uart_rx_buffer_is_empty(type))
-                bsp_uart_start(type);
-        }
-
-        if (bsp_uart_read(uart_type, rx_buff, &rx_len, 0) == RES_OK) {
-            bool lin_break = uart_flags[uart_type].lin_break ? 1 : 0;
-
-            if (lin_break)
-                uart_flags[uart_type].lin_break = false;
-
-            if (uart_type != prev_uart_type) {
-                if (config.txrx_delimiter == RS232_INTERSPCACE_SPACE)
-                    cli_trace(" ");
-                else if (config.txrx_delimiter == RS232_INTERSPCACE_NEW_LINE)
-                    cli_trace("\r\n");
-
-                prev_uart_type = uart_type;
-            } else {
-                if (config.idle_presence == RS232_INTERSPCACE_SPACE)
-                    cli_trace(" ");
-                else if (config.idle_presence == RS232_INTERSPCACE_NEW_LINE)
-                    cli_trace("\r\n");
-            }
-
-            cli_rs232_trace(uart_type, config.trace_type, &rx_buff[lin_break], rx_len - lin_break, lin_break);
-        }
-
-        bool error_changed = (prev_rs232_tx_error != uart_flags[BSP_UART_TYPE_RS232_TX].error) || 
-                             (prev_rs232_rx_error != uart_flags[BSP_UART_TYPE_RS232_RX].error);
-
-        prev_rs232_tx_error = uart_flags[BSP_UART_TYPE_RS232_TX].error;
-        prev_rs232_rx_error = uart_flags[BSP_UART_TYPE_RS232_RX].error;
-
-        if (!error_displayed || error_changed) {
-            error_displayed = true;
-            char err_tx_str[3] = {0};
-            char err_rx_str[3] = {0};
-
-            if (uart_flags[BSP_UART_TYPE_RS232_TX].overflow)
-                snprintf(err_tx_str, sizeof(err_tx_str), "OF");
-            else if (uart_flags[BSP_UART_TYPE_RS232_TX].error)
-                snprintf(err_tx_str, sizeof(err_tx_str), "%u", uart_flags[BSP_UART_TYPE_RS232_TX].error);
-
-            if (uart_flags[BSP_UART_TYPE_RS232_RX].overflow)
-                snprintf(err_rx_str, sizeof(err_rx_str), "OF");
-            else if (uart_flags[BSP_UART_TYPE_RS232_RX].error)
-                snprintf(err_rx_str, sizeof(err_rx_str), "%u", uart_flags[BSP_UART_TYPE_RS232_RX].error);
-
-            if (IS_UART_ERROR(BSP_UART_TYPE_RS232_TX) && IS_UART_ERROR(BSP_UART_TYPE_RS232_RX)) {
-                bsp_lcd1602_cprintf(NULL, "%s%s ERR %s/%s", display_uart_type_str[BSP_UART_TYPE_RS232_TX],
-                                                            display_uart_type_str[BSP_UART_TYPE_RS232_RX],
-                                                            err_tx_str, err_rx_str);
-            } else if (IS_UART_ERROR(BSP_UART_TYPE_RS232_TX) || IS_UART_ERROR(BSP_UART_TYPE_RS232_RX)) {
-                enum uart_type err_uart_type = IS_UART_ERROR(BSP_UART_TYPE_RS232_TX) ? BSP_UART_TYPE_RS232_TX : BSP_UART_TYPE_RS232_RX;
-
-                bsp_lcd1602_cprintf(NULL, "%s ERR %s", display_uart_type_str[err_uart_type], 
-                                                        (err_uart_type == BSP_UART_TYPE_RS232_TX) ? err_tx_str : err_rx_str);
-            } else {
-                error_displayed = false;
-            }
-
-            if (error_displayed) {
-                if (uart_flags[BSP_UART_TYPE_RS232_TX].overflow || uart_flags[BSP_UART_TYPE_RS232_RX].overflow)
-                    app_led_set(LED_EVENT_UART_OVERFLOW);
-                else
-                    app_led_set(LED_EVENT_UART_ERROR);
-            }
-        }
-
-        uart_type = (uart_type == BSP_UART_TYPE_RS232_TX) ? BSP_UART_TYPE_RS232_RX : BSP_UART_TYPE_RS232_TX;
-    }
-}
-
+/**
+\file
+\author JavaLandau
+\copyright MIT License
+\brief Main project file
+
+The file includes main routine of the firmware: start menu of configuration,  
+algorithm usage, error handlers and etc.
+*/
+
+#include "common.h"
+#include "stm32f4xx_hal.h"
+#include "app_led.h"
+#include "bsp_rcc.h"
+#include "bsp_lcd1602.h"
+#include "bsp_uart.h"
+#include "bsp_crc.h"
+#include "bsp_button.h"
+#include "sniffer_rs232.h"
+#include "config.h"
+#include "cli.h"
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/** 
+ * \defgroup application Application
+ * \brief Application layer of the firmware
+*/
+
+/** 
+ * \defgroup main Main
+ * \brief Firmware main routine
+ * \ingroup application
+ * @{
+*/
+
+/// Firmware version
+#define APP_VERSION             "1.0"
+
+/// Size of RX buffer to store data received from \ref bsp_uart
+#define UART_RX_BUFF            (256)
+
+/// Period of display of progress of the algorithm in ms
+#define ALG_PROGRESS_PERIOD     (250)
+
+/// Window of counting of UART errors on RS-232 line to decide about re-detection in ms
+#define REDETECT_WINDOW         (1000)
+
+/// Count of sequential windows with error spike to start re-detection
+#define REDETECT_SPIKES         (2)
+
+/** Minimum rate of UART errors in percents to received words within a window  
+ * to consider it as error spike, see flash_config::redetect_errors */
+#define REDETECT_ERROR_RATE_PCT (20)
+
+/// Period of measurement of baudrate drift on RS-232 lines in ms, see flash_config::drift_threshold
+#define DRIFT_PERIOD            (1000)
+
+/// Key in CLI to request signal quality of RS-232 lines during monitoring
+#define QUALITY_KEY             ('q')
+
+/// Window of capture of edges for signal quality of RS-232 lines in ms, see \ref QUALITY_KEY
+#define QUALITY_WINDOW          (500)
+
+/// Maximum count of words on each RS-232 line captured during detection and traced before monitoring
+#define REPLAY_SIZE             (512)
+
+/** MACRO Flag whether UART errors occured
+ * 
+ * \param[in] X type of UART, see \ref uart_type
+ * \result true if some errors took place, false otherwise
+*/
+#define IS_UART_ERROR(X)        (uart_flags[X].error || uart_flags[X].overflow)
+
+/// Array of char aliases for \ref uart_parity for output purposes
+static const char uart_parity_sym[] = {'N', 'E', 'O'};
+
+/// Array of string aliases for \ref uart_type for output purposes
+static const char *display_uart_type_str[] = {"CLI", "TX", "RX"};
+
+/// Flag whether press event on the button is occured
+static bool press_event = false;
+
+///UART flags
+static struct {
+    uint32_t error;                     ///< Mask of UART errors
+    bool overflow;                      ///< Flag whether UART RX buffer is overflown before call \ref bsp_uart_read
+    bool lin_break;                     ///< Flag whether LIN break detection is occured
+    uint32_t error_cnt;                 ///< Count of UART errors within the current window of re-detection
+} uart_flags[BSP_UART_TYPE_MAX] = {0};
+
+/// Context of re-detection of UART parameters on RS-232 line during monitoring
+struct redetect_ctx {
+    struct uart_init_ctx params;        ///< Current UART parameters of the line
+    uint32_t window_start;              ///< Start time of the current window of error counting in ms
+    uint32_t words_cnt;                 ///< Count of received words within the current window
+    uint32_t spikes_cnt;                ///< Count of sequential windows with error spike
+    uint32_t blind_start;               ///< Time when the line was stopped for re-detection in ms
+    bool active;                        ///< Flag whether re-detection is in process on the line
+};
+
+/// Contexts of re-detection of RS-232 lines
+static struct redetect_ctx redetect[BSP_UART_TYPE_MAX] = {0};
+
+/// History of baudrate drift on RS-232 line during monitoring
+struct drift_ctx {
+    uint32_t nominal;                   ///< Baudrate at the start of monitoring (or after re-detection)
+    int32_t min_ppm;                    ///< Minimum measured drift relative to \ref nominal in ppm
+    int32_t max_ppm;                    ///< Maximum measured drift relative to \ref nominal in ppm
+    uint32_t retune_cnt;                ///< Count of retunes of UART baudrate
+};
+
+/// History of baudrate drift on RS-232 lines
+static struct drift_ctx drift[BSP_UART_TYPE_MAX] = {0};
+
+/// Time of the previous measurement of baudrate drift in ms
+static uint32_t drift_time = 0;
+
+/// Flag whether signal quality of RS-232 lines is requested, see \ref QUALITY_KEY
+static bool quality_active = false;
+
+/// Time of request of signal quality of RS-232 lines in ms
+static uint32_t quality_time = 0;
+
+/// Timing of data received on RS-232 line during monitoring
+struct timing_ctx {
+    uint32_t last_us;                   ///< Arrival time of the last received word in us
+    uint32_t gap_max_us;                ///< Maximum idle gap between words in us
+    uint32_t latency_last_us;           ///< The last latency of response to the other line in us
+    uint32_t latency_min_us;            ///< Minimum latency of response to the other line in us
+    uint32_t latency_max_us;            ///< Maximum latency of response to the other line in us
+    uint32_t latency_cnt;               ///< Count of responses to the other line
+    bool valid;                         ///< Flag whether \ref last_us is valid
+};
+
+/// Timing of data received on RS-232 lines
+static struct timing_ctx timing[BSP_UART_TYPE_MAX] = {0};
+
+/// Arrival times of words received on RS-232 line in us
+static uint32_t rx_time[UART_RX_BUFF] = {0};
+
+/// Words received on RS-232 line masked by data bits
+static uint16_t rx_words[UART_RX_BUFF] = {0};
+
+/** Callback for UART LIN break detection
+ * 
+ * Callback is called from \ref bsp_uart when LIN break is detected
+ * 
+ * \param[in] type UART type
+ * \param[in] params optional parameters
+ */
+static void uart_lin_break_cb(enum uart_type type, void *params)
+{
+    if (!UART_TYPE_VALID(type))
+        return;
+
+    uart_flags[type].lin_break = true;
+}
+
+/** Callback for UART overflow
+ * 
+ * Callback is called from \ref bsp_uart when overflow of RX buffer is occured
+ * 
+ * \param[in] type UART type
+ * \param[in] params optional parameters
+ */
+static void uart_overflow_cb(enum uart_type type, void *params)
+{
+    if (!UART_TYPE_VALID(type))
+        return;
+
+    uart_flags[type].overflow = true;
+}
+
+/** Callback for UART errors
+ * 
+ * Callback is called from \ref bsp_uart when UART errors are occured
+ * 
+ * \param[in] type UART type
+ * \param[in] error mask of occured UART errors
+ * \param[in] params optional parameters
+ */
+static void uart_error_cb(enum uart_type type, uint32_t error, void *params)
+{
+    if (!UART_TYPE_VALID(type))
+        return;
+
+    uart_flags[type].error |= error;
+    uart_flags[type].error_cnt++;
+}
+
+/** Callback for button actions
+ * 
+ * Callback is called from \ref bsp_button when actions on  
+ * the button are occured. Algorithm of the callback is the following:
+ * 
+ * 1. Action \ref BUTTON_PRESSED occured:  
+ * If menu is started or waiting to be started - skip menu start  
+ * otherwise - start/stop toggle of UART reception from RS-232 channels
+ * 
+ * 2. Action \ref BUTTON_LONG_PRESSED  
+ * Software reset of the chip in any cases
+ * 
+ * \param[in] action BUTTON action, see \ref button_action
+ */
+static void button_cb(enum button_action action)
+{
+    switch(action) {
+    case BUTTON_PRESSED:
+        if (!cli_menu_is_started())
+            press_event = true;
+        else
+            cli_menu_exit();
+        break;
+
+    case BUTTON_LONG_PRESSED:
+        HAL_NVIC_SystemReset();
+
+    default:
+        break;
+    }
+}
+
+/** Wait for press event
+ * 
+ * The function waits when \ref BUTTON_PRESSED occured, using \ref press_event  
+ * \ref press_event is cleared if was set
+ * 
+ * \param[in] tmt timeout in ms for event waiting
+ * \return true if event occured, false otherwise
+ */
+static bool button_wait_event(uint32_t tmt)
+{
+    bool __press_event = false;
+    uint32_t tick_start = HAL_GetTick();
+
+    do {
+        if (press_event) {
+            __press_event = true;
+            press_event = false;
+            break;
+        }
+    } while((HAL_GetTick() - tick_start) < tmt);
+
+    return __press_event;
+}
+
+/** Display of progress of the algorithm
+ * 
+ * The function displays progress of the algorithm in the second line of LCD1602:  
+ * count of captured edges in baudrate part, current hypothesis with counts  
+ * of valid words & UART errors in parameter part. Lines calculated concurrently  
+ * are displayed in turn, the line is prefixed by the first char of its alias
+ */
+static void alg_progress_display(void)
+{
+    static enum uart_type type = BSP_UART_TYPE_RS232_TX;
+    struct sniffer_rs232_progress progress = {0};
+
+    /* The other line first, the same line if the other one is not calculated */
+    for (uint32_t i = 0; i < 2; i++) {
+        type = (type == BSP_UART_TYPE_RS232_TX) ? BSP_UART_TYPE_RS232_RX : BSP_UART_TYPE_RS232_TX;
+
+        if (sniffer_rs232_calc_progress_get(type, &progress) != RES_OK)
+            return;
+
+        if (progress.stage != SNIFFER_RS232_STAGE_IDLE)
+            break;
+    }
+
+    char line = display_uart_type_str[type][0];
+    uint32_t error_cnt = progress.error_parity_cnt + progress.error_frame_cnt;
+
+    switch (progress.stage) {
+    case SNIFFER_RS232_STAGE_BAUDRATE:
+        bsp_lcd1602_cprintf(NULL, "%c#%u EDGES %u", line, progress.attempt, progress.edges_cnt);
+        break;
+
+    case SNIFFER_RS232_STAGE_DECODE:
+        bsp_lcd1602_cprintf(NULL, "%c%u DEC %u", line, progress.baudrate, progress.edges_cnt);
+        break;
+
+    case SNIFFER_RS232_STAGE_RAW_PARAMS:
+    case SNIFFER_RS232_STAGE_PARAMS:
+        bsp_lcd1602_cprintf(NULL, "%c%u,%1u%c %u/%u", line, progress.baudrate, progress.wordlen, uart_parity_sym[progress.parity],
+                                                       progress.valid_cnt, error_cnt);
+        break;
+
+    default:
+        break;
+    }
+}
+
+/** Comparison of UART parameters
+ * 
+ * \param[in] a UART parameters
+ * \param[in] b UART parameters
+ * \return true if baudrate and frame format are equal false otherwise
+ */
+static bool uart_params_equal(const struct uart_init_ctx *a, const struct uart_init_ctx *b)
+{
+    return (a->baudrate == b->baudrate) && (a->lin_enabled == b->lin_enabled) && (a->wordlen == b->wordlen) &&
+           (a->parity == b->parity) && (a->stopbits == b->stopbits);
+}
+
+/** UART parameters from UART presettings
+ * 
+ * \param[out] uart_params UART parameters
+ * \param[in] presettings UART presettings
+ */
+static void uart_params_from_presettings(struct uart_init_ctx *uart_params, const struct uart_presettings *presettings)
+{
+    uart_params->lin_enabled = presettings->lin_enabled;
+    uart_params->baudrate = presettings->baudrate;
+    uart_params->wordlen = presettings->wordlen;
+    uart_params->parity = presettings->parity;
+    uart_params->stopbits = presettings->stopbits;
+}
+
+/** UART presettings from UART parameters
+ * 
+ * \param[out] presettings UART presettings, enabled by the function
+ * \param[in] uart_params UART parameters
+ */
+static void uart_params_to_presettings(struct uart_presettings *presettings, const struct uart_init_ctx *uart_params)
+{
+    presettings->enable = true;
+    presettings->lin_enabled = uart_params->lin_enabled;
+    presettings->baudrate = uart_params->baudrate;
+    presettings->wordlen = uart_params->wordlen;
+    presettings->parity = uart_params->parity;
+    presettings->stopbits = uart_params->stopbits;
+}
+
+/** Frame format of UART parameters as string
+ * 
+ * \param[out] str frame format like "8N1" or "LIN", at least 4 chars
+ * \param[in] uart_params UART parameters
+ */
+static void uart_format_str_get(char *str, const struct uart_init_ctx *uart_params)
+{
+    if (!uart_params->lin_enabled)
+        sprintf(str, "%1u%c%1u", uart_params->wordlen, uart_parity_sym[uart_params->parity], uart_params->stopbits);
+    else
+        strcpy(str, "LIN");
+}
+
+/** Display of UART parameters
+ * 
+ * The function displays UART parameters of RS-232 lines in the first line of LCD1602,  
+ * if parameters of the lines are different only distinguishing part is displayed for each line
+ * 
+ * \param[in] source char alias of the source of the parameters
+ * \param[in] tx_params UART parameters of RS-232 TX line
+ * \param[in] rx_params UART parameters of RS-232 RX line
+ */
+static void uart_params_display(char source, const struct uart_init_ctx *tx_params, const struct uart_init_ctx *rx_params)
+{
+    char tx_format[4] = {0};
+    char rx_format[4] = {0};
+
+    uart_format_str_get(tx_format, tx_params);
+    uart_format_str_get(rx_format, rx_params);
+
+    if (uart_params_equal(tx_params, rx_params))
+        bsp_lcd1602_cprintf("%c: %u,%s", NULL, source, tx_params->baudrate, tx_format);
+    else if (tx_params->baudrate != rx_params->baudrate)
+        bsp_lcd1602_cprintf("%c:%u/%u", NULL, source, tx_params->baudrate, rx_params->baudrate);
+    else
+        bsp_lcd1602_cprintf("%c:%u,%s/%s", NULL, source, tx_params->baudrate, tx_format, rx_format);
+}
+
+/** Check whether re-detection is needed on RS-232 line
+ * 
+ * The function counts UART errors on the line within windows of \ref REDETECT_WINDOW.  
+ * Window has error spike if count of errors is not less than \p errors_threshold and  
+ * rate of errors is not less than \ref REDETECT_ERROR_RATE_PCT
+ * 
+ * \param[in] type RS-232 line
+ * \param[in] errors_threshold count of UART errors per second, see flash_config::redetect_errors
+ * \return true if error spike lasts for \ref REDETECT_SPIKES windows false otherwise
+ */
+static bool redetect_is_needed(enum uart_type type, uint32_t errors_threshold)
+{
+    struct redetect_ctx *ctx = &redetect[type];
+
+    if (!errors_threshold || (HAL_GetTick() - ctx->window_start) < REDETECT_WINDOW)
+        return false;
+
+    uint32_t error_cnt = uart_flags[type].error_cnt;
+    uart_flags[type].error_cnt = 0;
+
+    bool spike = (error_cnt >= errors_threshold) && (100 * error_cnt >= REDETECT_ERROR_RATE_PCT * (error_cnt + ctx->words_cnt));
+
+    ctx->spikes_cnt = spike ? (ctx->spikes_cnt + 1) : 0;
+    ctx->words_cnt = 0;
+    ctx->window_start = HAL_GetTick();
+
+    return ctx->spikes_cnt >= REDETECT_SPIKES;
+}
+
+/** Start of re-detection on RS-232 line
+ * 
+ * The function stops UART instance of the line and starts the algorithm on the line only,  
+ * UART instance of the other line is not touched
+ * 
+ * \param[in] type RS-232 line
+ * \return \ref RES_OK on success error otherwise
+ */
+static uint8_t redetect_start(enum uart_type type)
+{
+    struct redetect_ctx *ctx = &redetect[type];
+
+    cli_trace("\r\n%s: error spike, re-detection of UART parameters...\r\n", display_uart_type_str[type]);
+    bsp_lcd1602_cprintf(NULL, "%s RE-DETECTION", display_uart_type_str[type]);
+
+    ctx->blind_start = HAL_GetTick();
+    ctx->active = true;
+    timing[type].valid = false;
+
+    uint8_t res = bsp_uart_deinit(type);
+
+    if (res != RES_OK)
+        return res;
+
+    /* Error of the start is reported by the next step, see \ref redetect_step */
+    sniffer_rs232_line_calc_start(type);
+
+    return RES_OK;
+}
+
+/** Step of re-detection on RS-232 line
+ * 
+ * The function makes a step of the algorithm started by \ref redetect_start.  
+ * When the algorithm is finished UART instance of the line is reinitialized with  
+ * detected UART parameters (or with previous ones if the algorithm failed)  
+ * and time of the line without monitoring is traced
+ * 
+ * \param[in] type RS-232 line
+ * \param[out] finished flag whether re-detection is finished
+ * \return \ref RES_OK on success error otherwise
+ */
+static uint8_t redetect_step(enum uart_type type, bool *finished)
+{
+    struct redetect_ctx *ctx = &redetect[type];
+    uint8_t res = sniffer_rs232_calc_step(finished);
+
+    if (res == RES_OK && !*finished)
+        return RES_OK;
+
+    struct uart_init_ctx uart_params = {0};
+
+    if (res == RES_OK)
+        res = sniffer_rs232_calc_result_get(type, &uart_params);
+
+    /* Failure of the algorithm is not an error, monitoring is continued with previous parameters */
+    if (res != RES_OK)
+        cli_trace("%s: re-detection error %u\r\n", display_uart_type_str[type], res);
+
+    bool detected = (res == RES_OK) && uart_params.baudrate;
+
+    if (detected) {
+        ctx->params.baudrate = uart_params.baudrate;
+        ctx->params.lin_enabled = uart_params.lin_enabled;
+        ctx->params.wordlen = uart_params.wordlen;
+        ctx->params.parity = uart_params.parity;
+        ctx->params.stopbits = uart_params.stopbits;
+    }
+
+    *finished = true;
+    ctx->active = false;
+    ctx->spikes_cnt = 0;
+    ctx->words_cnt = 0;
+    ctx->window_start = HAL_GetTick();
+    memset(&uart_flags[type], 0, sizeof(uart_flags[type]));
+
+    res = bsp_uart_init(type, &ctx->params);
+
+    if (res != RES_OK)
+        return res;
+
+    cli_trace("%s: %s %u,%u%c%u, blind for %u ms\r\n", display_uart_type_str[type], detected ? "re-detected" : "re-detection failed, kept",
+                                                         ctx->params.baudrate, ctx->params.wordlen, uart_parity_sym[ctx->params.parity],
+                                                         ctx->params.stopbits, HAL_GetTick() - ctx->blind_start);
+
+    if (detected) {
+        uart_params_display('R', &redetect[BSP_UART_TYPE_RS232_TX].params, &redetect[BSP_UART_TYPE_RS232_RX].params);
+        app_led_set(LED_EVENT_SUCCESS);
+
+        drift[type] = (struct drift_ctx){.nominal = ctx->params.baudrate};
+    }
+
+    return RES_OK;
+}
+
+/** Drift in ppm of measured baudrate relative to reference one
+ * 
+ * \param[in] baudrate measured baudrate
+ * \param[in] ref reference baudrate
+ * \return drift in ppm
+ */
+static int32_t drift_ppm_get(uint32_t baudrate, uint32_t ref)
+{
+    return (int32_t)(((int64_t)baudrate - (int64_t)ref) * 1000000 / (int64_t)ref);
+}
+
+/** Tracking of baudrate drift on RS-232 lines
+ * 
+ * The function measures actual baudrate on the lines every \ref DRIFT_PERIOD  
+ * (see \ref sniffer_rs232_drift_get) and updates drift history. If drift relative to  
+ * the current baudrate of UART is not less than \p threshold_ppm, UART is retuned  
+ * to the measured baudrate and drift history is traced
+ * 
+ * \param[in] threshold_ppm drift threshold in ppm, see flash_config::drift_threshold
+ */
+static void drift_track(uint32_t threshold_ppm)
+{
+    if (!threshold_ppm || (HAL_GetTick() - drift_time) < DRIFT_PERIOD)
+        return;
+
+    drift_time = HAL_GetTick();
+
+    for (enum uart_type type = BSP_UART_TYPE_RS232_TX; type < BSP_UART_TYPE_MAX; type++) {
+        struct drift_ctx *ctx = &drift[type];
+        uint32_t baudrate = 0;
+
+        if (redetect[type].active || !ctx->nominal)
+            continue;
+
+        /* Not enough edges within the window is not an error */
+        if (sniffer_rs232_drift_get(type, &baudrate) != RES_OK || !baudrate)
+            continue;
+
+        int32_t drift_ppm = drift_ppm_get(baudrate, ctx->nominal);
+        ctx->min_ppm = (drift_ppm < ctx->min_ppm) ? drift_ppm : ctx->min_ppm;
+        ctx->max_ppm = (drift_ppm > ctx->max_ppm) ? drift_ppm : ctx->max_ppm;
+
+        int32_t tune_ppm = drift_ppm_get(baudrate, redetect[type].params.baudrate);
+
+        if ((uint32_t)abs(tune_ppm) < threshold_ppm)
+            continue;
+
+        uint8_t res = bsp_uart_baudrate_set(type, baudrate);
+
+        if (res != RES_OK) {
+            cli_trace("\r\n%s: drift %+d ppm, retune error %u\r\n", display_uart_type_str[type], drift_ppm, res);
+            continue;
+        }
+
+        redetect[type].params.baudrate = baudrate;
+        ctx->retune_cnt++;
+
+        cli_trace("\r\n%s: drift %+d ppm (min %+d, max %+d) from %u bps, retuned to %u bps (%u times)\r\n", 
+                  display_uart_type_str[type], drift_ppm, ctx->min_ppm, ctx->max_ppm, ctx->nominal, baudrate, ctx->retune_cnt);
+    }
+}
+
+/** Trace of signal quality on RS-232 line
+ * 
+ * \param[in] type UART type, should be \ref BSP_UART_TYPE_RS232_TX or \ref BSP_UART_TYPE_RS232_RX
+ * \param[in] baudrate expected baudrate on the line
+ */
+static void quality_trace(enum uart_type type, uint32_t baudrate)
+{
+    struct sniffer_rs232_quality quality = {0};
+    uint8_t res = sniffer_rs232_quality_get(type, baudrate, &quality);
+
+    if (res != RES_OK) {
+        cli_trace("%s: signal quality error %u\r\n", display_uart_type_str[type], res);
+        return;
+    }
+
+    if (!quality.widths_cnt) {
+        cli_trace("%s: signal quality: not enough edges, glitches %u\r\n", display_uart_type_str[type], quality.glitch_cnt);
+        return;
+    }
+
+    cli_trace("%s: signal quality: baudrate error %d ppm, jitter %u ns, duty distortion %+d ns, glitches %u (%u widths)\r\n",
+              display_uart_type_str[type], quality.baud_error_ppm, quality.jitter_ns, quality.duty_distortion_ns,
+              quality.glitch_cnt, quality.widths_cnt);
+}
+
+/** Trace of usage of UART receive buffer on RS-232 line
+ * 
+ * \param[in] type UART type, should be \ref BSP_UART_TYPE_RS232_TX or \ref BSP_UART_TYPE_RS232_RX
+ */
+static void buffer_trace(enum uart_type type)
+{
+    struct uart_stats stats = {0};
+
+    if (bsp_uart_stats_get(type, &stats) != RES_OK)
+        return;
+
+    cli_trace("%s: receive buffer: high-water %u/%u words, dropped %u words\r\n",
+              display_uart_type_str[type], stats.rx_high_water, UART_RX_BUFF, stats.rx_dropped);
+}
+
+/** Tracking of timing of data received on RS-232 line
+ * 
+ * The function updates idle gaps between words on the line and latency of response:  
+ * time from the end of the last word on the other line to the start of the first word  
+ * on the line when the line speaks after the other one
+ * 
+ * \param[in] type UART type, should be \ref BSP_UART_TYPE_RS232_TX or \ref BSP_UART_TYPE_RS232_RX
+ * \param[in] time_us arrival times of received words in us
+ * \param[in] len count of received words
+ */
+static void timing_track(enum uart_type type, const uint32_t *time_us, uint16_t len)
+{
+    struct timing_ctx *ctx = &timing[type];
+    struct timing_ctx *other = &timing[(type == BSP_UART_TYPE_RS232_TX) ? BSP_UART_TYPE_RS232_RX : BSP_UART_TYPE_RS232_TX];
+    uint32_t char_us = bsp_uart_char_time_get(type) / 1000;
+
+    if (!len)
+        return;
+
+    if (other->valid && (!ctx->valid || (int32_t)(other->last_us - ctx->last_us) > 0)) {
+        int32_t latency = (int32_t)(time_us[0] - char_us - other->last_us);
+        uint32_t latency_us = (latency > 0) ? latency : 0;
+
+        ctx->latency_last_us = latency_us;
+        ctx->latency_min_us = ctx->latency_cnt ? MIN(ctx->latency_min_us, latency_us) : latency_us;
+        ctx->latency_max_us = MAX(ctx->latency_max_us, latency_us);
+        ctx->latency_cnt++;
+    }
+
+    for (uint16_t i = 0; i < len; i++) {
+        if (i || ctx->valid) {
+            int32_t gap = (int32_t)(time_us[i] - char_us - (i ? time_us[i - 1] : ctx->last_us));
+
+            if (gap > 0)
+                ctx->gap_max_us = MAX(ctx->gap_max_us, (uint32_t)gap);
+        }
+    }
+
+    ctx->last_us = time_us[len - 1];
+    ctx->valid = true;
+}
+
+/** Trace of timing of data received on RS-232 line
+ * 
+ * \param[in] type UART type, should be \ref BSP_UART_TYPE_RS232_TX or \ref BSP_UART_TYPE_RS232_RX
+ */
+static void timing_trace(enum uart_type type)
+{
+    struct timing_ctx *ctx = &timing[type];
+
+    if (!ctx->latency_cnt) {
+        cli_trace("%s: timing: max gap %u us, no responses\r\n", display_uart_type_str[type], ctx->gap_max_us);
+        return;
+    }
+
+    cli_trace("%s: timing: max gap %u us, response latency %u us (min %u us, max %u us, %u responses)\r\n",
+              display_uart_type_str[type], ctx->gap_max_us, ctx->latency_last_us,
+              ctx->latency_min_us, ctx->latency_max_us, ctx->latency_cnt);
+}
+
+/** Trace of the best candidate of UART parameters on RS-232 line
+ * 
+ * \param[in] type UART type, should be \ref BSP_UART_TYPE_RS232_TX or \ref BSP_UART_TYPE_RS232_RX
+ * \param[in] found flag whether UART parameters of the line are found by the algorithm
+ */
+static void candidate_trace(enum uart_type type, bool found)
+{
+    struct sniffer_rs232_candidate candidate = {0};
+    uint8_t res = sniffer_rs232_candidate_get(type, &candidate);
+
+    if (res != RES_OK) {
+        cli_trace("%s: candidate error %u\r\n", display_uart_type_str[type], res);
+        return;
+    }
+
+    if (!candidate.baudrate) {
+        if (candidate.timeout)
+            cli_trace("%s: timeout, no candidate of UART parameters\r\n", display_uart_type_str[type]);
+
+        return;
+    }
+
+    const char *status = "best";
+
+    if (candidate.approved)
+        status = "approved";
+    else if (candidate.timeout)
+        status = found ? "accepted on timeout" : "rejected on timeout";
+
+    char format[8] = {0};
+    const struct uart_init_ctx params = {.baudrate = candidate.baudrate, .wordlen = candidate.wordlen,
+                                         .parity = candidate.parity, .stopbits = candidate.stopbits};
+    uart_format_str_get(format, &params);
+
+    cli_trace("%s: %s candidate %u %s, confidence %u%% (valid %u, errors %u)\r\n", display_uart_type_str[type], status,
+              candidate.baudrate, format, candidate.confidence, candidate.valid_cnt, candidate.error_cnt);
+}
+
+/** Trace of traffic captured on RS-232 line during detection
+ * 
+ * \param[in] type UART type, should be \ref BSP_UART_TYPE_RS232_TX or \ref BSP_UART_TYPE_RS232_RX
+ * \param[in] uart_params detected UART parameters of the line
+ * \param[in] trace_type trace type
+ */
+static void replay_trace(enum uart_type type, const struct uart_init_ctx *uart_params, enum rs232_trace_type trace_type)
+{
+    static uint16_t words[REPLAY_SIZE];
+    uint32_t len = REPLAY_SIZE;
+    uint8_t res = sniffer_rs232_replay_get(type, uart_params, words, &len);
+
+    if (res != RES_OK) {
+        cli_trace("%s: replay error %u\r\n", display_uart_type_str[type], res);
+        return;
+    }
+
+    if (!len)
+        return;
+
+    cli_trace("%s: %u words captured during detection:\r\n", display_uart_type_str[type], len);
+
+    /* Trace buffer of CLI is limited, data is traced by chunks */
+    for (uint32_t i = 0; i < len; i += UART_RX_BUFF)
+        cli_rs232_trace(type, trace_type, &words[i], MIN(len - i, UART_RX_BUFF), false);
+
+    cli_trace("\r\n");
+}
+
+/** Routine for internal error
+ * 
+ * The function calls when occured errors on the firmware  
+ * do not let it working further. The function uses politics of LED signaling
+ * \warning The function is firmware dead end and reset is needed to start firmware
+ * 
+ * \param[in] led_event politics of LED signaling
+ */
+static void internal_error(enum led_event led_event)
+{
+    app_led_set(led_event);
+
+    while(1);
+}
+
+/** Main routine of the firmware 
+ * 
+ * \return NOT used
+*/
+int main()
+{
+    /* Basic initialization */
+    HAL_Init();
+
+    if (bsp_rcc_main_config_init() != RES_OK)
+        HAL_NVIC_SystemReset();
+
+    /* BSP LED & CRC initialization */
+    uint8_t res = app_led_init();
+
+    if (res != RES_OK)
+        HAL_NVIC_SystemReset();
+
+    res = bsp_crc_init();
+
+    if (res != RES_OK)
+        internal_error(LED_EVENT_CRC_ERROR);
+
+    /* Read/initialization of the device configuration from internal flash */
+    struct flash_config config;
+
+    if (config_read(&config) != RES_OK) {
+        struct flash_config flash_config_default = FLASH_CONFIG_DEFAULT();
+        config = flash_config_default;
+        res = config_save(&config);
+
+        if (res != RES_OK)
+            internal_error(LED_EVENT_FLASH_ERROR);
+    }
+
+    /* LCD1602 initialization */
+    struct lcd1602_settings settings = {
+        .num_line = LCD1602_NUM_LINE_2,
+        .font_size = LCD1602_FONT_SIZE_5X8,
+        .type_move_cursor = LCD1602_CURSOR_MOVE_RIGHT,
+        .shift_entire_disp = LCD1602_SHIFT_ENTIRE_PERFORMED,
+        .type_interface = LCD1602_INTERFACE_8BITS,
+        .disp_state = LCD1602_DISPLAY_ON,
+        .cursor_state = LCD1602_CURSOR_OFF,
+        .cursor_blink_state = LCD1602_CURSOR_BLINK_OFF
+    };
+
+    res = bsp_lcd1602_init(&settings);
+
+    if (res != RES_OK)
+        internal_error(LED_EVENT_LCD1602_ERROR);
+
+    /* Button initialization */
+    struct button_init_ctx button_init_ctx = {
+        .press_delay_ms = 500,
+        .press_min_dur_ms = 70,
+        .long_press_dur_ms = 1000,
+        .button_isr_cb = button_cb,
+    };
+
+    res = bsp_button_init(&button_init_ctx);
+
+    if (res != RES_OK) {
+        bsp_lcd1602_cprintf("BUTTON ERR %u", NULL, res);
+        internal_error(LED_EVENT_COMMON_ERROR);
+    }
+
+    /* Initialization of CLI */
+    res = cli_init();
+
+    if (res != RES_OK) {
+        bsp_lcd1602_cprintf("CLI ERR %u", NULL, res);
+        internal_error(LED_EVENT_COMMON_ERROR);
+    }
+
+    cli_terminal_reset();
+
+    /* Welcome stage */
+    bsp_lcd1602_cprintf("SNIFFER RS-232", "V.%s", APP_VERSION);
+
+    cli_trace("**********************************************************\r\n");
+    cli_trace("**********************SNIFFER RS-232**********************\r\n");
+    cli_trace("**********************************************************\r\n");
+    cli_trace("Version: %s\r\n", APP_VERSION);
+    cli_trace("Build date: %s %s\r\n", __DATE__, __TIME__);
+
+    bool is_pressed = false;
+    cli_welcome("Press any key to start menu or push button to skip", 5, &press_event, &is_pressed);
+    cli_terminal_reset();
+
+    press_event = false;
+    bsp_lcd1602_display_clear();
+
+    /* Stage of configuration menu */
+    if (is_pressed) {
+        bsp_lcd1602_cprintf("CONFIGURATION", NULL);
+
+        res = cli_menu_start(&config);
+
+        if (res != RES_OK) {
+            bsp_lcd1602_cprintf("MENU ERR %u", NULL, res);
+            internal_error(LED_EVENT_COMMON_ERROR);
+        }
+    }
+
+    /* The algorithm is always initialized, signal quality can be requested during monitoring */
+    struct sniffer_rs232_config alg_config = config.alg_config;
+    res = sniffer_rs232_init(&alg_config);
+
+    if (res != RES_OK) {
+        bsp_lcd1602_cprintf("ALG INIT ERR %u", NULL, res);
+        internal_error(LED_EVENT_COMMON_ERROR);
+    }
+
+    struct uart_init_ctx uart_params[BSP_UART_TYPE_MAX] = {0};
+    bool presettings_enabled = config.presettings.enable;
+    bool calculated = false;
+
+    /* Algorithm stage */
+    while (!uart_params[BSP_UART_TYPE_RS232_TX].baudrate || !uart_params[BSP_UART_TYPE_RS232_RX].baudrate) {
+        bool alg_cancelled = false;
+
+        if (!config.presettings.enable) {
+            /* Lines whose parameters are found in the current pass */
+            bool found[BSP_UART_TYPE_MAX] = {false};
+
+            app_led_set(LED_EVENT_IN_PROCESS);
+
+            /* Verification of recently detected UART parameters */
+            for (uint32_t i = 0; i < CONFIG_HISTORY_SIZE; i++) {
+                if (uart_params[BSP_UART_TYPE_RS232_TX].baudrate && uart_params[BSP_UART_TYPE_RS232_RX].baudrate)
+                    break;
+
+                if (!config.history[i].enable)
+                    continue;
+
+                struct uart_init_ctx history_params = {0};
+                bool verified[BSP_UART_TYPE_MAX] = {false};
+
+                uart_params_from_presettings(&history_params, &config.history[i]);
+                res = sniffer_rs232_verify(&history_params, &verified[BSP_UART_TYPE_RS232_TX], &verified[BSP_UART_TYPE_RS232_RX]);
+
+                if (res != RES_OK) {
+                    bsp_lcd1602_cprintf("ALG ERR %u", NULL, res);
+                    cli_trace("Verification error %u\r\n", res);
+                    internal_error(LED_EVENT_COMMON_ERROR);
+                }
+
+                for (enum uart_type type = BSP_UART_TYPE_RS232_TX; type < BSP_UART_TYPE_MAX; type++) {
+                    if (!verified[type] || uart_params[type].baudrate)
+                        continue;
+
+                    uart_params[type] = history_params;
+                    found[type] = true;
+                    cli_trace("%s: recently detected parameters are verified\r\n", display_uart_type_str[type]);
+                }
+            }
+
+            bool tx_missing = !uart_params[BSP_UART_TYPE_RS232_TX].baudrate;
+            bool rx_missing = !uart_params[BSP_UART_TYPE_RS232_RX].baudrate;
+
+            if (tx_missing || rx_missing) {
+                cli_trace("Algorithm is in process, push button to cancel...\r\n");
+                bsp_lcd1602_cprintf("ALG PROCESS...", NULL);
+
+                bool alg_finished = false;
+                uint32_t progress_time = HAL_GetTick();
+
+                /* Lines are calculated concurrently, verified line is not calculated again */
+                if (tx_missing && rx_missing)
+                    res = sniffer_rs232_calc_start();
+                else
+                    res = sniffer_rs232_line_calc_start(tx_missing ? BSP_UART_TYPE_RS232_TX : BSP_UART_TYPE_RS232_RX);
+
+                calculated = true;
+
+                while (res == RES_OK && !alg_finished) {
+                    res = sniffer_rs232_calc_step(&alg_finished);
+
+                    bsp_uart_read(BSP_UART_TYPE_CLI, NULL, NULL, 0);
+
+                    if (res == RES_OK && !alg_finished && button_wait_event(0)) {
+                        res = sniffer_rs232_calc_cancel();
+                        alg_cancelled = true;
+                        break;
+                    }
+
+                    if ((HAL_GetTick() - progress_time) >= ALG_PROGRESS_PERIOD) {
+                        progress_time = HAL_GetTick();
+                        alg_progress_display();
+                    }
+                }
+
+                for (enum uart_type type = BSP_UART_TYPE_RS232_TX; type < BSP_UART_TYPE_MAX && res == RES_OK && !alg_cancelled; type++) {
+                    if (uart_params[type].baudrate)
+                        continue;
+
+                    res = sniffer_rs232_calc_result_get(type, &uart_params[type]);
+                    found[type] = (res == RES_OK) && uart_params[type].baudrate;
+                }
+
+                if (res != RES_OK) {
+                    bsp_lcd1602_cprintf("ALG ERR %u", NULL, res);
+                    cli_trace("Algorithm error %u\r\n", res);
+                    internal_error(LED_EVENT_COMMON_ERROR);
+                }
+
+                for (enum uart_type type = BSP_UART_TYPE_RS232_TX; type < BSP_UART_TYPE_MAX; type++) {
+                    struct sniffer_rs232_baud_info baud_info = {0};
+
+                    if ((type == BSP_UART_TYPE_RS232_TX ? !tx_missing : !rx_missing) || alg_cancelled ||
+                        sniffer_rs232_baud_info_get(type, &baud_info) != RES_OK)
+                        continue;
+
+                    /* Missing line is reported per channel, the other line is detected anyway */
+                    if (baud_info.line_state == SNIFFER_RS232_LINE_ABSENT)
+                        cli_trace("%s: line is absent (held in lower level)\r\n", display_uart_type_str[type]);
+                    else if (baud_info.line_state == SNIFFER_RS232_LINE_INVERTED)
+                        cli_trace("%s: line has inverted polarity (IDLE in lower level), not supported\r\n", display_uart_type_str[type]);
+
+                    candidate_trace(type, found[type]);
+
+                    if (!found[type])
+                        continue;
+
+                    if (baud_info.meas_baudrate)
+                        cli_trace("%s: measured baudrate %u bps, error %d ppm to %u bps\r\n", display_uart_type_str[type], baud_info.meas_baudrate,
+                                                                                               baud_info.error_ppm, baud_info.nominal_baudrate);
+
+                    quality_trace(type, uart_params[type].baudrate);
+                    replay_trace(type, &uart_params[type], config.trace_type);
+                }
+            }
+
+            bool config_changed = false;
+
+            for (enum uart_type type = BSP_UART_TYPE_RS232_TX; type < BSP_UART_TYPE_MAX; type++) {
+                bool history_changed = false;
+
+                /* The same parameters of both lines are added once */
+                if (!found[type] || (type == BSP_UART_TYPE_RS232_RX && found[BSP_UART_TYPE_RS232_TX] &&
+                                     uart_params_equal(&uart_params[BSP_UART_TYPE_RS232_TX], &uart_params[BSP_UART_TYPE_RS232_RX])))
+                    continue;
+
+                config_history_add(&config, &uart_params[type], &history_changed);
+                config_changed |= history_changed;
+            }
+
+            /* RX line has own presettings only if its parameters differ from TX line ones */
+            if (config.save_to_presettings && uart_params[BSP_UART_TYPE_RS232_TX].baudrate && uart_params[BSP_UART_TYPE_RS232_RX].baudrate) {
+                uart_params_to_presettings(&config.presettings, &uart_params[BSP_UART_TYPE_RS232_TX]);
+                uart_params_to_presettings(&config.rx_presettings, &uart_params[BSP_UART_TYPE_RS232_RX]);
+                config.rx_presettings.enable = !uart_params_equal(&uart_params[BSP_UART_TYPE_RS232_TX], &uart_params[BSP_UART_TYPE_RS232_RX]);
+                config_changed = true;
+            }
+
+            if (config_changed) {
+                res = config_save(&config);
+
+                if (res != RES_OK) {
+                    cli_trace("Failed to save configuration: %u\r\n", res);
+                    bsp_lcd1602_cprintf("FLASH ERR %u", NULL, res);
+                    internal_error(LED_EVENT_FLASH_ERROR);
+                }
+            }
+        } else {
+            uart_params_from_presettings(&uart_params[BSP_UART_TYPE_RS232_TX], &config.presettings);
+            uart_params_from_presettings(&uart_params[BSP_UART_TYPE_RS232_RX],
+                                         config.rx_presettings.enable ? &config.rx_presettings : &config.presettings);
+        }
+
+        if (!uart_params[BSP_UART_TYPE_RS232_TX].baudrate || !uart_params[BSP_UART_TYPE_RS232_RX].baudrate) {
+            app_led_set(LED_EVENT_FAILED);
+            cli_trace("Algorithm %s, waiting for button action\r\n", alg_cancelled ? "cancelled" : "failed");
+            bsp_lcd1602_cprintf(alg_cancelled ? "ALG CANCELLED" : "ALG FAILED", NULL);
+
+            while(!button_wait_event(0));
+        }
+    }
+
+    /* Monitoring stage */
+    app_led_set(LED_EVENT_SUCCESS);
+    cli_trace("Start to monitoring...\r\n");
+
+    uart_params_display(presettings_enabled ? 'P' : (calculated ? 'S' : 'H'), &uart_params[BSP_UART_TYPE_RS232_TX],
+                                                                              &uart_params[BSP_UART_TYPE_RS232_RX]);
+
+    for (enum uart_type type = BSP_UART_TYPE_RS232_TX; type < BSP_UART_TYPE_MAX; type++) {
+        uart_params[type].rx_size = UART_RX_BUFF;
+        uart_params[type].overflow_isr_cb = uart_overflow_cb;
+        uart_params[type].error_isr_cb = uart_error_cb;
+        uart_params[type].lin_break_isr_cb = uart_lin_break_cb;
+
+        res = bsp_uart_init(type, &uart_params[type]);
+
+        if (res != RES_OK) {
+            bsp_lcd1602_cprintf("%s INIT ERR %u", NULL, display_uart_type_str[type], res);
+            internal_error(LED_EVENT_COMMON_ERROR);
+        }
+    }
+
+    bool error_displayed = false;
+    enum uart_type uart_type = BSP_UART_TYPE_RS232_TX;
+    enum uart_type prev_uart_type = uart_type;
+    struct uart_rx_span rx_span = {0};
+    bool started = true;
+
+    uint8_t prev_rs232_tx_error = 0;
+    uint8_t prev_rs232_rx_error = 0;
+
+    bsp_lcd1602_cprintf(NULL, "%s", started ? "STARTED" : "STOPPED");
+
+    for (enum uart_type type = BSP_UART_TYPE_RS232_TX; type < BSP_UART_TYPE_MAX; type++) {
+        redetect[type].params = uart_params[type];
+        redetect[type].window_start = HAL_GetTick();
+        drift[type] = (struct drift_ctx){.nominal = uart_params[type].baudrate};
+    }
+
+    /* Drift tracking failure is not critical, monitoring is continued without it */
+    if (config.drift_threshold) {
+        res = sniffer_rs232_drift_start();
+        drift_time = HAL_GetTick();
+
+        if (res != RES_OK)
+            cli_trace("Drift tracking error %u\r\n", res);
+    }
+
+    /* Routine of the monitoring */
+    while (true) {
+        /* Re-detection of UART parameters in process */
+        for (enum uart_type type = BSP_UART_TYPE_RS232_TX; type < BSP_UART_TYPE_MAX; type++) {
+            bool finished = false;
+
+            if (!redetect[type].active)
+                continue;
+
+            res = redetect_step(type, &finished);
+
+            if (res != RES_OK) {
+                bsp_lcd1602_cprintf("%s INIT ERR %u", NULL, display_uart_type_str[type], res);
+                internal_error(LED_EVENT_COMMON_ERROR);
+            }
+
+            if (!finished)
+                continue;
+
+            bsp_lcd1602_cprintf(NULL, "%s", started ? "STARTED" : "STOPPED");
+
+            /* The algorithm stops drift tracking as they share the same resources */
+            if (config.drift_threshold) {
+                res = sniffer_rs232_drift_start();
+                drift_time = HAL_GetTick();
+
+                if (res != RES_OK)
+                    cli_trace("Drift tracking error %u\r\n", res);
+            }
+        }
+
+        if (button_wait_event(0)) {
+            if (error_displayed) {
+                error_displayed = false;
+                memset(uart_flags, 0, sizeof(uart_flags));
+                app_led_set(LED_EVENT_SUCCESS);
+            } else {
+                started = !started;
+
+                for (enum uart_type type = BSP_UART_TYPE_RS232_TX; type < BSP_UART_TYPE_MAX; type++) {
+                    if (redetect[type].active)
+                        continue;
+
+                    if (!started)
+                        bsp_uart_stop(type);
+                    else
+                        bsp_uart_start(type);
+                }
+            }
+
+            bsp_lcd1602_cprintf(NULL, "%s", started ? "STARTED" : "STOPPED");
+        }
+
+        /* Edges are captured by drift tracking, otherwise the capture is started for the window */
+        if (cli_key_pressed(QUALITY_KEY) && !quality_active) {
+            res = config.drift_threshold ? RES_OK : sniffer_rs232_drift_start();
+
+            if (res == RES_OK) {
+                quality_active = true;
+                quality_time = HAL_GetTick();
+            } else {
+                cli_trace("\r\nSignal quality error %u\r\n", res);
+            }
+        }
+
+        if (quality_active && (HAL_GetTick() - quality_time) >= QUALITY_WINDOW) {
+            quality_active = false;
+            cli_trace("\r\n");
+
+            for (enum uart_type type = BSP_UART_TYPE_RS232_TX; type < BSP_UART_TYPE_MAX; type++) {
+                if (!redetect[type].active) {
+                    quality_trace(type, redetect[type].params.baudrate);
+                    buffer_trace(type);
+                    timing_trace(type);
+                }
+            }
+
+            if (!config.drift_threshold)
+                sniffer_rs232_drift_stop();
+        }
+
+        if (!started)
+            continue;
+
+        for (enum uart_type type = BSP_UART_TYPE_CLI; type < BSP_UART_TYPE_MAX; type++) {
+            if (!redetect[type].active && !bsp_uart_is_started(type) && bsp_uart_rx_buffer_is_empty(type))
+                bsp_uart_start(type);
+        }
+
+        drift_track(config.drift_threshold);
+
+        /* Only one line is re-detected at once */
+        if (!redetect[BSP_UART_TYPE_RS232_TX].active && !redetect[BSP_UART_TYPE_RS232_RX].active &&
+            redetect_is_needed(uart_type, config.redetect_errors)) {
+            res = redetect_start(uart_type);
+
+            if (res != RES_OK) {
+                bsp_lcd1602_cprintf("ALG ERR %u", NULL, res);
+                cli_trace("Re-detection error %u\r\n", res);
+                internal_error(LED_EVENT_COMMON_ERROR);
+            }
+        }
+
+        /* Received data is acquired in place of UART receive buffer and masked by copying routine of the span */
+        if (!redetect[uart_type].active && bsp_uart_read_acquire(uart_type, &rx_span, 0) == RES_OK) {
+            uint16_t rx_len = rx_span.len[0] + rx_span.len[1];
+            redetect[uart_type].words_cnt += rx_len;
+
+            bool lin_break = uart_flags[uart_type].lin_break ? 1 : 0;
+
+            if (lin_break)
+                uart_flags[uart_type].lin_break = false;
+
+            if (uart_type != prev_uart_type) {
+                if (config.txrx_delimiter == RS232_INTERSPCACE_SPACE)
+                    cli_trace(" ");
+                else if (config.txrx_delimiter == RS232_INTERSPCACE_NEW_LINE)
+                    cli_trace("\r\n");
+
+                prev_uart_type = uart_type;
+            } else {
+                if (config.idle_presence == RS232_INTERSPCACE_SPACE)
+                    cli_trace(" ");
+                else if (config.idle_presence == RS232_INTERSPCACE_NEW_LINE)
+                    cli_trace("\r\n");
+            }
+
+            rx_span.copy(rx_words, rx_span.data[0], rx_span.len[0]);
+            rx_span.copy(&rx_words[rx_span.len[0]], rx_span.data[1], rx_span.len[1]);
+
+            bool rx_timed = (bsp_uart_rx_times_get(uart_type, rx_time, rx_len) == RES_OK);
+
+            /* Words overwritten by DMA while they were copied are discarded as overflow */
+            uint16_t rx_lost = 0;
+            bsp_uart_read_release(uart_type, rx_len, &rx_lost);
+
+            if (rx_lost)
+                uart_flags[uart_type].overflow = true;
+
+            /* The first word is received on LIN break, it is traced as symbol of break */
+            uint16_t skip = MAX(rx_lost, lin_break ? 1 : 0);
+
+            if (rx_len > skip)
+                cli_rs232_trace(uart_type, config.trace_type, &rx_words[skip], rx_len - skip, lin_break && !rx_lost);
+
+            if (rx_timed && rx_len > rx_lost)
+                timing_track(uart_type, &rx_time[rx_lost], rx_len - rx_lost);
+        }
+
+        bool error_changed = (prev_rs232_tx_error != uart_flags[BSP_UART_TYPE_RS232_TX].error) || 
+                             (prev_rs232_rx_error != uart_flags[BSP_UART_TYPE_RS232_RX].error);
+
+        prev_rs232_tx_error = uart_flags[BSP_UART_TYPE_RS232_TX].error;
+        prev_rs232_rx_error = uart_flags[BSP_UART_TYPE_RS232_RX].error;
+
+        if (!error_displayed || error_changed) {
+            error_displayed = true;
+            char err_tx_str[3] = {0};
+            char err_rx_str[3] = {0};
+
+            if (uart_flags[BSP_UART_TYPE_RS232_TX].overflow)
+                snprintf(err_tx_str, sizeof(err_tx_str), "OF");
+            else if (uart_flags[BSP_UART_TYPE_RS232_TX].error)
+                snprintf(err_tx_str, sizeof(err_tx_str), "%u", uart_flags[BSP_UART_TYPE_RS232_TX].error);
+
+            if (uart_flags[BSP_UART_TYPE_RS232_RX].overflow)
+                snprintf(err_rx_str, sizeof(err_rx_str), "OF");
+            else if (uart_flags[BSP_UART_TYPE_RS232_RX].error)
+                snprintf(err_rx_str, sizeof(err_rx_str), "%u", uart_flags[BSP_UART_TYPE_RS232_RX].error);
+
+            if (IS_UART_ERROR(BSP_UART_TYPE_RS232_TX) && IS_UART_ERROR(BSP_UART_TYPE_RS232_RX)) {
+                bsp_lcd1602_cprintf(NULL, "%s%s ERR %s/%s", display_uart_type_str[BSP_UART_TYPE_RS232_TX],
+                                                            display_uart_type_str[BSP_UART_TYPE_RS232_RX],
+                                                            err_tx_str, err_rx_str);
+            } else if (IS_UART_ERROR(BSP_UART_TYPE_RS232_TX) || IS_UART_ERROR(BSP_UART_TYPE_RS232_RX)) {
+                enum uart_type err_uart_type = IS_UART_ERROR(BSP_UART_TYPE_RS232_TX) ? BSP_UART_TYPE_RS232_TX : BSP_UART_TYPE_RS232_RX;
+
+                bsp_lcd1602_cprintf(NULL, "%s ERR %s", display_uart_type_str[err_uart_type], 
+                                                        (err_uart_type == BSP_UART_TYPE_RS232_TX) ? err_tx_str : err_rx_str);
+            } else {
+                error_displayed = false;
+            }
+
+            if (error_displayed) {
+                if (uart_flags[BSP_UART_TYPE_RS232_TX].overflow || uart_flags[BSP_UART_TYPE_RS232_RX].overflow)
+                    app_led_set(LED_EVENT_UART_OVERFLOW);
+                else
+                    app_led_set(LED_EVENT_UART_ERROR);
+            }
+        }
+
+        uart_type = (uart_type == BSP_UART_TYPE_RS232_TX) ? BSP_UART_TYPE_RS232_RX : BSP_UART_TYPE_RS232_TX;
+    }
+}
+
 /** @} */
\ No newline at end of file
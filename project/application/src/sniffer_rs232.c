@@ -1,763 +1,3593 @@
-/**
-\file
-\author JavaLandau
-\copyright MIT License
-\brief Algorithm of Sniffer RS-232
-
-The file includes recognizing algorithm of RS-232 parameters
-*/
-
-#include "sniffer_rs232.h"
-#include "bsp_gpio.h"
-#include "bsp_rcc.h"
-#include <stdbool.h>
-#include <string.h>
-
-/** 
- * \defgroup sniffer_rs232 Algorithm of Sniffer RS-232
- * \brief Module of recognizing algorithm of Sniffer RS-232
- * 
- * Algorithm consists of two parts:  
- * 1. Baudrate part - when baudrate calculated in EXTI mode
- * 2. Parameter part - when other UART parameters (word length, parity type) calculated in UART mode  
- * \todo Check the algorithm for 921600 baudrate
- * \ingroup application
- * @{
-*/
-
-/// Size of buffers \ref tx_buffer & \ref rx_buffer
-#define BUFFER_SIZE             (512)
-
-/// Size of receive buffer used in \ref bsp_uart
-#define UART_BUFF_SIZE          (128)
-
-/** Minimal ratio between maximum and minimum widths of lower level  
- * on the RS-232 lines to make decision about LIN break existence */
-#define LIN_BREAK_MIN_LEN       (11)
-
-/** STM32 HAL TIM instance for timer used to count widths of lower level  
- *  on the RS-232 lines */
-static TIM_HandleTypeDef alg_tim = {.Instance = TIM5};
-
-/** STM32 HAL EXTI instance used to detect falling & rising edges  
- * of signals on the RS-232 TX line */
-static EXTI_HandleTypeDef hexti1 = {.Line = EXTI_LINE_3};
-
-/** STM32 HAL EXTI instance used to detect falling & rising edges  
- * of signals on the RS-232 RX line */
-static EXTI_HandleTypeDef hexti2 = {.Line = EXTI_LINE_5};
-
-/// Current filling level of \ref tx_buffer
-static uint32_t tx_cnt = 0;
-
-/// Current filling level of \ref rx_buffer
-static uint32_t rx_cnt = 0;
-
-/** Buffer storing timestamps of falling/rising edges of signal  
- * on the RS-232 TX line */
-static uint32_t tx_buffer[BUFFER_SIZE] = {0};
-
-/** Buffer storing timestamps of falling/rising edges of signal  
- * on the RS-232 RX line */
-static uint32_t rx_buffer[BUFFER_SIZE] = {0};
-
-/** List of baudrates which can be detected by the algorithm */
-static const uint32_t baudrates_list[] = {921600, 460800, 230400, 115200, 57600, 38400, 19200, 9600, 4800, 2400};
-
-/** Context of check of hypothesis */
-struct hyp_check_ctx {
-    uint32_t error_parity_cnt;      ///< Count of UART parity errors, \see BSP_UART_ERROR_PE
-    uint32_t error_frame_cnt;       ///< Count of UART frame errors, \see BSP_UART_ERROR_FE
-    uint32_t valid_cnt;             ///< Count of successfully received bytes over UART
-    bool overflow;                  ///< Flag whether overflow of receive buffer occured
-};
-
-/** Context of baudrate calculation */
-struct baud_calc_ctx {
-    uint32_t    *cnt;               ///< Pointer to \ref tx_cnt or \ref rx_cnt
-    uint32_t    *buffer;            ///< Pointer to \ref tx_buffer or \ref rx_buffer
-    uint32_t    idx;                ///< Current position of \ref buffer for analysis
-    uint32_t    min_len_bit;        ///< Minimum detected width of lower level on RS-232 line, valid over \ref baudrates_list
-    uint32_t    max_len_bit;        ///< Maximum detected width of lower level on RS-232 line
-    uint32_t    baudrate;           ///< Calculated baudrate in bods
-    bool        toggle_bit;         ///< Flag showing current level on RS-232 line: true - upper one, false - lower one
-    bool        lin_detected;       ///< Flag whether LIN break is detected
-    bool        done;               ///< Flag whether baudrate calculation is finished
-};
-
-/** Context of hypothesis */
-struct hyp_ctx {
-    /** Size of UART frame in bits */
-    enum uart_wordlen wordlen;
-    /** Parity type */
-    enum uart_parity parity;
-    /** Next number of hypothesis from \ref hyp_seq if count of  
-     * UART frame errors reach sniffer_rs232_config::uart_error_count */
-    uint8_t jump;
-};
-
-/// Sequence of hypotheses regarding UART parameters of RS-232 channels
-static const struct hyp_ctx hyp_seq[] = {
-    {BSP_UART_WORDLEN_8, BSP_UART_PARITY_EVEN, 3},
-    {BSP_UART_WORDLEN_8, BSP_UART_PARITY_ODD, 3},
-    {BSP_UART_WORDLEN_8, BSP_UART_PARITY_NONE, 3},
-    {BSP_UART_WORDLEN_9, BSP_UART_PARITY_EVEN, 0},
-    {BSP_UART_WORDLEN_9, BSP_UART_PARITY_ODD, 0},
-    {BSP_UART_WORDLEN_9, BSP_UART_PARITY_NONE, 0}
-};
-
-/// Local copy of algorithm settings
-static struct sniffer_rs232_config config;
-
-/** STM32 HAL TIM MSP initialization
- * 
- * \param[in] htim STM32 HAL TIM instance, should equal to \ref alg_tim
- */
-static void __sniffer_rs232_tim_msp_init(TIM_HandleTypeDef* htim)
-{
-    if (htim->Instance != TIM5)
-        return;
-
-    __HAL_RCC_TIM5_CLK_ENABLE();
-}
-
-/** STM32 HAL TIM MSP deinitialization
- * 
- * \param[in] htim STM32 HAL TIM instance, should equal to \ref alg_tim
- */
-static void __sniffer_rs232_tim_msp_deinit(TIM_HandleTypeDef* htim)
-{
-    if (htim->Instance != TIM5)
-        return;
-
-    __HAL_RCC_TIM5_CLK_DISABLE();
-}
-
-/** Baudrate calculation by width of a bit
- * 
- * The function calculates whether width of a bit corresponds one of the  
- * baudrate from \ref baudrates_list
- * 
- * \param[in] len_bit width of a bit
- * \return baudrate value in bods on success, 0 otherwise
- */
-static uint32_t __sniffer_rs232_baudrate_get(uint32_t len_bit)
-{
-    const float tolerance = (float)config.baudrate_tolerance / 100.0f;
-
-    if (!len_bit)
-        return 0;
-
-    float calc_baud = (float)(1000000 * config.baudrate_tolerance) / (float)len_bit;
-
-    uint32_t i = 0;
-    for (; i < ARRAY_SIZE(baudrates_list); i++) {
-        float baud = (float)baudrates_list[i];
-
-        if ((calc_baud >= (1 - tolerance) * baud) && ((calc_baud <= (1 + tolerance) * baud)))
-            break;
-    }
-
-    if (i != ARRAY_SIZE(baudrates_list))
-        return baudrates_list[i];
-
-    return 0;
-}
-
-/** Initialization of baudrate part of the algorithm
- * 
- * The function makes MSP EXTI initialization and waits for IDLE  
- * state on the appropriate RS-232 line
- * 
- * \param[in] gpiox GPIO port of \a pin used as EXTI
- * \param[in] pin GPIO pin used as EXTI
- * \param[in] irq_type NVIC IRQ type
- * \return \ref RES_OK on success error otherwise
- */
-static uint8_t __sniffer_rs232_line_baudrate_calc_init(GPIO_TypeDef* gpiox, uint16_t pin, IRQn_Type irq_type)
-{
-    GPIO_InitTypeDef GPIO_InitStruct = {0};
-
-    GPIO_InitStruct.Pin = pin;
-    GPIO_InitStruct.Mode = GPIO_MODE_IT_RISING_FALLING;
-    GPIO_InitStruct.Pull = GPIO_PULLUP;
-    GPIO_InitStruct.Speed = GPIO_SPEED_FREQ_HIGH;
-    HAL_GPIO_Init(gpiox, &GPIO_InitStruct);
-
-    const uint32_t gpio_wait_tmt = 3000;
-
-    uint8_t res = RES_OK;
-    uint32_t start_time = HAL_GetTick();
-    while(true) {
-        if ((HAL_GetTick() - start_time) > gpio_wait_tmt) {
-            res = RES_TIMEOUT;
-            break;
-        }
-
-        if (BSP_GPIO_PORT_READ(gpiox, pin)) {
-            HAL_NVIC_ClearPendingIRQ(irq_type);
-            HAL_NVIC_EnableIRQ(irq_type);
-            break;
-        }
-    }
-
-    return res;
-}
-
-/** Baudrate calculation on the RS-232 line
- * 
- * The function calculates baudrate on one RS-232 line 
- * 
- * \param[in,out] ctx context of baudrate calculation
- */
-static void __sniffer_rs232_line_baudrate_calc(struct baud_calc_ctx *ctx)
-{
-    if (!ctx)
-        return;
-
-    uint8_t res = RES_OK;
-    const uint32_t uart_idle_tmt = 1000;
-
-    for(; ctx->idx < BUFFER_SIZE; ctx->idx += 2) {
-        uint32_t start_time = HAL_GetTick();
-        while (*ctx->cnt < (ctx->idx + 2)) {
-            if ((HAL_GetTick() - start_time) > uart_idle_tmt) {
-                res = RES_TIMEOUT;
-                break;
-            }
-        }
-
-        if (res != RES_OK)
-            break;
-
-        if (!ctx->toggle_bit) {
-            uint32_t len_bit = (uint32_t)(ctx->buffer[ctx->idx + 1] - ctx->buffer[ctx->idx]);
-            if (len_bit < ctx->min_len_bit) {
-                uint32_t baudrate = __sniffer_rs232_baudrate_get(len_bit);
-                if (baudrate) {
-                    ctx->min_len_bit = len_bit;
-                    ctx->baudrate = baudrate;
-                }
-            } else if (len_bit > ctx->max_len_bit) {
-                ctx->max_len_bit = len_bit;
-
-                if (!ctx->lin_detected)
-                    ctx->lin_detected = (ctx->max_len_bit / ctx->min_len_bit) > LIN_BREAK_MIN_LEN;
-            }
-        }
-
-        ctx->toggle_bit = !ctx->toggle_bit;
-    }
-
-    ctx->done = (ctx->idx >= (4 * config.min_detect_bits));
-}
-
-/** Baudrate part of the algorithm
- * 
- * The function calculates baudrate on RS-232 TX/RX lines according to \a channel_type
- * 
- * \param[in] channel_type RS-232 channel detection type
- * \param[out] baudrate calculated baudrate
- * \param[out] lin_detected flag whether LIN protocol is detected
- * \return \ref RES_OK on success error otherwise
- */
-static uint8_t __sniffer_rs232_baudrate_calc(enum rs232_channel_type channel_type, uint32_t *baudrate, bool *lin_detected)
-{
-    if (!baudrate || !lin_detected || !RS232_CHANNEL_TYPE_VALID(channel_type))
-        return RES_INVALID_PAR;
-
-    const uint32_t uart_max_exec_tmt = 1000 * config.exec_timeout;
-
-    /* Initialization */
-    memset(tx_buffer, 0, sizeof(tx_buffer));
-    memset(rx_buffer, 0, sizeof(rx_buffer));
-    tx_cnt = rx_cnt = 0;
-
-    struct baud_calc_ctx tx_ctx = {.cnt = &tx_cnt, .buffer = tx_buffer, .idx = 0, .min_len_bit = UINT32_MAX,
-                                   .max_len_bit = 0, .baudrate = 0, .toggle_bit = false, .lin_detected = false, .done = false};
-
-    struct baud_calc_ctx rx_ctx = {.cnt = &rx_cnt, .buffer = rx_buffer, .idx = 0, .min_len_bit = UINT32_MAX,
-                                   .max_len_bit = 0, .baudrate = 0, .toggle_bit = false, .lin_detected = false, .done = false};
-
-    uint32_t res = RES_OK;
-
-    if (channel_type != RS232_CHANNEL_RX) {
-        res = __sniffer_rs232_line_baudrate_calc_init(GPIOA, GPIO_PIN_3, EXTI3_IRQn);
-
-        if (res != RES_OK)
-            return res;
-    }
-
-    if (channel_type != RS232_CHANNEL_TX) {
-        res = __sniffer_rs232_line_baudrate_calc_init(GPIOC, GPIO_PIN_5, EXTI9_5_IRQn);
-
-        if (res != RES_OK)
-            return res;
-    }
-
-    bool finish_flag = false;
-    uint32_t calc_baudrate = 0;
-    uint32_t start_exec_time = HAL_GetTick();
-
-    /* Baudrate calculation */
-    while (true) {
-        if ((HAL_GetTick() - start_exec_time) > uart_max_exec_tmt) {
-            res = RES_TIMEOUT;
-            break;
-        }
-
-        if (res != RES_OK)
-            break;
-
-        /* TX line */
-        if (channel_type != RS232_CHANNEL_RX && !tx_ctx.done) {
-            __sniffer_rs232_line_baudrate_calc(&tx_ctx);
-        }
-
-        /* RX line */
-        if (channel_type != RS232_CHANNEL_TX && !rx_ctx.done) {
-            __sniffer_rs232_line_baudrate_calc(&rx_ctx);
-        }
-
-        /* Result processing */
-        struct baud_calc_ctx *ctx = &rx_ctx;
-        switch (channel_type) {
-        case RS232_CHANNEL_TX:
-            ctx = &tx_ctx;
-        case RS232_CHANNEL_RX:
-            if (ctx->done) {
-                calc_baudrate = ctx->baudrate;
-                finish_flag = true;
-            }
-            break;
-
-        case RS232_CHANNEL_ANY:
-            if (tx_ctx.done || rx_ctx.done) {
-                calc_baudrate = tx_ctx.baudrate ? tx_ctx.baudrate : rx_ctx.baudrate;
-                finish_flag = (calc_baudrate != 0) || (tx_ctx.done && rx_ctx.done);
-            }
-            break;
-
-        case RS232_CHANNEL_ALL:
-            if (tx_ctx.done && rx_ctx.done) {
-                if (tx_ctx.baudrate == rx_ctx.baudrate)
-                    calc_baudrate = tx_ctx.baudrate;
-
-                finish_flag = true;
-            }
-            break;
-
-        default:
-            break;
-        }
-
-        if (finish_flag)
-            break;
-    }
-
-    HAL_NVIC_DisableIRQ(EXTI3_IRQn);
-    HAL_NVIC_DisableIRQ(EXTI9_5_IRQn);
-
-    *baudrate = calc_baudrate;
-    *lin_detected = tx_ctx.lin_detected || rx_ctx.lin_detected;
-
-    return res;
-}
-
-/** Callback for UART overflow
- * 
- * Callback is called from \ref bsp_uart when overflow of RX buffer is occured  
- * If call occured the algorithm is terminated with fail
- * 
- * \param[in] type UART type
- * \param[in] params optional parameters, containing check context of the current hypothesis \ref hyp_check_ctx
- */
-static void __sniffer_rs232_uart_overflow_cb(enum uart_type type, void *params)
-{
-    struct hyp_check_ctx *check_ctx = (struct hyp_check_ctx*)params;
-    check_ctx->overflow = true;
-}
-
-/** Callback for UART errors
- * 
- * Callback is called from \ref bsp_uart when UART errors are occured  
- * Callback counts UART errors into check context of the current hypothesis \ref hyp_check_ctx
- * 
- * \param[in] type UART type
- * \param[in] error mask of occured UART errors
- * \param[in] params optional parameters, containing check context of the current hypothesis \ref hyp_check_ctx
- */
-static void __sniffer_rs232_uart_error_cb(enum uart_type type, uint32_t error, void *params)
-{
-    struct hyp_check_ctx *check_ctx = (struct hyp_check_ctx*)params;
-
-    if (error & BSP_UART_ERROR_PE)
-        check_ctx->error_parity_cnt++;
-
-    if (error & BSP_UART_ERROR_FE)
-        check_ctx->error_frame_cnt++;
-
-    bsp_uart_start(type);
-}
-
-/** Parameter part of the algorithm
- * 
- * The function calculates other parameters of UART on RS-232 lines
- * 
- * \param[in] channel_type RS-232 channel detection type
- * \param[in] baudrate baudrate in bods on RS-232 lines
- * \param[out] hyp_num number of approved hypothesis from \ref hyp_seq on success, -1 otherwise
- * \return \ref RES_OK on success error otherwise
- */
-static uint8_t __sniffer_rs232_params_calc(enum rs232_channel_type channel_type, uint32_t baudrate, int8_t *hyp_num)
-{
-    if (!baudrate || !RS232_CHANNEL_TYPE_VALID(channel_type) || !hyp_num)
-        return RES_INVALID_PAR;
-
-    *hyp_num = -1;
-    int8_t __hyp_num = 0;
-    uint8_t res = RES_OK;
-
-    struct hyp_check_ctx tx_check_ctx = {0};
-    struct hyp_check_ctx rx_check_ctx = {0};
-
-    do {
-        /* Initialization */
-        struct uart_init_ctx init_ctx = {0};
-        init_ctx.baudrate = baudrate;
-        init_ctx.wordlen = hyp_seq[__hyp_num].wordlen;
-        init_ctx.parity = hyp_seq[__hyp_num].parity;
-        init_ctx.rx_size = UART_BUFF_SIZE;
-        init_ctx.stopbits = BSP_UART_STOPBITS_1;
-        init_ctx.error_isr_cb = __sniffer_rs232_uart_error_cb;
-        init_ctx.overflow_isr_cb = __sniffer_rs232_uart_overflow_cb;
-
-        if (channel_type != RS232_CHANNEL_RX) {
-            memset(&tx_check_ctx, 0, sizeof(tx_check_ctx));
-            init_ctx.params = &tx_check_ctx;
-
-            res = bsp_uart_init(BSP_UART_TYPE_RS232_TX, &init_ctx);
-
-            if (res != RES_OK)
-                break;
-        }
-
-        if (channel_type != RS232_CHANNEL_TX) {
-            memset(&rx_check_ctx, 0, sizeof(rx_check_ctx));
-            init_ctx.params = &rx_check_ctx;
-
-            res = bsp_uart_init(BSP_UART_TYPE_RS232_RX, &init_ctx);
-
-            if (res != RES_OK)
-                break;
-        }
-
-        bool finish_flag = false;
-        const uint32_t uart_max_exec_tmt = 1000 * config.exec_timeout;
-        uint32_t start_exec_time = HAL_GetTick();
-
-        /* Calculation */
-        while (true) {
-            if ((HAL_GetTick() - start_exec_time) > uart_max_exec_tmt) {
-                res = RES_TIMEOUT;
-                break;
-            }
-
-            uint16_t len = 0;
-            if (channel_type != RS232_CHANNEL_RX && bsp_uart_read(BSP_UART_TYPE_RS232_TX, NULL, &len, 0) == RES_OK)
-                tx_check_ctx.valid_cnt += len;
-
-            if (channel_type != RS232_CHANNEL_TX && bsp_uart_read(BSP_UART_TYPE_RS232_RX, NULL, &len, 0) == RES_OK)
-                rx_check_ctx.valid_cnt += len;
-
-            if (tx_check_ctx.overflow || rx_check_ctx.overflow) {
-                res = RES_OVERFLOW;
-                break;
-            }
-
-            bool error_parity_exceed = (tx_check_ctx.error_parity_cnt >= config.uart_error_count || rx_check_ctx.error_parity_cnt >= config.uart_error_count);
-            bool error_frame_exceed = (tx_check_ctx.error_frame_cnt >= config.uart_error_count || rx_check_ctx.error_frame_cnt >= config.uart_error_count);
-
-            if (error_frame_exceed || error_parity_exceed) {
-                if (error_frame_exceed)
-                    __hyp_num = hyp_seq[__hyp_num].jump;
-                else
-                    __hyp_num = (__hyp_num == (ARRAY_SIZE(hyp_seq) - 1)) ? 0 : (__hyp_num + 1);
-                break;
-            }
-
-            /* Result processing */
-            switch (channel_type) {
-            case RS232_CHANNEL_TX:
-                finish_flag = (tx_check_ctx.valid_cnt >= config.valid_packets_count);
-                break;
-
-            case RS232_CHANNEL_RX:
-                finish_flag = (rx_check_ctx.valid_cnt >= config.valid_packets_count);
-                break;
-
-            case RS232_CHANNEL_ANY:
-                finish_flag = (tx_check_ctx.valid_cnt >= config.valid_packets_count || rx_check_ctx.valid_cnt >= config.valid_packets_count);
-                break;
-
-            case RS232_CHANNEL_ALL:
-                finish_flag = (tx_check_ctx.valid_cnt >= config.valid_packets_count && rx_check_ctx.valid_cnt >= config.valid_packets_count);
-                break;
-
-            default:
-                break;
-            }
-
-            if (finish_flag)
-                break;
-        }
-
-        if (res != RES_OK)
-            break;
-
-        if (channel_type != RS232_CHANNEL_RX) {
-            res = bsp_uart_stop(BSP_UART_TYPE_RS232_TX);
-
-            if (res != RES_OK)
-                break;
-        }
-
-        if (channel_type != RS232_CHANNEL_TX) {
-            res = bsp_uart_stop(BSP_UART_TYPE_RS232_RX);
-
-            if (res != RES_OK)
-                break;
-        }
-
-        if (finish_flag) {
-            *hyp_num = __hyp_num;
-            break;
-        }
-    } while(__hyp_num);
-
-    /* Deinitialization */
-    if (channel_type != RS232_CHANNEL_RX) {
-        res = bsp_uart_deinit(BSP_UART_TYPE_RS232_TX);
-
-        if (res != RES_OK)
-            return res;
-    }
-
-    if (channel_type != RS232_CHANNEL_TX) {
-        res = bsp_uart_deinit(BSP_UART_TYPE_RS232_RX);
-
-        if (res != RES_OK)
-            return res;
-    }
-
-    return res;
-}
-
-/* Valid value range of items from algorithm settings, see header file for details */
-uint32_t sniffer_rs232_config_item_range(uint32_t shift, bool is_min)
-{
-    struct sniffer_rs232_config *__config = 0;
-    if (shift == (uint32_t)&__config->valid_packets_count)
-        return is_min ? 1 : UINT32_MAX;
-    else if (shift == (uint32_t)&__config->uart_error_count)
-        return is_min ? 1 : UINT32_MAX;
-    else if (shift == (uint32_t)&__config->baudrate_tolerance)
-        return is_min ? 1 : 100;
-    else if (shift == (uint32_t)&__config->min_detect_bits)
-        return is_min ? 1 : (BUFFER_SIZE / 4);
-    else if (shift == (uint32_t)&__config->exec_timeout)
-        return is_min ? 1 : UINT32_MAX;
-    else if (shift == (uint32_t)&__config->calc_attempts)
-        return is_min ? 1 : UINT32_MAX;
-
-    return 0;
-}
-
-/* Check algorithm settings, see header file for details */
-bool sniffer_rs232_config_check(struct sniffer_rs232_config *__config)
-{
-    if (!__config)
-        return false;
-
-    if (!RS232_CHANNEL_TYPE_VALID(__config->channel_type))
-        return false;
-
-    if (!SNIFFER_RS232_CFG_PARAM_IS_VALID(valid_packets_count, __config->valid_packets_count))
-        return false;
-
-    if (!SNIFFER_RS232_CFG_PARAM_IS_VALID(uart_error_count, __config->uart_error_count))
-        return false;
-
-    if (!SNIFFER_RS232_CFG_PARAM_IS_VALID(baudrate_tolerance, __config->baudrate_tolerance))
-        return false;
-
-    if (!SNIFFER_RS232_CFG_PARAM_IS_VALID(min_detect_bits, __config->min_detect_bits))
-        return false;
-
-    if (!SNIFFER_RS232_CFG_PARAM_IS_VALID(exec_timeout, __config->exec_timeout))
-        return false;
-
-    if (!SNIFFER_RS232_CFG_PARAM_IS_VALID(calc_attempts, __config->calc_attempts))
-        return false;
-
-    return true;
-}
-
-/* Algorithm initialization, see header file for details */
-uint8_t sniffer_rs232_init(struct sniffer_rs232_config *__config)
-{
-    if (!sniffer_rs232_config_check(__config))
-        return RES_INVALID_PAR;
-
-    config = *__config;
-
-    /* RCC GPIO init */
-    if (__HAL_RCC_GPIOA_IS_CLK_DISABLED())
-        __HAL_RCC_GPIOA_CLK_ENABLE();
-
-    if (__HAL_RCC_GPIOC_IS_CLK_DISABLED())
-        __HAL_RCC_GPIOC_CLK_ENABLE();
-
-    /* EXTI configuration */
-    EXTI_ConfigTypeDef exti_config = {0};
-
-    exti_config.Line            = hexti1.Line;
-    exti_config.Mode            = EXTI_MODE_INTERRUPT;
-    exti_config.Trigger         = EXTI_TRIGGER_RISING_FALLING;
-    exti_config.GPIOSel         = EXTI_GPIOA;
-
-    HAL_EXTI_SetConfigLine(&hexti1, &exti_config);
-    HAL_EXTI_ClearPending(&hexti1, EXTI_TRIGGER_RISING_FALLING);
-
-    exti_config.Line            = hexti2.Line;
-    exti_config.GPIOSel         = EXTI_GPIOC;
-
-    HAL_EXTI_SetConfigLine(&hexti2, &exti_config);
-    HAL_EXTI_ClearPending(&hexti2, EXTI_TRIGGER_RISING_FALLING);
-
-    /* NVIC configuration */
-    HAL_NVIC_ClearPendingIRQ(EXTI3_IRQn);
-    HAL_NVIC_SetPriority(EXTI3_IRQn, 4, 0);
-
-    HAL_NVIC_ClearPendingIRQ(EXTI9_5_IRQn);
-    HAL_NVIC_SetPriority(EXTI9_5_IRQn, 4, 0);
-
-    /* Timer init & start */
-    HAL_TIM_RegisterCallback(&alg_tim, HAL_TIM_BASE_MSPINIT_CB_ID, __sniffer_rs232_tim_msp_init);
-    HAL_TIM_RegisterCallback(&alg_tim, HAL_TIM_BASE_MSPDEINIT_CB_ID, __sniffer_rs232_tim_msp_deinit);
-
-    alg_tim.Init.Prescaler = bsp_rcc_apb_timer_freq_get(alg_tim.Instance) / (1000000 * config.baudrate_tolerance) - 1;
-    alg_tim.Init.Period = UINT32_MAX;
-    alg_tim.Init.CounterMode = TIM_COUNTERMODE_UP;
-    alg_tim.Init.ClockDivision = TIM_CLOCKDIVISION_DIV1;
-    alg_tim.Init.RepetitionCounter = 0;
-    alg_tim.Init.AutoReloadPreload = TIM_AUTORELOAD_PRELOAD_DISABLE;
-    if (HAL_TIM_Base_Init(&alg_tim) != HAL_OK)
-        return RES_NOK;
-
-    if (HAL_TIM_Base_Start(&alg_tim) != HAL_OK)
-        return RES_NOK;
-
-    return RES_OK;
-}
-
-/* Algorithm deinitialization, see header file for details */
-uint8_t sniffer_rs232_deinit(void)
-{
-    if (HAL_TIM_Base_Stop(&alg_tim) != HAL_OK)
-        return RES_NOK;
-
-    if (HAL_TIM_Base_DeInit(&alg_tim) != HAL_OK)
-        return RES_NOK;
-
-    HAL_NVIC_DisableIRQ(EXTI3_IRQn);
-    HAL_NVIC_DisableIRQ(EXTI9_5_IRQn);
-
-    HAL_GPIO_DeInit(GPIOA, GPIO_PIN_3);
-    HAL_GPIO_DeInit(GPIOC, GPIO_PIN_5);
-
-    memset(tx_buffer, 0, sizeof(tx_buffer));
-    memset(rx_buffer, 0, sizeof(rx_buffer));
-    tx_cnt = rx_cnt = 0;
-
-    return RES_OK;
-}
-
-/* Algorithm calculation, see header file for details */
-uint8_t sniffer_rs232_calc(struct uart_init_ctx *uart_params)
-{
-    if (!uart_params)
-        return RES_INVALID_PAR;
-
-    uint8_t res = RES_OK;
-    memset(uart_params, 0, sizeof(struct uart_init_ctx));
-
-    for (uint8_t i = 0; i < config.calc_attempts; i++) {
-        uint32_t baudrate = 0;
-        bool lin_detected = false;
-        res = __sniffer_rs232_baudrate_calc(config.channel_type, &baudrate, &lin_detected);
-
-        if (res != RES_OK)
-            break;
-
-        if (!baudrate)
-            continue;
-
-        if (config.lin_detection && lin_detected) {
-            uart_params->baudrate = baudrate;
-            uart_params->lin_enabled = true;
-            uart_params->wordlen = BSP_UART_WORDLEN_8;
-            uart_params->parity = BSP_UART_PARITY_NONE;
-            uart_params->stopbits = BSP_UART_STOPBITS_1;
-            break;
-        }
-
-        int8_t hyp_num = 0;
-        res = __sniffer_rs232_params_calc(config.channel_type, baudrate, &hyp_num);
-
-        if (res != RES_OK)
-            break;
-
-        if (hyp_num < 0)
-            continue;
-
-        uart_params->baudrate = baudrate;
-        uart_params->wordlen = hyp_seq[hyp_num].wordlen;
-        uart_params->parity = hyp_seq[hyp_num].parity;
-        uart_params->stopbits = BSP_UART_STOPBITS_1;
-
-        break;
-    }
-
-    return res;
-}
-
-/** NVIC IRQ EXTI3 handler
- * 
- * Handler is used to fill in \ref tx_buffer
-*/
-void EXTI3_IRQHandler(void)
-{
-    tx_buffer[tx_cnt++] = alg_tim.Instance->CNT;
-
-    if (tx_cnt == BUFFER_SIZE)
-        HAL_NVIC_DisableIRQ(EXTI3_IRQn);
-
-    __HAL_GPIO_EXTI_CLEAR_IT(GPIO_PIN_3);
-}
-
-/** NVIC IRQ EXTI5 handler
- * 
- * Handler is used to fill in \ref rx_buffer
-*/
-void EXTI9_5_IRQHandler(void)
-{
-    rx_buffer[rx_cnt++] = alg_tim.Instance->CNT;
-
-    if (rx_cnt == BUFFER_SIZE)
-        HAL_NVIC_DisableIRQ(EXTI9_5_IRQn);
-
-    __HAL_GPIO_EXTI_CLEAR_IT(GPIO_PIN_5);
-}
-
+/**
+\file
+\author JavaLandau
+\copyright MIT License
+\brief Algorithm of Sniffer RS-232
+
+The file includes recognizing algorithm of RS-232 parameters
+*/
+
+#include "sniffer_rs232.h"
+#include "bsp_gpio.h"
+#include "bsp_rcc.h"
+#include <stdbool.h>
+#include <string.h>
+#include <math.h>
+
+/** 
+ * \defgroup sniffer_rs232 Algorithm of Sniffer RS-232
+ * \brief Module of recognizing algorithm of Sniffer RS-232
+ * 
+ * Algorithm consists of two parts:  
+ * 1. Baudrate part - when baudrate calculated by timestamps of edges captured either in EXTI mode  
+ * or by timer input capture with DMA (or by statistics of widths accumulated in EXTI mode),  
+ * either by minimum width of lower level or by histogram of widths of both levels
+ * 2. Parameter part - when other UART parameters (word length, parity type) calculated by software decoding  
+ * of frames from captured edges, all hypotheses at once, or in UART mode if decoding is not conclusive  
+ * 
+ * The algorithm is executed either blocking by \ref sniffer_rs232_calc or by steps from the main loop,  
+ * see \ref sniffer_rs232_calc_start & \ref sniffer_rs232_calc_step  
+ * \todo Check the algorithm for 921600 baudrate
+ * \ingroup application
+ * @{
+*/
+
+/// Size of buffers \ref tx_buffer & \ref rx_buffer
+#define BUFFER_SIZE             (512)
+
+/// Size of receive buffer used in \ref bsp_uart
+#define UART_BUFF_SIZE          (128)
+
+/** Minimal ratio between maximum and minimum widths of lower level  
+ * on the RS-232 lines to make decision about LIN break existence */
+#define LIN_BREAK_MIN_LEN       (11)
+
+/// Maximum count of clusters in histogram of widths \ref width_hist
+#define HIST_CLUSTERS_MAX       (16)
+
+/// Minimum count of widths in a cluster of \ref width_hist to take it into account
+#define HIST_CLUSTER_MIN_CNT    (2)
+
+/** Minimum share of widths in a cluster of \ref width_hist to take it into account  
+ * as 1/N of all widths, rare clusters of jittered widths do not fail calculation */
+#define HIST_CLUSTER_MIN_SHARE  (32)
+
+/** Maximum count of sequential bits with the same level within UART frame,  
+ * clusters of \ref width_hist with wider widths (IDLE, LIN break) are skipped */
+#define HIST_RUN_MAX_BITS       (11)
+
+/** Maximum divider of the narrowest cluster of \ref width_hist  
+ * tried as width of a bit (if single bits are absent on RS-232 line) */
+#define HIST_UNIT_DIV_MAX       (3)
+
+/** Maximum error of measured baudrate in ppm to take known baudrate instead of  
+ * measured one if sniffer_rs232_config::arbitrary_baudrate is set */
+#define ARBITRARY_MAX_ERROR_PPM (10000)
+
+/// Count of fractional bits of widths of a bit in \ref baud_window
+#define LEN_FRAC_BITS           (8)
+
+/** Minimum count of averaged bits to report measured baudrate,  
+ * a single width resolves one tick of the timer only */
+#define MEAS_BITS_MIN           (32)
+
+/// Count of fractional bits of log-likelihood ratios in \ref sprt_ctx
+#define LLR_FRAC_BITS           (8)
+
+/** Expected rate of UART errors in percents for failed hypothesis in \ref RS232_HYP_CHECK_SEQUENTIAL,  
+ * every second frame has parity or frame error if word length or parity type is wrong */
+#define SPRT_FAILED_ERROR_PCT   (50)
+
+/// Maximum expected rate of UART errors in percents for valid hypothesis in \ref RS232_HYP_CHECK_SEQUENTIAL
+#define SPRT_VALID_ERROR_PCT_MAX (25)
+
+/** Count of frames decoded from each candidate start bit to align software decoding  
+ * of the hypothesis, see \ref __sniffer_rs232_line_frames_align */
+#define FRAME_ALIGN_FRAMES      (8)
+
+/// Timeout in ms of waiting for new edges by software decoding of UART frames, see \ref __sniffer_rs232_frames_decode_step
+#define FRAMES_DECODE_IDLE_TMT  (1000)
+
+/// Timeout in ms of waiting for upper level on RS-232 line, the line held in lower level longer is absent one
+#define LINE_IDLE_TMT           (3000)
+
+/** Minimum width of a level in minimum widths of lower level to consider the level as IDLE one,  
+ * longer than any run of equal bits in UART frame including LIN break */
+#define LINE_IDLE_BITS          (16)
+
+/// Maximum count of words received over UART on each RS-232 line during check of hypotheses kept for replay
+#define REPLAY_WORDS_MAX        (256)
+
+/** Count of edges captured on each RS-232 line within one window of drift tracking,  
+ * EXTI interrupt of the line is disabled after that until \ref sniffer_rs232_drift_get */
+#define DRIFT_EDGES_CNT         (BUFFER_SIZE)
+
+/// Helper macros to generate \ref parity_lut
+#define PARITY_2(N)             (N), ((N) ^ 1), ((N) ^ 1), (N)
+#define PARITY_4(N)             PARITY_2(N), PARITY_2((N) ^ 1), PARITY_2((N) ^ 1), PARITY_2(N)
+#define PARITY_6(N)             PARITY_4(N), PARITY_4((N) ^ 1), PARITY_4((N) ^ 1), PARITY_4(N)
+
+/** STM32 HAL TIM instance for timer used to count widths of lower level  
+ *  on the RS-232 lines */
+static TIM_HandleTypeDef alg_tim = {.Instance = TIM5};
+
+/** STM32 HAL EXTI instance used to detect falling & rising edges  
+ * of signals on the RS-232 TX line */
+static EXTI_HandleTypeDef hexti1 = {.Line = EXTI_LINE_3};
+
+/** STM32 HAL EXTI instance used to detect falling & rising edges  
+ * of signals on the RS-232 RX line */
+static EXTI_HandleTypeDef hexti2 = {.Line = EXTI_LINE_5};
+
+/** STM32 HAL DMA instance used to store timestamps of edges captured by \ref alg_tim  
+ * on the RS-232 TX line, see \ref RS232_CAPTURE_TIM_DMA */
+static DMA_HandleTypeDef alg_hdma = {.Instance = DMA1_Stream3};
+
+/// Current filling level of \ref tx_buffer
+static uint32_t tx_cnt = 0;
+
+/// Current filling level of \ref rx_buffer
+static uint32_t rx_cnt = 0;
+
+/** Buffer storing timestamps of falling/rising edges of signal  
+ * on the RS-232 TX line */
+static uint32_t tx_buffer[BUFFER_SIZE] = {0};
+
+/** Buffer storing timestamps of falling/rising edges of signal  
+ * on the RS-232 RX line */
+static uint32_t rx_buffer[BUFFER_SIZE] = {0};
+
+/** Flag whether the first edge in \ref tx_buffer is falling one,  
+ * capturing by drift tracking may be started at lower level of the line */
+static bool tx_first_falling = true;
+
+/** Flag whether the first edge in \ref rx_buffer is falling one,  
+ * capturing by drift tracking may be started at lower level of the line */
+static bool rx_first_falling = true;
+
+/** List of baudrates which can be detected by the algorithm */
+static const uint32_t baudrates_list[] = {921600, 460800, 230400, 115200, 57600, 38400, 19200, 9600, 4800, 2400};
+
+/** List of baudrates which are detected in addition to \ref baudrates_list  
+ * if sniffer_rs232_config::high_resolution is set */
+static const uint32_t baudrates_high_list[] = {3000000, 2000000, 1500000};
+
+/** Window of widths of a bit for a known baudrate
+ * 
+ * Widths are in 1/(2^\ref LEN_FRAC_BITS) of ticks of \ref alg_tim
+ */
+struct baud_window {
+    uint32_t    baudrate;           ///< Known baudrate in bods
+    uint32_t    len_nom;            ///< Nominal width of a bit
+    uint32_t    len_min;            ///< Minimum width of a bit within sniffer_rs232_config::baudrate_tolerance
+    uint32_t    len_max;            ///< Maximum width of a bit within sniffer_rs232_config::baudrate_tolerance
+};
+
+/** Windows of widths of a bit for baudrates from \ref baudrates_list, \ref baudrates_high_list and  
+ * sniffer_rs232_config::user_baudrates sorted by width of a bit, filled in by \ref sniffer_rs232_init */
+static struct baud_window baud_windows[ARRAY_SIZE(baudrates_list) + ARRAY_SIZE(baudrates_high_list) + SNIFFER_RS232_USER_BAUDRATES] = {0};
+
+/// Count of used items of \ref baud_windows
+static uint32_t baud_windows_cnt = 0;
+
+/** Widths of a bit for maximum baudrate (see \ref __sniffer_rs232_baudrate_max_get) & \ref SNIFFER_RS232_BAUDRATE_MIN,  
+ * used if sniffer_rs232_config::arbitrary_baudrate is set */
+static uint32_t arbitrary_len_min = 0, arbitrary_len_max = 0;
+
+/// Frequency of \ref alg_tim in Hz
+static uint32_t alg_tim_freq = 0;
+
+/** Context of check of hypothesis */
+struct hyp_check_ctx {
+    uint32_t error_parity_cnt;      ///< Count of UART parity errors, \see BSP_UART_ERROR_PE
+    uint32_t error_frame_cnt;       ///< Count of UART frame errors, \see BSP_UART_ERROR_FE
+    uint32_t valid_cnt;             ///< Count of successfully received bytes over UART
+    int32_t evidence;               ///< Log-likelihood ratio carried over from previous attempts, see \ref hyp_evidence
+    bool overflow;                  ///< Flag whether overflow of receive buffer occured
+};
+
+/** Status of hypothesis regarding UART parameters */
+enum hyp_status {
+    HYP_PENDING = 0,                ///< More frames are needed to make decision
+    HYP_APPROVED,                   ///< Hypothesis is approved
+    HYP_FAILED                      ///< Hypothesis is failed
+};
+
+/** Context of sequential probability ratio test, see \ref RS232_HYP_CHECK_SEQUENTIAL
+ * 
+ * Log-likelihood ratios are in 1/(2^\ref LLR_FRAC_BITS)
+ */
+struct sprt_ctx {
+    int32_t valid;                  ///< Log-likelihood ratio of valid byte
+    int32_t error;                  ///< Log-likelihood ratio of UART error
+    int32_t approve;                ///< Threshold to approve hypothesis
+    int32_t fail;                   ///< Threshold to fail hypothesis
+};
+
+/// Context of sequential probability ratio test, filled in by \ref sniffer_rs232_init
+static struct sprt_ctx sprt = {0};
+
+/** Cluster of histogram of widths */
+struct width_cluster {
+    uint32_t    ref;                ///< Reference width of the cluster (the first included width)
+    uint64_t    sum;                ///< Sum of widths included into the cluster
+    uint32_t    cnt;                ///< Count of widths included into the cluster
+};
+
+/** Histogram of widths of both levels on RS-232 line
+ * 
+ * Widths are binned into clusters with relative size set by sniffer_rs232_config::baudrate_tolerance
+ */
+struct width_hist {
+    struct width_cluster cluster[HIST_CLUSTERS_MAX];    ///< Clusters of the histogram
+    uint32_t    cluster_cnt;                            ///< Count of used clusters
+};
+
+/** Statistics of widths on RS-232 line accumulated in EXTI interrupt, see \ref RS232_CAPTURE_EXTI_STREAM */
+struct width_stats {
+    uint32_t    last;               ///< Timestamp of the previous edge
+    uint32_t    edges_cnt;          ///< Count of captured edges, the first one is falling edge
+    uint32_t    min_low;            ///< Minimum width of lower level not less than \ref stream_min_len
+    uint32_t    max_low;            ///< Maximum width of lower level
+    uint32_t    max_high;           ///< Maximum width of upper level
+    struct width_hist hist;         ///< Histogram of widths of both levels
+};
+
+/// Statistics of widths on the RS-232 TX line
+static struct width_stats tx_stats = {0};
+
+/// Statistics of widths on the RS-232 RX line
+static struct width_stats rx_stats = {0};
+
+/// Flag whether drift tracking is active, see \ref sniffer_rs232_drift_start
+static volatile bool drift_active = false;
+
+/** Glitch filter of edges captured in EXTI interrupt on RS-232 line, see sniffer_rs232_config::glitch_filter */
+struct glitch_filter {
+    uint32_t    pending;            ///< Timestamp of the last edge, stored when the next edge shows that it does not start a glitch
+    bool        pending_valid;      ///< Flag whether \ref pending is valid
+    uint32_t    glitch_cnt;         ///< Count of removed pulses since start of capture
+};
+
+/// Glitch filter of the RS-232 TX line
+static struct glitch_filter tx_glitch = {0};
+
+/// Glitch filter of the RS-232 RX line
+static struct glitch_filter rx_glitch = {0};
+
+/// Minimum width of pulse in ticks of \ref alg_tim, 0 if glitch filter is disabled, see sniffer_rs232_config::glitch_filter
+static uint32_t glitch_min_len = 0;
+
+/** Words received over UART on RS-232 line during check of the current hypothesis,  
+ * kept for replay of traffic, see \ref sniffer_rs232_replay_get */
+struct replay_words {
+    uint16_t    words[REPLAY_WORDS_MAX];    ///< Received words
+    uint32_t    cnt;                        ///< Count of words in \ref words
+    bool        raw;                        ///< Flag whether \ref words are raw 9 bits words, see sniffer_rs232_config::raw_params_check
+};
+
+/// Words received over UART on RS-232 lines during check of hypotheses
+static struct replay_words replay[BSP_UART_TYPE_MAX] = {0};
+
+/** Input filters of \ref alg_tim in \ref RS232_CAPTURE_TIM_DMA mode by TIM_ICFILTER values starting from 1:  
+ * level is latched after \p n consecutive samples at clock of the timer divided by \p div */
+static const struct {
+    uint8_t div;                    ///< Divider of clock of the timer for sampling
+    uint8_t n;                      ///< Count of consecutive samples
+} tim_ic_filters[] = {
+    {1, 2}, {1, 4}, {1, 8}, {2, 6}, {2, 8}, {4, 6}, {4, 8}, {8, 6},
+    {8, 8}, {16, 5}, {16, 6}, {16, 8}, {32, 5}, {32, 6}, {32, 8}
+};
+
+/** Minimum width of lower level taken into width_stats::min_low,  
+ * narrower ones are glitches as they do not match any baudrate */
+static uint32_t stream_min_len = 0;
+
+/** Context of baudrate calculation */
+struct baud_calc_ctx {
+    uint32_t    *cnt;               ///< Pointer to \ref tx_cnt or \ref rx_cnt
+    uint32_t    *buffer;            ///< Pointer to \ref tx_buffer or \ref rx_buffer
+    DMA_HandleTypeDef *hdma;        ///< STM32 HAL DMA instance filling \ref buffer, NULL if \ref buffer is filled in EXTI interrupt
+    struct width_stats *stats;      ///< Pointer to \ref tx_stats or \ref rx_stats, NULL if \ref buffer is used
+    IRQn_Type   irq_type;           ///< NVIC IRQ type of EXTI of the line
+    GPIO_TypeDef *gpiox;            ///< GPIO port of \ref pin
+    uint16_t    pin;                ///< GPIO pin of RS-232 line
+    bool        armed;              ///< Flag whether capture of edges is started, it is started on upper level of the line
+    uint32_t    wait_start;         ///< Start time of waiting for upper level on the line in ms, see \ref LINE_IDLE_TMT
+    enum sniffer_rs232_line_state line_state;   ///< State of the line, \ref SNIFFER_RS232_LINE_UNKNOWN until inversion is excluded
+    uint32_t    level_idx;          ///< Current position of \ref buffer for statistics of levels
+    uint32_t    level_min_low;      ///< Minimum width of lower level not less than \ref stream_min_len
+    uint32_t    level_max_low;      ///< Maximum width of lower level
+    uint32_t    level_max_high;     ///< Maximum width of upper level
+    uint32_t    idx;                ///< Current position of \ref buffer for analysis
+    uint32_t    min_len_bit;        ///< Minimum detected width of lower level on RS-232 line, valid over \ref baudrates_list
+    uint32_t    max_len_bit;        ///< Maximum detected width of lower level on RS-232 line
+    uint32_t    baudrate;           ///< Calculated baudrate in bods
+    uint64_t    meas_len_bits;      ///< Measured width of \ref meas_bits_cnt bits, 0 if not measured
+    uint32_t    meas_bits_cnt;      ///< Count of bits in \ref meas_len_bits
+    bool        toggle_bit;         ///< Flag showing current level on RS-232 line: true - upper one, false - lower one
+    bool        lin_detected;       ///< Flag whether LIN break is detected
+    bool        done;               ///< Flag whether baudrate calculation is finished
+    struct width_hist hist;         ///< Histogram of widths, used for \ref RS232_BAUDRATE_CALC_HISTOGRAM and averaging of the minimum width
+};
+
+/** Context of hypothesis */
+struct hyp_ctx {
+    /** Size of UART frame in bits */
+    enum uart_wordlen wordlen;
+    /** Parity type */
+    enum uart_parity parity;
+    /** Next number of hypothesis from \ref hyp_seq if count of  
+     * UART frame errors reach sniffer_rs232_config::uart_error_count */
+    uint8_t jump;
+};
+
+/// Sequence of hypotheses regarding UART parameters of RS-232 channels
+static const struct hyp_ctx hyp_seq[] = {
+    {BSP_UART_WORDLEN_8, BSP_UART_PARITY_EVEN, 3},
+    {BSP_UART_WORDLEN_8, BSP_UART_PARITY_ODD, 3},
+    {BSP_UART_WORDLEN_8, BSP_UART_PARITY_NONE, 3},
+    {BSP_UART_WORDLEN_9, BSP_UART_PARITY_EVEN, 0},
+    {BSP_UART_WORDLEN_9, BSP_UART_PARITY_ODD, 0},
+    {BSP_UART_WORDLEN_9, BSP_UART_PARITY_NONE, 0}
+};
+
+/// Table of parity of bytes, 1 if count of ones in a byte is odd
+static const uint8_t parity_lut[256] = {PARITY_6(0), PARITY_6(1), PARITY_6(1), PARITY_6(0)};
+
+/** Context of check of hypotheses from \ref hyp_seq over raw words on RS-232 line,  
+ * see sniffer_rs232_config::raw_params_check */
+struct raw_check_ctx {
+    struct hyp_check_ctx uart;                      ///< Check context of UART receiving raw 9 bits words
+    struct hyp_check_ctx hyp[ARRAY_SIZE(hyp_seq)];  ///< Check contexts of hypotheses from \ref hyp_seq
+};
+
+/** Log-likelihood ratios of hypotheses from \ref hyp_seq on RS-232 lines accumulated  
+ * during previous attempts of sniffer_rs232_config::calc_attempts, see \ref RS232_HYP_CHECK_SEQUENTIAL */
+static int32_t hyp_evidence[BSP_UART_TYPE_MAX][ARRAY_SIZE(hyp_seq)] = {0};
+
+/// Baudrates which \ref hyp_evidence is accumulated with on RS-232 lines
+static uint32_t hyp_evidence_baudrate[BSP_UART_TYPE_MAX] = {0};
+
+/** Hypothesis of UART frame format checked by software decoding */
+struct frame_hyp_ctx {
+    enum uart_wordlen wordlen;      ///< Size of UART frame in bits
+    enum uart_parity parity;        ///< Parity type
+    enum uart_stopbits stopbits;    ///< Count of stop bits
+};
+
+/** Sequence of hypotheses regarding UART frame format checked by software decoding
+ * 
+ * Each pair of word length & parity is followed by the same one with 2 stop bits
+ */
+static const struct frame_hyp_ctx frame_hyp_seq[] = {
+    {BSP_UART_WORDLEN_7, BSP_UART_PARITY_NONE, BSP_UART_STOPBITS_1},
+    {BSP_UART_WORDLEN_7, BSP_UART_PARITY_NONE, BSP_UART_STOPBITS_2},
+    {BSP_UART_WORDLEN_8, BSP_UART_PARITY_EVEN, BSP_UART_STOPBITS_1},
+    {BSP_UART_WORDLEN_8, BSP_UART_PARITY_EVEN, BSP_UART_STOPBITS_2},
+    {BSP_UART_WORDLEN_8, BSP_UART_PARITY_ODD, BSP_UART_STOPBITS_1},
+    {BSP_UART_WORDLEN_8, BSP_UART_PARITY_ODD, BSP_UART_STOPBITS_2},
+    {BSP_UART_WORDLEN_8, BSP_UART_PARITY_NONE, BSP_UART_STOPBITS_1},
+    {BSP_UART_WORDLEN_8, BSP_UART_PARITY_NONE, BSP_UART_STOPBITS_2},
+    {BSP_UART_WORDLEN_9, BSP_UART_PARITY_EVEN, BSP_UART_STOPBITS_1},
+    {BSP_UART_WORDLEN_9, BSP_UART_PARITY_EVEN, BSP_UART_STOPBITS_2},
+    {BSP_UART_WORDLEN_9, BSP_UART_PARITY_ODD, BSP_UART_STOPBITS_1},
+    {BSP_UART_WORDLEN_9, BSP_UART_PARITY_ODD, BSP_UART_STOPBITS_2},
+    {BSP_UART_WORDLEN_9, BSP_UART_PARITY_NONE, BSP_UART_STOPBITS_1},
+    {BSP_UART_WORDLEN_9, BSP_UART_PARITY_NONE, BSP_UART_STOPBITS_2}
+};
+
+/** State of software decoding of UART frames by one hypothesis */
+struct frame_hyp_state {
+    uint32_t    start;              ///< Timestamp of falling edge of start bit of the current frame
+    uint32_t    end;                ///< Timestamp of end of the last stop bit of the previous valid frame
+    uint32_t    tight_cnt;          ///< Count of valid frames followed by the next frame without any gap
+    uint32_t    align_idx;          ///< Number of edge of baud_calc_ctx::buffer decoding is started from, see \ref __sniffer_rs232_line_frames_align
+    uint16_t    frame;              ///< Sampled bits of the current frame, LSB is start bit
+    uint16_t    last_frame;         ///< Sampled bits of the last complete frame, LSB is start bit
+    uint8_t     bit_idx;            ///< Number of the next sampled bit of the current frame
+    bool        in_frame;           ///< Flag whether the current frame is being sampled
+    bool        end_valid;          ///< Flag whether \ref end is valid
+    struct hyp_check_ctx check;     ///< Check context of the hypothesis
+};
+
+/** Context of software decoding of UART frames on RS-232 line
+ * 
+ * Captured edges are replayed once, each of them is applied  
+ * to all hypotheses from \ref frame_hyp_seq simultaneously
+ */
+struct frame_decode_ctx {
+    struct frame_hyp_state hyp[ARRAY_SIZE(frame_hyp_seq)];  ///< Decoding states of hypotheses from \ref frame_hyp_seq
+    uint32_t    idx;                ///< Number of the next processed edge of baud_calc_ctx::buffer
+    uint32_t    len_bit;            ///< Width of a bit in 1/256 of timer ticks
+};
+
+/// Local copy of algorithm settings
+static struct sniffer_rs232_config config;
+
+/// Baudrate measurement of the last calculation on the RS-232 lines
+static struct sniffer_rs232_baud_info baud_info[BSP_UART_TYPE_MAX] = {0};
+
+/** Best candidate of UART parameters of the algorithm calculation, see \ref sniffer_rs232_candidate_get */
+struct calc_candidate {
+    uint32_t baudrate;                  ///< Baudrate in bods, 0 if there is no candidate
+    struct frame_hyp_ctx hyp;           ///< Frame format of the candidate
+    int64_t llr;                        ///< Log-likelihood ratio of the candidate summed over RS-232 lines, see \ref sprt_ctx
+    uint32_t valid_cnt;                 ///< Count of valid words supporting the candidate
+    uint32_t error_cnt;                 ///< Count of UART errors against the candidate
+    bool approved;                      ///< Flag whether the candidate is approved by the calculation
+};
+
+/** Context of the algorithm calculation executed by steps, see \ref sniffer_rs232_calc_step */
+struct calc_ctx {
+    enum sniffer_rs232_stage stage;     ///< Current stage of the calculation
+    enum rs232_channel_type channel_type;   ///< RS-232 channel detection type of the calculation
+    enum rs232_channel_type params_channel_type;    ///< RS-232 channel detection type of parameter part, line without  
+                                                    ///< captured IDLE level is excluded from \ref RS232_CHANNEL_ANY
+    uint8_t res;                        ///< Result of the calculation, valid in \ref SNIFFER_RS232_STAGE_DONE
+    uint32_t attempt;                   ///< Number of the current attempt starting from 0
+    uint32_t start_time;                ///< Start time of the current stage (or hypothesis) in ms
+    uint32_t edge_time;                 ///< Time of the last decoded edge in ms in \ref SNIFFER_RS232_STAGE_DECODE
+    uint32_t baudrate;                  ///< Baudrate calculated in the current attempt, 0 if not calculated yet
+    int8_t hyp_num;                     ///< Number of the current hypothesis from \ref hyp_seq, -1 if not defined
+    struct baud_calc_ctx tx_ctx;        ///< Context of baudrate calculation of RS-232 TX line
+    struct baud_calc_ctx rx_ctx;        ///< Context of baudrate calculation of RS-232 RX line
+    struct frame_decode_ctx tx_dec;     ///< Context of software decoding of RS-232 TX line
+    struct frame_decode_ctx rx_dec;     ///< Context of software decoding of RS-232 RX line
+    struct hyp_check_ctx tx_check;      ///< Check context of the current hypothesis on RS-232 TX line in UART mode
+    struct hyp_check_ctx rx_check;      ///< Check context of the current hypothesis on RS-232 RX line in UART mode
+    struct raw_check_ctx tx_raw;        ///< Context of check of hypotheses over raw words on RS-232 TX line
+    struct raw_check_ctx rx_raw;        ///< Context of check of hypotheses over raw words on RS-232 RX line
+    struct uart_init_ctx result;        ///< UART parameters of RS-232 lines, valid in \ref SNIFFER_RS232_STAGE_DONE
+    struct calc_candidate candidate;    ///< Best candidate of UART parameters over all attempts of the calculation
+    bool timeout;                       ///< Flag whether the calculation is finished by sniffer_rs232_config::exec_timeout
+};
+
+/** Contexts of the algorithm calculation by RS-232 lines. Calculation on both lines at once  
+ * (\ref RS232_CHANNEL_ANY) is held by context of RS-232 TX line, in \ref RS232_CHANNEL_ALL  
+ * each line is calculated by its own context independently */
+static struct calc_ctx calcs[BSP_UART_TYPE_MAX] = {0};
+
+/** Flag whether RS-232 line is used by the algorithm calculation
+ * 
+ * \param[in] calc context of the algorithm calculation
+ * \param[in] type RS-232 line
+ * \return true if the line is used false otherwise
+ */
+static inline bool __sniffer_rs232_calc_line_is_used(const struct calc_ctx *calc, enum uart_type type)
+{
+    return (type == BSP_UART_TYPE_RS232_TX) ? (calc->channel_type != RS232_CHANNEL_RX) : (calc->channel_type != RS232_CHANNEL_TX);
+}
+
+/** Context of the algorithm calculation using RS-232 line
+ * 
+ * \param[in] type RS-232 line
+ * \return context of the algorithm calculation
+ */
+static struct calc_ctx *__sniffer_rs232_line_calc_get(enum uart_type type)
+{
+    struct calc_ctx *tx_calc = &calcs[BSP_UART_TYPE_RS232_TX];
+
+    if (type == BSP_UART_TYPE_RS232_RX && tx_calc->stage != SNIFFER_RS232_STAGE_IDLE && tx_calc->channel_type == RS232_CHANNEL_ANY)
+        return tx_calc;
+
+    return &calcs[type];
+}
+
+/** STM32 HAL TIM MSP initialization
+ * 
+ * \param[in] htim STM32 HAL TIM instance, should equal to \ref alg_tim
+ */
+static void __sniffer_rs232_tim_msp_init(TIM_HandleTypeDef* htim)
+{
+    if (htim->Instance != TIM5)
+        return;
+
+    __HAL_RCC_TIM5_CLK_ENABLE();
+}
+
+/** STM32 HAL TIM MSP deinitialization
+ * 
+ * \param[in] htim STM32 HAL TIM instance, should equal to \ref alg_tim
+ */
+static void __sniffer_rs232_tim_msp_deinit(TIM_HandleTypeDef* htim)
+{
+    if (htim->Instance != TIM5)
+        return;
+
+    __HAL_RCC_TIM5_CLK_DISABLE();
+}
+
+/** Width of a bit for baudrate
+ * 
+ * \param[in] baudrate baudrate in bods
+ * \param[in] scale_pct scale of baudrate in percents
+ * \return width of a bit in 1/(2^\ref LEN_FRAC_BITS) of ticks of \ref alg_tim for baudrate scaled by \p scale_pct
+ */
+static uint32_t __sniffer_rs232_len_bit_get(uint32_t baudrate, uint32_t scale_pct)
+{
+    if (!scale_pct)
+        return UINT32_MAX;
+
+    uint64_t len = ((uint64_t)alg_tim_freq * 100 << LEN_FRAC_BITS) / ((uint64_t)baudrate * scale_pct);
+
+    return (len > UINT32_MAX) ? UINT32_MAX : (uint32_t)len;
+}
+
+/** Maximum baudrate which can be detected
+ * 
+ * \return \ref SNIFFER_RS232_BAUDRATE_HIGH_MAX if sniffer_rs232_config::high_resolution is set,  
+ * \ref SNIFFER_RS232_BAUDRATE_MAX otherwise
+ */
+static inline uint32_t __sniffer_rs232_baudrate_max_get(void)
+{
+    return config.high_resolution ? SNIFFER_RS232_BAUDRATE_HIGH_MAX : SNIFFER_RS232_BAUDRATE_MAX;
+}
+
+/** Initialization of windows of widths of a bit
+ * 
+ * The function fills in \ref baud_windows for baudrates from \ref baudrates_list,  
+ * \ref baudrates_high_list (if sniffer_rs232_config::high_resolution is set)  
+ * and sniffer_rs232_config::user_baudrates according to \ref alg_tim_freq
+ */
+static void __sniffer_rs232_baud_windows_init(void)
+{
+    const uint32_t std_cnt = ARRAY_SIZE(baudrates_list);
+    const uint32_t high_cnt = config.high_resolution ? ARRAY_SIZE(baudrates_high_list) : 0;
+
+    baud_windows_cnt = 0;
+
+    for (uint32_t i = 0; i < (std_cnt + high_cnt + SNIFFER_RS232_USER_BAUDRATES); i++) {
+        uint32_t baud = 0;
+
+        if (i < std_cnt)
+            baud = baudrates_list[i];
+        else if (i < std_cnt + high_cnt)
+            baud = baudrates_high_list[i - std_cnt];
+        else
+            baud = config.user_baudrates[i - std_cnt - high_cnt];
+
+        if (!baud)
+            continue;
+
+        struct baud_window window = {
+            .baudrate = baud,
+            .len_nom = __sniffer_rs232_len_bit_get(baud, 100),
+            .len_min = __sniffer_rs232_len_bit_get(baud, 100 + config.baudrate_tolerance),
+            .len_max = __sniffer_rs232_len_bit_get(baud, 100 - config.baudrate_tolerance)
+        };
+
+        /* Insertion keeping sorting by width of a bit */
+        uint32_t j = baud_windows_cnt;
+        for (; j && baud_windows[j - 1].len_nom > window.len_nom; j--)
+            baud_windows[j] = baud_windows[j - 1];
+
+        baud_windows[j] = window;
+        baud_windows_cnt++;
+    }
+
+    arbitrary_len_min = __sniffer_rs232_len_bit_get(__sniffer_rs232_baudrate_max_get(), 100);
+    arbitrary_len_max = __sniffer_rs232_len_bit_get(SNIFFER_RS232_BAUDRATE_MIN, 100);
+}
+
+/** Nearest known baudrate
+ * 
+ * The function finds window of baudrate from \ref baud_windows nearest to \p len  
+ * Relative error of baudrate is minimal for the nearest width of a bit
+ * 
+ * \param[in] len width of a bit in 1/(2^\ref LEN_FRAC_BITS) of ticks of \ref alg_tim
+ * \return window of found baudrate, NULL if there are no known baudrates
+ */
+static const struct baud_window *__sniffer_rs232_baud_window_nearest_get(uint32_t len)
+{
+    if (!baud_windows_cnt)
+        return NULL;
+
+    /* Binary search of the last window narrower than len, windows are sorted.  
+       Halving of fixed count has no data dependent branches to be mispredicted */
+    const struct baud_window *base = baud_windows;
+    uint32_t cnt = baud_windows_cnt;
+
+    while (cnt > 1) {
+        uint32_t half = cnt / 2;
+
+        base = (base[half].len_nom < len) ? &base[half] : base;
+        cnt -= half;
+    }
+
+    uint32_t lo = (uint32_t)(base - baud_windows) + ((base->len_nom < len) ? 1 : 0);
+
+    /* The nearest one is either the found window or the previous narrower one */
+    if (lo && (len - baud_windows[lo - 1].len_nom) <= (baud_windows[lo].len_nom - len))
+        return &baud_windows[lo - 1];
+
+    return &baud_windows[lo];
+}
+
+/** Baudrate calculation by width of bits
+ * 
+ * The function calculates whether width of \p bits_cnt bits corresponds one of the  
+ * baudrate from \ref baudrates_list or sniffer_rs232_config::user_baudrates  
+ * If sniffer_rs232_config::arbitrary_baudrate is set and measured baudrate is far from known ones  
+ * the measured baudrate is returned  
+ * \note Only integer math over \ref baud_windows is used
+ * 
+ * \param[in] len_bits width of \p bits_cnt bits
+ * \param[in] bits_cnt count of bits in \p len_bits
+ * \return baudrate value in bods on success, 0 otherwise
+ */
+static uint32_t __sniffer_rs232_baudrate_get(uint64_t len_bits, uint32_t bits_cnt)
+{
+    if (!len_bits || !bits_cnt)
+        return 0;
+
+    uint64_t __len = (bits_cnt == 1) ? (len_bits << LEN_FRAC_BITS) : ((len_bits << LEN_FRAC_BITS) / bits_cnt);
+
+    if (__len > UINT32_MAX)
+        return 0;
+
+    uint32_t len = (uint32_t)__len;
+    const struct baud_window *window = __sniffer_rs232_baud_window_nearest_get(len);
+
+    if (!config.arbitrary_baudrate)
+        return (window && len >= window->len_min && len <= window->len_max) ? window->baudrate : 0;
+
+    if (window) {
+        uint32_t diff = (len > window->len_nom) ? (len - window->len_nom) : (window->len_nom - len);
+
+        if ((uint64_t)diff * 1000000 <= (uint64_t)len * ARBITRARY_MAX_ERROR_PPM)
+            return window->baudrate;
+    }
+
+    if (len < arbitrary_len_min || len > arbitrary_len_max)
+        return 0;
+
+    return (uint32_t)(((uint64_t)alg_tim_freq * bits_cnt + len_bits / 2) / len_bits);
+}
+
+/** Count of captured edges on RS-232 line
+ * 
+ * \param[in] ctx context of baudrate calculation
+ * \return count of timestamps stored in baud_calc_ctx::buffer
+ */
+static inline uint32_t __sniffer_rs232_edges_cnt_get(struct baud_calc_ctx *ctx)
+{
+    if (!ctx->armed)
+        return 0;
+
+    if (ctx->hdma)
+        return BUFFER_SIZE - __HAL_DMA_GET_COUNTER(ctx->hdma);
+
+    return *ctx->cnt;
+}
+
+/** Initialization of capture of edges on RS-232 line
+ * 
+ * The function makes MSP initialization of the line pin as EXTI or as input capture channel  
+ * of \ref alg_tim in \ref RS232_CAPTURE_TIM_DMA mode, capture itself is started by \ref __sniffer_rs232_line_capture_arm
+ * 
+ * \param[in,out] ctx context of baudrate calculation of the line
+ */
+static void __sniffer_rs232_line_capture_init(struct baud_calc_ctx *ctx)
+{
+    GPIO_InitTypeDef GPIO_InitStruct = {0};
+
+    GPIO_InitStruct.Pin = ctx->pin;
+    GPIO_InitStruct.Pull = GPIO_PULLUP;
+    GPIO_InitStruct.Speed = GPIO_SPEED_FREQ_HIGH;
+
+    if (ctx->hdma) {
+        GPIO_InitStruct.Mode = GPIO_MODE_AF_PP;
+        GPIO_InitStruct.Alternate = GPIO_AF2_TIM5;
+    } else {
+        GPIO_InitStruct.Mode = GPIO_MODE_IT_RISING_FALLING;
+    }
+
+    HAL_GPIO_Init(ctx->gpiox, &GPIO_InitStruct);
+
+    ctx->armed = false;
+    ctx->wait_start = HAL_GetTick();
+    ctx->line_state = SNIFFER_RS232_LINE_UNKNOWN;
+}
+
+/** Start of capture of edges on RS-232 line
+ * 
+ * EXTI interrupt of the line is enabled or DMA storing timestamps of edges into \ref tx_buffer  
+ * is started in \ref RS232_CAPTURE_TIM_DMA mode
+ * 
+ * \param[in,out] ctx context of baudrate calculation of the line
+ * \return \ref RES_OK on success error otherwise
+ */
+static uint8_t __sniffer_rs232_line_capture_arm(struct baud_calc_ctx *ctx)
+{
+    if (ctx->hdma) {
+        if (HAL_TIM_IC_Start_DMA(&alg_tim, TIM_CHANNEL_4, ctx->buffer, BUFFER_SIZE) != HAL_OK)
+            return RES_NOK;
+    } else {
+        HAL_NVIC_ClearPendingIRQ(ctx->irq_type);
+        HAL_NVIC_EnableIRQ(ctx->irq_type);
+    }
+
+    ctx->armed = true;
+
+    return RES_OK;
+}
+
+/** Update of statistics of levels on RS-232 line
+ * 
+ * \param[in,out] ctx context of baudrate calculation of the line
+ */
+static void __sniffer_rs232_line_levels_update(struct baud_calc_ctx *ctx)
+{
+    if (ctx->stats) {
+        HAL_NVIC_DisableIRQ(ctx->irq_type);
+        ctx->level_min_low = ctx->stats->min_low;
+        ctx->level_max_low = ctx->stats->max_low;
+        ctx->level_max_high = ctx->stats->max_high;
+        HAL_NVIC_EnableIRQ(ctx->irq_type);
+        return;
+    }
+
+    uint32_t cnt = __sniffer_rs232_edges_cnt_get(ctx);
+
+    for (uint32_t i = MAX(ctx->level_idx, 1); i < cnt; i++) {
+        uint32_t len = ctx->buffer[i] - ctx->buffer[i - 1];
+
+        /* Capture is started on upper level, so even edges are falling ones */
+        if ((i - 1) & 1) {
+            ctx->level_max_high = MAX(ctx->level_max_high, len);
+        } else {
+            ctx->level_max_low = MAX(ctx->level_max_low, len);
+
+            if (len >= stream_min_len)
+                ctx->level_min_low = MIN(ctx->level_min_low, len);
+        }
+    }
+
+    ctx->level_idx = MAX(ctx->level_idx, cnt);
+}
+
+/** Detection of state of RS-232 line
+ * 
+ * The function is called on each step of baudrate part of the algorithm and does not wait for the line.  
+ * Capture is started as soon as the line is in upper level, the line held in lower level longer than  
+ * \ref LINE_IDLE_TMT is absent one. The line is inverted one if widths of lower level reach \ref LINE_IDLE_BITS  
+ * bits and widths of upper one do not, i.e. IDLE level is lower one.  
+ * Calculation on absent or inverted line is finished without baudrate
+ * 
+ * \param[in,out] ctx context of baudrate calculation of the line
+ * \return \ref RES_OK on success error otherwise
+ */
+static uint8_t __sniffer_rs232_line_state_step(struct baud_calc_ctx *ctx)
+{
+    if (!ctx->armed) {
+        if (BSP_GPIO_PORT_READ(ctx->gpiox, ctx->pin))
+            return __sniffer_rs232_line_capture_arm(ctx);
+
+        if ((HAL_GetTick() - ctx->wait_start) > LINE_IDLE_TMT) {
+            ctx->line_state = SNIFFER_RS232_LINE_ABSENT;
+            ctx->done = true;
+        }
+
+        return RES_OK;
+    }
+
+    if (ctx->line_state != SNIFFER_RS232_LINE_UNKNOWN)
+        return RES_OK;
+
+    __sniffer_rs232_line_levels_update(ctx);
+
+    if (ctx->level_min_low == UINT32_MAX)
+        return RES_OK;
+
+    uint64_t idle_len = (uint64_t)ctx->level_min_low * LINE_IDLE_BITS;
+
+    if (ctx->level_max_high >= idle_len) {
+        ctx->line_state = SNIFFER_RS232_LINE_NORMAL;
+    } else if (ctx->level_max_low >= idle_len) {
+        ctx->line_state = SNIFFER_RS232_LINE_INVERTED;
+        ctx->baudrate = 0;
+        ctx->meas_len_bits = 0;
+        ctx->done = true;
+
+        if (!ctx->hdma)
+            HAL_NVIC_DisableIRQ(ctx->irq_type);
+    }
+
+    return RES_OK;
+}
+
+/** Stop of capture of edges on RS-232 lines
+ * 
+ * \param[in] channel_type RS-232 channel detection type
+ * \param[in] tx_ctx context of baudrate calculation of RS-232 TX line
+ */
+static void __sniffer_rs232_capture_stop(enum rs232_channel_type channel_type, struct baud_calc_ctx *tx_ctx)
+{
+    if (channel_type != RS232_CHANNEL_RX)
+        HAL_NVIC_DisableIRQ(EXTI3_IRQn);
+
+    if (channel_type != RS232_CHANNEL_TX)
+        HAL_NVIC_DisableIRQ(EXTI9_5_IRQn);
+
+    if (channel_type != RS232_CHANNEL_RX && tx_ctx->hdma && tx_ctx->armed) {
+        /* Count of edges stored by DMA is kept for \ref sniffer_rs232_quality_get */
+        tx_cnt = __sniffer_rs232_edges_cnt_get(tx_ctx);
+        HAL_TIM_IC_Stop_DMA(&alg_tim, TIM_CHANNEL_4);
+
+        /* Counter is stopped by HAL if no channels are enabled,  
+         * but \ref alg_tim is free-running timebase for EXTI capture as well */
+        __HAL_TIM_ENABLE(&alg_tim);
+    }
+}
+
+/** Find cluster of histogram for width
+ * 
+ * \param[in] hist histogram of widths
+ * \param[in] len width of a level on RS-232 line
+ * \return index of the cluster whose reference width differs from \p len not more than  
+ * sniffer_rs232_config::baudrate_tolerance, width_hist::cluster_cnt if there is no such cluster
+ */
+static uint32_t __sniffer_rs232_hist_cluster_find(const struct width_hist *hist, uint32_t len)
+{
+    uint32_t i = 0;
+    for (; i < hist->cluster_cnt; i++) {
+        uint32_t ref = hist->cluster[i].ref;
+        uint32_t diff = (len > ref) ? (len - ref) : (ref - len);
+
+        /* One tick is added as resolution of the timer */
+        if ((uint64_t)diff * 100 <= (uint64_t)ref * config.baudrate_tolerance + 100)
+            break;
+    }
+
+    return i;
+}
+
+/** Averaging of the minimum width by histogram
+ * 
+ * The function measures width of a bit as average of all widths of \p hist cluster  
+ * including the minimum width \p min_len instead of the single minimum width
+ * 
+ * \param[in] hist histogram of widths
+ * \param[in] min_len the minimum width of a level on RS-232 line
+ * \param[out] len_bits summarized width of averaged widths
+ * \param[out] bits_cnt count of bits in \p len_bits
+ * \return baudrate by averaged width on success, 0 otherwise
+ */
+static uint32_t __sniffer_rs232_min_len_average(const struct width_hist *hist, uint32_t min_len, uint64_t *len_bits, uint32_t *bits_cnt)
+{
+    uint32_t i = __sniffer_rs232_hist_cluster_find(hist, min_len);
+
+    if (i == hist->cluster_cnt)
+        return 0;
+
+    uint32_t baudrate = __sniffer_rs232_baudrate_get(hist->cluster[i].sum, hist->cluster[i].cnt);
+
+    if (baudrate) {
+        *len_bits = hist->cluster[i].sum;
+        *bits_cnt = hist->cluster[i].cnt;
+    }
+
+    return baudrate;
+}
+
+/** Add width into histogram
+ * 
+ * The function adds \p len into the cluster of \p hist whose reference width differs  
+ * from \p len not more than sniffer_rs232_config::baudrate_tolerance, otherwise new cluster is created  
+ * \note The function is called from EXTI interrupt in \ref RS232_CAPTURE_EXTI_STREAM mode, so it avoids divisions
+ * 
+ * \param[in,out] hist histogram of widths
+ * \param[in] len width of a level on RS-232 line
+ */
+static void __sniffer_rs232_hist_add(struct width_hist *hist, uint32_t len)
+{
+    if (!hist || !len)
+        return;
+
+    uint32_t i = __sniffer_rs232_hist_cluster_find(hist, len);
+
+    /* If histogram is full the first rare cluster is replaced (usually IDLE widths) */
+    if (i == hist->cluster_cnt) {
+        if (hist->cluster_cnt == HIST_CLUSTERS_MAX) {
+            for (i = 0; i < hist->cluster_cnt; i++) {
+                if (hist->cluster[i].cnt < HIST_CLUSTER_MIN_CNT)
+                    break;
+            }
+
+            if (i == hist->cluster_cnt)
+                return;
+
+            hist->cluster[i].sum = 0;
+            hist->cluster[i].cnt = 0;
+        } else {
+            hist->cluster_cnt++;
+        }
+
+        hist->cluster[i].ref = len;
+    }
+
+    hist->cluster[i].sum += len;
+    hist->cluster[i].cnt++;
+}
+
+/** Baudrate calculation on the RS-232 line
+ * 
+ * The function calculates baudrate on one RS-232 line 
+ * 
+ * \param[in,out] ctx context of baudrate calculation
+ */
+static void __sniffer_rs232_line_baudrate_calc(struct baud_calc_ctx *ctx)
+{
+    if (!ctx)
+        return;
+
+    /* Edges not captured yet are analysed on the next step, the other line is not waited for */
+    uint32_t cnt = __sniffer_rs232_edges_cnt_get(ctx);
+
+    for(; ctx->idx < BUFFER_SIZE; ctx->idx += 2) {
+        if (cnt < (ctx->idx + 2))
+            break;
+
+        if (!ctx->toggle_bit) {
+            uint32_t len_bit = (uint32_t)(ctx->buffer[ctx->idx + 1] - ctx->buffer[ctx->idx]);
+            __sniffer_rs232_hist_add(&ctx->hist, len_bit);
+
+            if (len_bit < ctx->min_len_bit) {
+                uint32_t baudrate = __sniffer_rs232_baudrate_get(len_bit, 1);
+                if (baudrate) {
+                    ctx->min_len_bit = len_bit;
+                    ctx->baudrate = baudrate;
+                    ctx->meas_len_bits = len_bit;
+                    ctx->meas_bits_cnt = 1;
+                }
+            } else if (len_bit > ctx->max_len_bit) {
+                ctx->max_len_bit = len_bit;
+
+                if (!ctx->lin_detected)
+                    ctx->lin_detected = (ctx->max_len_bit / ctx->min_len_bit) > LIN_BREAK_MIN_LEN;
+            }
+        }
+
+        ctx->toggle_bit = !ctx->toggle_bit;
+    }
+
+    /* Single minimum width is replaced by average of all lower levels of the same width */
+    if (ctx->meas_bits_cnt) {
+        uint32_t baudrate = __sniffer_rs232_min_len_average(&ctx->hist, ctx->min_len_bit, &ctx->meas_len_bits, &ctx->meas_bits_cnt);
+
+        if (baudrate)
+            ctx->baudrate = baudrate;
+    }
+
+    ctx->done = ((uint64_t)ctx->idx >= (4 * (uint64_t)config.min_detect_bits)) || (ctx->idx >= BUFFER_SIZE);
+}
+
+/** Calculation of width of a bit by histogram
+ * 
+ * The function finds width of a bit as the largest common divider of clusters of \p hist:  
+ * the narrowest cluster (divided by 1..\ref HIST_UNIT_DIV_MAX) is tried as width of a bit,  
+ * it is accepted if all other clusters are multiple of it. Widths of all matched clusters are  
+ * summarized to get average width of a bit with accuracy better than resolution of the timer
+ * 
+ * \param[in] hist histogram of widths
+ * \param[out] len_bits summarized width of all matched widths
+ * \param[out] bits_cnt count of bits in \p len_bits, 0 if width of a bit is not found
+ */
+static void __sniffer_rs232_hist_calc(struct width_hist *hist, uint64_t *len_bits, uint32_t *bits_cnt)
+{
+    *len_bits = 0;
+    *bits_cnt = 0;
+
+    /* Average widths in 1/(2^LEN_FRAC_BITS) of ticks */
+    uint64_t avg[HIST_CLUSTERS_MAX] = {0};
+
+    uint32_t total_cnt = 0;
+    for (uint32_t i = 0; i < hist->cluster_cnt; i++)
+        total_cnt += hist->cluster[i].cnt;
+
+    /* The narrowest cluster */
+    uint64_t min_avg = 0;
+    for (uint32_t i = 0; i < hist->cluster_cnt; i++) {
+        if (hist->cluster[i].cnt < HIST_CLUSTER_MIN_CNT || (hist->cluster[i].cnt * HIST_CLUSTER_MIN_SHARE) < total_cnt)
+            continue;
+
+        avg[i] = (hist->cluster[i].sum << LEN_FRAC_BITS) / hist->cluster[i].cnt;
+        if (!min_avg || avg[i] < min_avg)
+            min_avg = avg[i];
+    }
+
+    if (!min_avg)
+        return;
+
+    for (uint32_t div = 1; div <= HIST_UNIT_DIV_MAX; div++) {
+        uint64_t len_bit = min_avg / div;
+        uint64_t __len_bits = 0;
+        uint32_t __bits_cnt = 0;
+        bool matched = true;
+
+        for (uint32_t i = 0; i < hist->cluster_cnt; i++) {
+            if (!avg[i])
+                continue;
+
+            uint64_t bits = (avg[i] + len_bit / 2) / len_bit;
+
+            if (bits > HIST_RUN_MAX_BITS)
+                continue;
+
+            /* One tick is added as resolution of the timer */
+            uint64_t len = bits * len_bit;
+            uint64_t diff = (avg[i] > len) ? (avg[i] - len) : (len - avg[i]);
+            uint64_t max_diff = (len * config.baudrate_tolerance) / 100 + (1 << LEN_FRAC_BITS);
+            if (!bits || (diff > max_diff)) {
+                matched = false;
+                break;
+            }
+
+            __len_bits += hist->cluster[i].sum;
+            __bits_cnt += (uint32_t)bits * hist->cluster[i].cnt;
+        }
+
+        if (matched) {
+            *len_bits = __len_bits;
+            *bits_cnt = __bits_cnt;
+            break;
+        }
+    }
+}
+
+/** Baudrate calculation on the RS-232 line by histogram
+ * 
+ * The function calculates baudrate on one RS-232 line using widths of both levels  
+ * Calculation is finished when width of a bit is confirmed by sniffer_rs232_config::min_detect_bits bits
+ * 
+ * \param[in,out] ctx context of baudrate calculation
+ */
+static void __sniffer_rs232_line_baudrate_hist_calc(struct baud_calc_ctx *ctx)
+{
+    if (!ctx)
+        return;
+
+    /* Edges not captured yet are analysed on the next step, the other line is not waited for */
+    uint32_t cnt = __sniffer_rs232_edges_cnt_get(ctx);
+    uint32_t start_idx = ctx->idx;
+
+    /* All new widths are added first, histogram is recalculated once per step */
+    for(; (ctx->idx + 1) < BUFFER_SIZE; ctx->idx++) {
+        if (cnt < (ctx->idx + 2))
+            break;
+
+        uint32_t len = (uint32_t)(ctx->buffer[ctx->idx + 1] - ctx->buffer[ctx->idx]);
+        __sniffer_rs232_hist_add(&ctx->hist, len);
+
+        /* Even positions are started by falling edge */
+        if (!(ctx->idx & 1) && len > ctx->max_len_bit)
+            ctx->max_len_bit = len;
+    }
+
+    bool buffer_full = ((ctx->idx + 1) >= BUFFER_SIZE);
+
+    if (ctx->idx == start_idx) {
+        ctx->done = buffer_full;
+        return;
+    }
+
+    uint64_t len_bits = 0;
+    uint32_t bits_cnt = 0;
+    __sniffer_rs232_hist_calc(&ctx->hist, &len_bits, &bits_cnt);
+
+    uint32_t baudrate = __sniffer_rs232_baudrate_get(len_bits, bits_cnt);
+    ctx->baudrate = baudrate;
+    ctx->meas_len_bits = baudrate ? len_bits : 0;
+    ctx->meas_bits_cnt = baudrate ? bits_cnt : 0;
+
+    if (baudrate) {
+        ctx->min_len_bit = (uint32_t)(len_bits / bits_cnt);
+        ctx->lin_detected = (ctx->max_len_bit / ctx->min_len_bit) > LIN_BREAK_MIN_LEN;
+
+        if (bits_cnt >= config.min_detect_bits) {
+            ctx->done = true;
+            return;
+        }
+    }
+
+    ctx->done = buffer_full;
+}
+
+/** Add edge into statistics of widths
+ * 
+ * The function is called from EXTI interrupt in \ref RS232_CAPTURE_EXTI_STREAM mode
+ * 
+ * \param[in,out] stats statistics of widths on RS-232 line
+ * \param[in] timestamp timestamp of the edge
+ */
+static inline void __sniffer_rs232_width_stats_add(struct width_stats *stats, uint32_t timestamp)
+{
+    if (stats->edges_cnt) {
+        uint32_t len = timestamp - stats->last;
+        __sniffer_rs232_hist_add(&stats->hist, len);
+
+        /* Odd edges finish lower level as the first edge is falling one */
+        if (stats->edges_cnt & 1) {
+            if (len >= stream_min_len && len < stats->min_low)
+                stats->min_low = len;
+
+            if (len > stats->max_low)
+                stats->max_low = len;
+        } else if (len > stats->max_high) {
+            stats->max_high = len;
+        }
+    }
+
+    stats->last = timestamp;
+    stats->edges_cnt++;
+}
+
+/** Baudrate calculation on the RS-232 line by statistics of widths
+ * 
+ * The function calculates baudrate on one RS-232 line in \ref RS232_CAPTURE_EXTI_STREAM mode  
+ * according to sniffer_rs232_config::baudrate_calc_type using snapshot of statistics of widths
+ * 
+ * \param[in,out] ctx context of baudrate calculation
+ */
+static void __sniffer_rs232_line_baudrate_stream_calc(struct baud_calc_ctx *ctx)
+{
+    if (!ctx || !ctx->stats)
+        return;
+
+    HAL_NVIC_DisableIRQ(ctx->irq_type);
+    struct width_stats stats = *ctx->stats;
+    HAL_NVIC_EnableIRQ(ctx->irq_type);
+
+    if (stats.edges_cnt == ctx->idx)
+        return;
+
+    ctx->idx = stats.edges_cnt;
+    ctx->max_len_bit = stats.max_low;
+
+    uint64_t len_bits = 0;
+    uint32_t bits_cnt = 0;
+    uint32_t baudrate = 0;
+
+    if (config.baudrate_calc_type == RS232_BAUDRATE_CALC_HISTOGRAM) {
+        __sniffer_rs232_hist_calc(&stats.hist, &len_bits, &bits_cnt);
+
+        baudrate = __sniffer_rs232_baudrate_get(len_bits, bits_cnt);
+
+        if (baudrate) {
+            ctx->min_len_bit = (uint32_t)(len_bits / bits_cnt);
+            ctx->done = (bits_cnt >= config.min_detect_bits);
+        }
+    } else {
+        if (stats.min_low != UINT32_MAX) {
+            len_bits = stats.min_low;
+            bits_cnt = 1;
+            baudrate = __sniffer_rs232_baudrate_get(len_bits, bits_cnt);
+
+            /* Single minimum width is replaced by average of all widths of the same width */
+            if (baudrate) {
+                uint32_t avg_baudrate = __sniffer_rs232_min_len_average(&stats.hist, stats.min_low, &len_bits, &bits_cnt);
+
+                if (avg_baudrate)
+                    baudrate = avg_baudrate;
+            }
+        }
+
+        if (baudrate)
+            ctx->min_len_bit = stats.min_low;
+
+        ctx->done = ((uint64_t)ctx->idx >= (4 * (uint64_t)config.min_detect_bits));
+    }
+
+    ctx->baudrate = baudrate;
+    ctx->meas_len_bits = baudrate ? len_bits : 0;
+    ctx->meas_bits_cnt = baudrate ? bits_cnt : 0;
+
+    if (baudrate)
+        ctx->lin_detected = (ctx->max_len_bit / ctx->min_len_bit) > LIN_BREAK_MIN_LEN;
+}
+
+/** Update of baudrate measurement
+ * 
+ * The function is called once per calculation, so float math is used for accuracy of the report
+ * 
+ * \param[in] type RS-232 line
+ * \param[in] ctx context of baudrate calculation of the line
+ * \param[in] baudrate detected baudrate in bods
+ */
+static void __sniffer_rs232_baud_info_update(enum uart_type type, struct baud_calc_ctx *ctx, uint32_t baudrate)
+{
+    baud_info[type].baudrate = baudrate;
+    baud_info[type].meas_baudrate = 0;
+    baud_info[type].nominal_baudrate = 0;
+    baud_info[type].error_ppm = 0;
+
+    /* Inversion is not excluded only if no long levels are captured */
+    baud_info[type].line_state = ctx->line_state;
+    if (ctx->armed && ctx->line_state == SNIFFER_RS232_LINE_UNKNOWN)
+        baud_info[type].line_state = SNIFFER_RS232_LINE_NORMAL;
+
+    /* Width of a single bit resolves one tick of the timer only, so it is not reported */
+    if (!ctx->meas_len_bits || ctx->meas_bits_cnt < MEAS_BITS_MIN)
+        return;
+
+    float meas_baudrate = (float)alg_tim_freq * (float)ctx->meas_bits_cnt / (float)ctx->meas_len_bits;
+    baud_info[type].meas_baudrate = (uint32_t)(meas_baudrate + 0.5f);
+
+    const struct baud_window *window = __sniffer_rs232_baud_window_nearest_get((uint32_t)((ctx->meas_len_bits << LEN_FRAC_BITS) / ctx->meas_bits_cnt));
+
+    if (!window)
+        return;
+
+    baud_info[type].nominal_baudrate = window->baudrate;
+    baud_info[type].error_ppm = (int32_t)((meas_baudrate - (float)window->baudrate) * 1000000.0f / (float)window->baudrate);
+}
+
+/** Size of UART frame in bits
+ * 
+ * \param[in] hyp hypothesis of UART parameters
+ * \return size of UART frame including start & stop bits
+ */
+static inline uint8_t __sniffer_rs232_frame_bits(const struct frame_hyp_ctx *hyp)
+{
+    return (uint8_t)(1 + hyp->wordlen + hyp->stopbits);
+}
+
+/** Check of decoded UART frame
+ * 
+ * The function checks stop bit & parity of sampled frame and counts result  
+ * into check context of the hypothesis. Frames with false start bit are skipped
+ * 
+ * \param[in] hyp hypothesis of UART parameters
+ * \param[in,out] state decoding state of the hypothesis
+ * \return true if frame is valid false otherwise
+ */
+static bool __sniffer_rs232_frame_check(const struct frame_hyp_ctx *hyp, struct frame_hyp_state *state)
+{
+    if (state->frame & 0x1)
+        return false;
+
+    uint16_t stop_mask = (uint16_t)(((1 << hyp->stopbits) - 1) << (1 + hyp->wordlen));
+    if ((state->frame & stop_mask) != stop_mask) {
+        state->check.error_frame_cnt++;
+        return false;
+    }
+
+    if (hyp->parity != BSP_UART_PARITY_NONE) {
+        uint16_t data = (state->frame >> 1) & ((1 << hyp->wordlen) - 1);
+        uint8_t ones = parity_lut[data & 0xFF] ^ (data >> 8);
+
+        if (ones != ((hyp->parity == BSP_UART_PARITY_ODD) ? 1 : 0)) {
+            state->check.error_parity_cnt++;
+            return false;
+        }
+    }
+
+    state->check.valid_cnt++;
+    return true;
+}
+
+/** Applying of captured edge to software decoding by one hypothesis
+ * 
+ * The function samples bits of the current frame up to \p edge in the middle of bits as UART does,  
+ * checks the frame when it is complete and starts the next frame by falling edge
+ * 
+ * \param[in] hyp hypothesis of UART parameters
+ * \param[in,out] state decoding state of the hypothesis
+ * \param[in] edge timestamp of the edge
+ * \param[in] falling_edge flag whether the edge is falling one
+ * \param[in] len_bit width of a bit in 1/256 of timer ticks
+ */
+static void __sniffer_rs232_frame_edge_apply(const struct frame_hyp_ctx *hyp, struct frame_hyp_state *state, uint32_t edge,
+                                             bool falling_edge, uint32_t len_bit)
+{
+    /* Level before falling edge is upper one */
+    uint16_t level = falling_edge ? 1 : 0;
+
+    if (state->in_frame) {
+        uint8_t frame_bits = __sniffer_rs232_frame_bits(hyp);
+
+        while (state->bit_idx < frame_bits) {
+            uint32_t sample = state->start + (((2 * state->bit_idx + 1) * len_bit) >> 9);
+
+            if ((int32_t)(sample - edge) >= 0)
+                break;
+
+            state->frame |= (level << state->bit_idx);
+            state->bit_idx++;
+        }
+
+        if (state->bit_idx == frame_bits) {
+            state->last_frame = state->frame;
+            state->end_valid = __sniffer_rs232_frame_check(hyp, state);
+            state->end = state->start + ((frame_bits * len_bit) >> 8);
+            state->in_frame = false;
+        }
+    }
+
+    if (!state->in_frame && falling_edge) {
+        /* Start bit within half of a bit from the end of the previous frame */
+        uint32_t gap = (uint32_t)((int32_t)(edge - state->end) < 0 ? (state->end - edge) : (edge - state->end));
+        if (state->end_valid && gap < (len_bit >> 9))
+            state->tight_cnt++;
+
+        state->end_valid = false;
+        state->start = edge;
+        state->frame = 0;
+        state->bit_idx = 0;
+        state->in_frame = true;
+    }
+}
+
+/** Start bit of software decoding by one hypothesis
+ * 
+ * \param[in] hyp hypothesis of UART parameters
+ * \param[in] buffer captured edges, the first one is falling edge
+ * \param[in] cnt count of edges in \p buffer
+ * \param[in] len_bit width of a bit in 1/256 of timer ticks
+ * \return number of edge of \p buffer decoding is started from, see \ref __sniffer_rs232_line_frames_align
+ */
+static uint32_t __sniffer_rs232_hyp_align_get(const struct frame_hyp_ctx *hyp, const uint32_t *buffer, uint32_t cnt, uint32_t len_bit)
+{
+    uint32_t frame_len = (__sniffer_rs232_frame_bits(hyp) * len_bit) >> 8;
+    uint32_t min_errors = UINT32_MAX;
+    uint32_t align_idx = 0;
+
+    /* Even positions are falling edges */
+    for (uint32_t start_idx = 0; start_idx < cnt && (buffer[start_idx] - buffer[0]) < frame_len; start_idx += 2) {
+        struct frame_hyp_state state = {0};
+
+        for (uint32_t idx = start_idx; idx < cnt; idx++) {
+            struct hyp_check_ctx *check = &state.check;
+
+            if ((check->valid_cnt + check->error_frame_cnt + check->error_parity_cnt) >= FRAME_ALIGN_FRAMES)
+                break;
+
+            __sniffer_rs232_frame_edge_apply(hyp, &state, buffer[idx], !(idx & 1), len_bit);
+        }
+
+        if (state.check.error_frame_cnt < min_errors) {
+            min_errors = state.check.error_frame_cnt;
+            align_idx = start_idx;
+        }
+
+        if (!min_errors)
+            break;
+    }
+
+    return align_idx;
+}
+
+/** Alignment of software decoding to start bits on the RS-232 line
+ * 
+ * Capture may begin in the middle of a frame, and on back-to-back traffic without IDLE gaps  
+ * the first captured falling edge is rarely a start bit, so decoding from it gives frame errors  
+ * until the decoder falls into step with frames. For each hypothesis the function tries  
+ * falling edges within the first frame as start bit and decodes \ref FRAME_ALIGN_FRAMES frames  
+ * from each of them, decoding of the hypothesis is started from the candidate with the least  
+ * count of stop bit errors (the earliest one if counts are equal)
+ * 
+ * \param[in] ctx context of baudrate calculation of the line
+ * \param[in,out] dec context of software decoding of the line
+ */
+static void __sniffer_rs232_line_frames_align(struct baud_calc_ctx *ctx, struct frame_decode_ctx *dec)
+{
+    uint32_t cnt = __sniffer_rs232_edges_cnt_get(ctx);
+
+    for (uint8_t i = 0; i < ARRAY_SIZE(frame_hyp_seq); i++)
+        dec->hyp[i].align_idx = __sniffer_rs232_hyp_align_get(&frame_hyp_seq[i], ctx->buffer, cnt, dec->len_bit);
+}
+
+/** Software decoding of UART frames on the RS-232 line
+ * 
+ * The function replays edges captured since the previous call and samples  
+ * them in the middle of bits as UART does, for all hypotheses from \ref frame_hyp_seq at once.  
+ * Edges before frame_hyp_state::align_idx of a hypothesis are skipped by the hypothesis
+ * 
+ * \param[in] ctx context of baudrate calculation of the line
+ * \param[in,out] dec context of software decoding of the line
+ * \return true if new edges were processed false otherwise
+ */
+static bool __sniffer_rs232_line_frames_decode(struct baud_calc_ctx *ctx, struct frame_decode_ctx *dec)
+{
+    uint32_t cnt = __sniffer_rs232_edges_cnt_get(ctx);
+
+    if (dec->idx >= cnt)
+        return false;
+
+    for (; dec->idx < cnt; dec->idx++) {
+        uint32_t edge = ctx->buffer[dec->idx];
+
+        /* Even positions are started by falling edge */
+        bool falling_edge = !(dec->idx & 1);
+
+        for (uint8_t i = 0; i < ARRAY_SIZE(frame_hyp_seq); i++) {
+            if (dec->idx < dec->hyp[i].align_idx)
+                continue;
+
+            __sniffer_rs232_frame_edge_apply(&frame_hyp_seq[i], &dec->hyp[i], edge, falling_edge, dec->len_bit);
+        }
+    }
+
+    return true;
+}
+
+/** Initialization of sequential probability ratio test
+ * 
+ * The function fills in \ref sprt according to sniffer_rs232_config::hyp_confidence  
+ * and expected rate of UART errors for valid hypothesis, which is ratio of  
+ * sniffer_rs232_config::uart_error_count and sniffer_rs232_config::valid_packets_count
+ */
+static void __sniffer_rs232_sprt_init(void)
+{
+    const float scale = (float)(1 << LLR_FRAC_BITS);
+    float p_failed = (float)SPRT_FAILED_ERROR_PCT / 100.0f;
+    float p_valid = (float)config.uart_error_count / (float)config.valid_packets_count;
+    float alpha = (float)(100 - config.hyp_confidence) / 100.0f;
+
+    if (p_valid > (float)SPRT_VALID_ERROR_PCT_MAX / 100.0f)
+        p_valid = (float)SPRT_VALID_ERROR_PCT_MAX / 100.0f;
+
+    sprt.valid = (int32_t)(logf((1.0f - p_valid) / (1.0f - p_failed)) * scale);
+    sprt.error = (int32_t)(logf(p_valid / p_failed) * scale);
+    sprt.approve = (int32_t)(logf((1.0f - alpha) / alpha) * scale);
+    sprt.fail = -sprt.approve;
+}
+
+/** Log-likelihood ratio of hypothesis on RS-232 line
+ * 
+ * \param[in] check check context of the hypothesis
+ * \return log-likelihood ratio in 1/(2^\ref LLR_FRAC_BITS), positive for valid hypothesis
+ */
+static int32_t __sniffer_rs232_hyp_evidence_get(const struct hyp_check_ctx *check)
+{
+    int64_t llr = (int64_t)check->evidence + (int64_t)check->valid_cnt * sprt.valid +
+                  ((int64_t)check->error_parity_cnt + check->error_frame_cnt) * sprt.error;
+
+    if (llr > INT32_MAX)
+        return INT32_MAX;
+
+    return (llr < INT32_MIN) ? INT32_MIN : (int32_t)llr;
+}
+
+/** Update of the best candidate of UART parameters
+ * 
+ * Hypothesis replaces \p candidate if its log-likelihood ratio summed over RS-232 lines is greater,  
+ * hypothesis without any received words is not considered
+ * 
+ * \param[in,out] candidate best candidate of UART parameters
+ * \param[in] channel_type RS-232 channel detection type
+ * \param[in] baudrate baudrate of the hypothesis in bods
+ * \param[in] hyp frame format of the hypothesis
+ * \param[in] tx_check check context of the hypothesis on RS-232 TX line
+ * \param[in] rx_check check context of the hypothesis on RS-232 RX line
+ */
+static void __sniffer_rs232_candidate_update(struct calc_candidate *candidate, enum rs232_channel_type channel_type, uint32_t baudrate,
+                                             const struct frame_hyp_ctx *hyp, const struct hyp_check_ctx *tx_check,
+                                             const struct hyp_check_ctx *rx_check)
+{
+    struct calc_candidate hyp_candidate = {.baudrate = baudrate, .hyp = *hyp};
+
+    if (channel_type != RS232_CHANNEL_RX) {
+        hyp_candidate.llr += __sniffer_rs232_hyp_evidence_get(tx_check);
+        hyp_candidate.valid_cnt += tx_check->valid_cnt;
+        hyp_candidate.error_cnt += tx_check->error_parity_cnt + tx_check->error_frame_cnt;
+    }
+
+    if (channel_type != RS232_CHANNEL_TX) {
+        hyp_candidate.llr += __sniffer_rs232_hyp_evidence_get(rx_check);
+        hyp_candidate.valid_cnt += rx_check->valid_cnt;
+        hyp_candidate.error_cnt += rx_check->error_parity_cnt + rx_check->error_frame_cnt;
+    }
+
+    if (!hyp_candidate.valid_cnt)
+        return;
+
+    if (!candidate->baudrate || hyp_candidate.llr > candidate->llr)
+        *candidate = hyp_candidate;
+}
+
+/** Confidence of the candidate of UART parameters
+ * 
+ * Confidence is posterior probability of the candidate by its log-likelihood ratio  
+ * assuming equal prior probabilities, the same measure as sniffer_rs232_config::hyp_confidence,  
+ * it is limited by maximum of sniffer_rs232_config::hyp_confidence
+ * 
+ * \param[in] candidate candidate of UART parameters
+ * \return confidence in percents
+ */
+static uint8_t __sniffer_rs232_candidate_confidence(const struct calc_candidate *candidate)
+{
+    if (!candidate->baudrate)
+        return 0;
+
+    float llr = (float)candidate->llr / (float)(1 << LLR_FRAC_BITS);
+    uint8_t confidence = (uint8_t)(100.0f / (1.0f + expf(-llr)));
+
+    /* Statistical decision is never certain */
+    return MIN(confidence, SNIFFER_RS232_CFG_PARAM_MAX(hyp_confidence));
+}
+
+/** Status of hypothesis on RS-232 line
+ * 
+ * \param[in] check check context of the hypothesis
+ * \return status of the hypothesis according to sniffer_rs232_config::hyp_check_type
+ */
+static enum hyp_status __sniffer_rs232_hyp_line_status(struct hyp_check_ctx *check)
+{
+    if (config.hyp_check_type == RS232_HYP_CHECK_SEQUENTIAL) {
+        int32_t llr = __sniffer_rs232_hyp_evidence_get(check);
+
+        if (llr <= sprt.fail)
+            return HYP_FAILED;
+
+        return (llr >= sprt.approve) ? HYP_APPROVED : HYP_PENDING;
+    }
+
+    if (check->error_parity_cnt >= config.uart_error_count || check->error_frame_cnt >= config.uart_error_count)
+        return HYP_FAILED;
+
+    return (check->valid_cnt >= config.valid_packets_count) ? HYP_APPROVED : HYP_PENDING;
+}
+
+/** Status of hypothesis on RS-232 lines
+ * 
+ * Hypothesis is failed if it is failed on any of the lines
+ * 
+ * \param[in] channel_type RS-232 channel detection type
+ * \param[in] tx_check check context of the hypothesis on RS-232 TX line
+ * \param[in] rx_check check context of the hypothesis on RS-232 RX line
+ * \return status of the hypothesis
+ */
+static enum hyp_status __sniffer_rs232_hyp_status(enum rs232_channel_type channel_type, struct hyp_check_ctx *tx_check,
+                                                  struct hyp_check_ctx *rx_check)
+{
+    enum hyp_status tx_status = __sniffer_rs232_hyp_line_status(tx_check);
+    enum hyp_status rx_status = __sniffer_rs232_hyp_line_status(rx_check);
+
+    /* Lines are independent, so decision is made when both of them are decided */
+    if (channel_type == RS232_CHANNEL_ALL && (tx_status == HYP_PENDING || rx_status == HYP_PENDING))
+        return HYP_PENDING;
+
+    if (tx_status == HYP_FAILED || rx_status == HYP_FAILED)
+        return HYP_FAILED;
+
+    switch (channel_type) {
+    case RS232_CHANNEL_TX:
+        return tx_status;
+
+    case RS232_CHANNEL_RX:
+        return rx_status;
+
+    case RS232_CHANNEL_ANY:
+        return (tx_status == HYP_APPROVED || rx_status == HYP_APPROVED) ? HYP_APPROVED : HYP_PENDING;
+
+    case RS232_CHANNEL_ALL:
+        return (tx_status == HYP_APPROVED && rx_status == HYP_APPROVED) ? HYP_APPROVED : HYP_PENDING;
+
+    default:
+        break;
+    }
+
+    return HYP_PENDING;
+}
+
+/** Check whether UART frames of hypothesis can be received by monitoring
+ * 
+ * 7 bits frame is received by UART as 8 bits one (see \ref BSP_UART_WORDLEN_7), so its stop bit  
+ * is sampled one bit later than it is. 7N1 frames following each other without any gap can not be  
+ * received, start bit of the next frame is sampled as stop bit and reception loses synchronization
+ * 
+ * \param[in] hyp hypothesis of UART frame format
+ * \param[in] tx_state decoding state of the hypothesis on RS-232 TX line
+ * \param[in] rx_state decoding state of the hypothesis on RS-232 RX line
+ * \return true if frames can be received, false otherwise
+ */
+static bool __sniffer_rs232_hyp_receivable(const struct frame_hyp_ctx *hyp, const struct frame_hyp_state *tx_state,
+                                           const struct frame_hyp_state *rx_state)
+{
+    if (hyp->wordlen != BSP_UART_WORDLEN_7 || hyp->stopbits != BSP_UART_STOPBITS_1)
+        return true;
+
+    return !(tx_state->tight_cnt + rx_state->tight_cnt);
+}
+
+/** Result of software decoding of UART frames
+ * 
+ * Hypotheses with 1 stop bit are checked in order of \ref frame_hyp_seq, the first one which is not failed  
+ * is taken when it is approved by \ref __sniffer_rs232_hyp_status. Frames with 2 stop bits are received  
+ * with 1 stop bit as well, so the same hypothesis with 2 stop bits is approved instead only if it is  
+ * approved too and there are frames following each other without any gap (otherwise count of stop bits  
+ * can not be distinguished). Hypothesis which can not be received by monitoring is taken as failed,  
+ * see \ref __sniffer_rs232_hyp_receivable
+ * 
+ * \param[in] channel_type RS-232 channel detection type
+ * \param[in] tx_dec context of software decoding of RS-232 TX line
+ * \param[in] rx_dec context of software decoding of RS-232 RX line
+ * \param[out] hyp_num number of approved hypothesis from \ref frame_hyp_seq, -1 if no one is approved
+ * \return true if decision is made false if more frames are needed
+ */
+static bool __sniffer_rs232_frames_result(enum rs232_channel_type channel_type, struct frame_decode_ctx *tx_dec,
+                                          struct frame_decode_ctx *rx_dec, int8_t *hyp_num)
+{
+    *hyp_num = -1;
+
+    for (uint8_t i = 0; i < ARRAY_SIZE(frame_hyp_seq); i += 2) {
+        enum hyp_status status = __sniffer_rs232_hyp_status(channel_type, &tx_dec->hyp[i].check, &rx_dec->hyp[i].check);
+
+        if (status == HYP_FAILED || !__sniffer_rs232_hyp_receivable(&frame_hyp_seq[i], &tx_dec->hyp[i], &rx_dec->hyp[i]))
+            continue;
+
+        if (status == HYP_PENDING)
+            return false;
+
+        *hyp_num = (int8_t)i;
+
+        status = __sniffer_rs232_hyp_status(channel_type, &tx_dec->hyp[i + 1].check, &rx_dec->hyp[i + 1].check);
+        if (status == HYP_APPROVED && (tx_dec->hyp[i + 1].tight_cnt + rx_dec->hyp[i + 1].tight_cnt))
+            *hyp_num = (int8_t)(i + 1);
+
+        return true;
+    }
+
+    return true;
+}
+
+/** Start of parameter part of the algorithm by software decoding
+ * 
+ * The function aligns decoding of hypotheses from \ref frame_hyp_seq with frames  
+ * captured during baudrate part of the algorithm, capture of edges goes on during decoding
+ * 
+ * \param[in] channel_type RS-232 channel detection type
+ * \param[in] tx_ctx context of baudrate calculation of RS-232 TX line
+ * \param[in] rx_ctx context of baudrate calculation of RS-232 RX line
+ * \param[in] baudrate baudrate in bods on RS-232 lines
+ * \param[out] tx_dec context of software decoding of RS-232 TX line
+ * \param[out] rx_dec context of software decoding of RS-232 RX line
+ */
+static void __sniffer_rs232_frames_decode_start(enum rs232_channel_type channel_type, struct baud_calc_ctx *tx_ctx, struct baud_calc_ctx *rx_ctx,
+                                                uint32_t baudrate, struct frame_decode_ctx *tx_dec, struct frame_decode_ctx *rx_dec)
+{
+    memset(tx_dec, 0, sizeof(struct frame_decode_ctx));
+    memset(rx_dec, 0, sizeof(struct frame_decode_ctx));
+
+    tx_dec->len_bit = rx_dec->len_bit = __sniffer_rs232_len_bit_get(baudrate, 100);
+
+    if (channel_type != RS232_CHANNEL_RX)
+        __sniffer_rs232_line_frames_align(tx_ctx, tx_dec);
+
+    if (channel_type != RS232_CHANNEL_TX)
+        __sniffer_rs232_line_frames_align(rx_ctx, rx_dec);
+}
+
+/** Step of parameter part of the algorithm by software decoding
+ * 
+ * The function decodes edges captured since the previous step. Decoding is finished when  
+ * decision is made, buffers are filled in or no edges are captured for \ref FRAMES_DECODE_IDLE_TMT
+ * 
+ * \param[in] channel_type RS-232 channel detection type
+ * \param[in] tx_ctx context of baudrate calculation of RS-232 TX line
+ * \param[in] rx_ctx context of baudrate calculation of RS-232 RX line
+ * \param[in,out] tx_dec context of software decoding of RS-232 TX line
+ * \param[in,out] rx_dec context of software decoding of RS-232 RX line
+ * \param[in,out] edge_time time of the last decoded edge in ms
+ * \param[out] hyp_num number of approved hypothesis from \ref frame_hyp_seq, -1 if decoding is not conclusive
+ * \param[out] finished flag whether decoding is finished
+ */
+static void __sniffer_rs232_frames_decode_step(enum rs232_channel_type channel_type, struct baud_calc_ctx *tx_ctx, struct baud_calc_ctx *rx_ctx,
+                                               struct frame_decode_ctx *tx_dec, struct frame_decode_ctx *rx_dec, uint32_t *edge_time,
+                                               int8_t *hyp_num, bool *finished)
+{
+    bool progress = false;
+
+    *finished = true;
+
+    if (channel_type != RS232_CHANNEL_RX && __sniffer_rs232_line_frames_decode(tx_ctx, tx_dec))
+        progress = true;
+
+    if (channel_type != RS232_CHANNEL_TX && __sniffer_rs232_line_frames_decode(rx_ctx, rx_dec))
+        progress = true;
+
+    if (__sniffer_rs232_frames_result(channel_type, tx_dec, rx_dec, hyp_num))
+        return;
+
+    bool tx_full = (channel_type == RS232_CHANNEL_RX) || (tx_dec->idx >= BUFFER_SIZE);
+    bool rx_full = (channel_type == RS232_CHANNEL_TX) || (rx_dec->idx >= BUFFER_SIZE);
+
+    if (tx_full && rx_full)
+        return;
+
+    if (progress)
+        *edge_time = HAL_GetTick();
+
+    *finished = (HAL_GetTick() - *edge_time) > FRAMES_DECODE_IDLE_TMT;
+}
+
+/** Start of baudrate part of the algorithm
+ * 
+ * The function starts capture of edges on RS-232 TX/RX lines according to \a channel_type
+ * 
+ * \param[in] channel_type RS-232 channel detection type
+ * \param[out] tx_ctx context of baudrate calculation of RS-232 TX line
+ * \param[out] rx_ctx context of baudrate calculation of RS-232 RX line
+ * \return \ref RES_OK on success error otherwise
+ */
+static uint8_t __sniffer_rs232_baudrate_calc_start(enum rs232_channel_type channel_type, struct baud_calc_ctx *tx_ctx, struct baud_calc_ctx *rx_ctx)
+{
+    /* Initialization, buffers of the other line may be used by concurrent calculation */
+    if (channel_type != RS232_CHANNEL_RX) {
+        memset(tx_buffer, 0, sizeof(tx_buffer));
+        memset(&tx_stats, 0, sizeof(tx_stats));
+        memset(&tx_glitch, 0, sizeof(tx_glitch));
+        memset(&replay[BSP_UART_TYPE_RS232_TX], 0, sizeof(replay[BSP_UART_TYPE_RS232_TX]));
+        tx_stats.min_low = UINT32_MAX;
+        tx_first_falling = true;
+        tx_cnt = 0;
+    }
+
+    if (channel_type != RS232_CHANNEL_TX) {
+        memset(rx_buffer, 0, sizeof(rx_buffer));
+        memset(&rx_stats, 0, sizeof(rx_stats));
+        memset(&rx_glitch, 0, sizeof(rx_glitch));
+        memset(&replay[BSP_UART_TYPE_RS232_RX], 0, sizeof(replay[BSP_UART_TYPE_RS232_RX]));
+        rx_stats.min_low = UINT32_MAX;
+        rx_first_falling = true;
+        rx_cnt = 0;
+    }
+
+    bool stream = (config.capture_type == RS232_CAPTURE_EXTI_STREAM);
+
+    DMA_HandleTypeDef *tx_hdma = (config.capture_type == RS232_CAPTURE_TIM_DMA) ? &alg_hdma : NULL;
+
+    *tx_ctx = (struct baud_calc_ctx){.cnt = &tx_cnt, .buffer = tx_buffer, .hdma = tx_hdma, .stats = stream ? &tx_stats : NULL, .irq_type = EXTI3_IRQn,
+                                     .gpiox = GPIOA, .pin = GPIO_PIN_3, .level_idx = 0, .level_min_low = UINT32_MAX, .level_max_low = 0, .level_max_high = 0,
+                                     .idx = 0, .min_len_bit = UINT32_MAX, .max_len_bit = 0, .baudrate = 0, .toggle_bit = false, .lin_detected = false, .done = false,
+                                     .hist = {.cluster_cnt = 0}};
+
+    *rx_ctx = (struct baud_calc_ctx){.cnt = &rx_cnt, .buffer = rx_buffer, .hdma = NULL, .stats = stream ? &rx_stats : NULL, .irq_type = EXTI9_5_IRQn,
+                                     .gpiox = GPIOC, .pin = GPIO_PIN_5, .level_idx = 0, .level_min_low = UINT32_MAX, .level_max_low = 0, .level_max_high = 0,
+                                     .idx = 0, .min_len_bit = UINT32_MAX, .max_len_bit = 0, .baudrate = 0, .toggle_bit = false, .lin_detected = false, .done = false,
+                                     .hist = {.cluster_cnt = 0}};
+
+    /* Lines are waited for IDLE state concurrently by steps, see \ref __sniffer_rs232_line_state_step */
+    if (channel_type != RS232_CHANNEL_RX)
+        __sniffer_rs232_line_capture_init(tx_ctx);
+
+    if (channel_type != RS232_CHANNEL_TX)
+        __sniffer_rs232_line_capture_init(rx_ctx);
+
+    return RES_OK;
+}
+
+/** Step of baudrate part of the algorithm
+ * 
+ * The function analyses edges captured on RS-232 TX/RX lines since the previous step
+ * 
+ * \param[in] channel_type RS-232 channel detection type
+ * \param[in,out] tx_ctx context of baudrate calculation of RS-232 TX line
+ * \param[in,out] rx_ctx context of baudrate calculation of RS-232 RX line
+ * \param[out] baudrate calculated baudrate, valid if \p finished is set
+ * \param[out] finished flag whether baudrate calculation is finished
+ * \return \ref RES_OK on success error otherwise
+ */
+static uint8_t __sniffer_rs232_baudrate_calc_step(enum rs232_channel_type channel_type, struct baud_calc_ctx *tx_ctx, struct baud_calc_ctx *rx_ctx,
+                                                  uint32_t *baudrate, bool *finished)
+{
+    void (*line_baudrate_calc)(struct baud_calc_ctx*) = (config.baudrate_calc_type == RS232_BAUDRATE_CALC_HISTOGRAM) ?
+                                                          __sniffer_rs232_line_baudrate_hist_calc : __sniffer_rs232_line_baudrate_calc;
+
+    if (config.capture_type == RS232_CAPTURE_EXTI_STREAM)
+        line_baudrate_calc = __sniffer_rs232_line_baudrate_stream_calc;
+
+    *finished = false;
+    *baudrate = 0;
+
+    for (enum uart_type type = BSP_UART_TYPE_RS232_TX; type < BSP_UART_TYPE_MAX; type++) {
+        struct baud_calc_ctx *ctx = (type == BSP_UART_TYPE_RS232_TX) ? tx_ctx : rx_ctx;
+
+        if (type == BSP_UART_TYPE_RS232_TX ? (channel_type == RS232_CHANNEL_RX) : (channel_type == RS232_CHANNEL_TX))
+            continue;
+
+        if (ctx->done)
+            continue;
+
+        if (ctx->armed)
+            line_baudrate_calc(ctx);
+
+        /* Polarity is checked over the same edges before baudrate of the line is accepted */
+        uint8_t res = __sniffer_rs232_line_state_step(ctx);
+
+        if (res != RES_OK)
+            return res;
+    }
+
+    /* Result processing */
+    struct baud_calc_ctx *ctx = rx_ctx;
+    switch (channel_type) {
+    case RS232_CHANNEL_TX:
+        ctx = tx_ctx;
+    case RS232_CHANNEL_RX:
+        if (ctx->done) {
+            *baudrate = ctx->baudrate;
+            *finished = true;
+        }
+        break;
+
+    case RS232_CHANNEL_ANY:
+        if (tx_ctx->done || rx_ctx->done) {
+            *baudrate = tx_ctx->baudrate ? tx_ctx->baudrate : rx_ctx->baudrate;
+            *finished = (*baudrate != 0) || (tx_ctx->done && rx_ctx->done);
+        }
+        break;
+
+    default:
+        break;
+    }
+
+    return RES_OK;
+}
+
+/** Stop of baudrate part of the algorithm
+ * 
+ * The function stops capture of edges on RS-232 lines, including capture  
+ * for software decoding of frames, see \ref __sniffer_rs232_frames_decode_step
+ * 
+ * \param[in] channel_type RS-232 channel detection type
+ * \param[in,out] tx_ctx context of baudrate calculation of RS-232 TX line
+ * \param[in,out] rx_ctx context of baudrate calculation of RS-232 RX line
+ * \param[in] baudrate calculated baudrate, 0 if not calculated
+ */
+static void __sniffer_rs232_baudrate_calc_stop(enum rs232_channel_type channel_type, struct baud_calc_ctx *tx_ctx, struct baud_calc_ctx *rx_ctx,
+                                               uint32_t baudrate)
+{
+    __sniffer_rs232_capture_stop(channel_type, tx_ctx);
+
+    if (channel_type != RS232_CHANNEL_RX)
+        __sniffer_rs232_baud_info_update(BSP_UART_TYPE_RS232_TX, tx_ctx, baudrate);
+
+    if (channel_type != RS232_CHANNEL_TX)
+        __sniffer_rs232_baud_info_update(BSP_UART_TYPE_RS232_RX, rx_ctx, baudrate);
+}
+
+/** Callback for UART overflow
+ * 
+ * Callback is called from \ref bsp_uart when overflow of RX buffer is occured  
+ * If call occured the algorithm is terminated with fail
+ * 
+ * \param[in] type UART type
+ * \param[in] params optional parameters, containing check context of the current hypothesis \ref hyp_check_ctx
+ */
+static void __sniffer_rs232_uart_overflow_cb(enum uart_type type, void *params)
+{
+    struct hyp_check_ctx *check_ctx = (struct hyp_check_ctx*)params;
+    check_ctx->overflow = true;
+}
+
+/** Callback for UART errors
+ * 
+ * Callback is called from \ref bsp_uart when UART errors are occured  
+ * Callback counts UART errors into check context of the current hypothesis \ref hyp_check_ctx
+ * 
+ * \param[in] type UART type
+ * \param[in] error mask of occured UART errors
+ * \param[in] params optional parameters, containing check context of the current hypothesis \ref hyp_check_ctx
+ */
+static void __sniffer_rs232_uart_error_cb(enum uart_type type, uint32_t error, void *params)
+{
+    struct hyp_check_ctx *check_ctx = (struct hyp_check_ctx*)params;
+
+    if (error & BSP_UART_ERROR_PE)
+        check_ctx->error_parity_cnt++;
+
+    if (error & BSP_UART_ERROR_FE)
+        check_ctx->error_frame_cnt++;
+
+    bsp_uart_start(type);
+}
+
+/** Start of check of UART parameters on RS-232 lines
+ * 
+ * The function initializes UART instances of RS-232 lines with parameters \p init_ctx
+ * 
+ * \param[in] channel_type RS-232 channel detection type
+ * \param[in] init_ctx UART parameters of hypothesis, buffers & callbacks are filled in by the function
+ * \param[in,out] tx_check check context of the hypothesis on RS-232 TX line
+ * \param[in,out] rx_check check context of the hypothesis on RS-232 RX line
+ * \return \ref RES_OK on success error otherwise
+ */
+static uint8_t __sniffer_rs232_uart_check_start(enum rs232_channel_type channel_type, struct uart_init_ctx *init_ctx,
+                                                struct hyp_check_ctx *tx_check, struct hyp_check_ctx *rx_check)
+{
+    uint8_t res = RES_OK;
+
+    /* Words of the previous hypothesis are not valid anymore, replay of the other line may be used by concurrent calculation */
+    if (channel_type != RS232_CHANNEL_RX)
+        memset(&replay[BSP_UART_TYPE_RS232_TX], 0, sizeof(replay[BSP_UART_TYPE_RS232_TX]));
+
+    if (channel_type != RS232_CHANNEL_TX)
+        memset(&replay[BSP_UART_TYPE_RS232_RX], 0, sizeof(replay[BSP_UART_TYPE_RS232_RX]));
+
+    init_ctx->rx_size = UART_BUFF_SIZE;
+    init_ctx->error_isr_cb = __sniffer_rs232_uart_error_cb;
+    init_ctx->overflow_isr_cb = __sniffer_rs232_uart_overflow_cb;
+
+    if (channel_type != RS232_CHANNEL_RX) {
+        init_ctx->params = tx_check;
+        res = bsp_uart_init(BSP_UART_TYPE_RS232_TX, init_ctx);
+
+        if (res != RES_OK)
+            return res;
+    }
+
+    if (channel_type != RS232_CHANNEL_TX) {
+        init_ctx->params = rx_check;
+        res = bsp_uart_init(BSP_UART_TYPE_RS232_RX, init_ctx);
+    }
+
+    return res;
+}
+
+/** Adding of words received over UART into replay of traffic
+ * 
+ * \param[in] type RS-232 line
+ * \param[in] span received words, see \ref uart_rx_span
+ * \param[in] seg index of segment of \p span
+ */
+static void __sniffer_rs232_replay_add(enum uart_type type, const struct uart_rx_span *span, uint32_t seg)
+{
+    struct replay_words *ctx = &replay[type];
+    uint32_t cnt = MIN((uint32_t)span->len[seg], REPLAY_WORDS_MAX - ctx->cnt);
+
+    span->copy(&ctx->words[ctx->cnt], span->data[seg], cnt);
+    ctx->cnt += cnt;
+}
+
+/** Check of raw words for hypotheses from \ref hyp_seq
+ * 
+ * Words are received as 9 bits without parity. For hypotheses with 8 bits word length  
+ * MSB of raw word is stop bit, so it is counted as frame error if it is not set
+ * 
+ * \param[in] words raw words received over UART
+ * \param[in] len count of \p words
+ * \param[in,out] check context of check of hypotheses on RS-232 line
+ */
+static void __sniffer_rs232_raw_words_check(const uint16_t *words, uint16_t len, struct raw_check_ctx *check)
+{
+    for (uint16_t i = 0; i < len; i++) {
+        uint16_t word = words[i];
+
+        for (uint8_t j = 0; j < ARRAY_SIZE(hyp_seq); j++) {
+            struct hyp_check_ctx *hyp_check = &check->hyp[j];
+
+            if (hyp_seq[j].wordlen == BSP_UART_WORDLEN_8 && !(word & 0x100)) {
+                hyp_check->error_frame_cnt++;
+                continue;
+            }
+
+            if (hyp_seq[j].parity != BSP_UART_PARITY_NONE) {
+                uint16_t data = word & ((1 << hyp_seq[j].wordlen) - 1);
+                uint8_t ones = parity_lut[data & 0xFF] ^ (data >> 8);
+
+                if (ones != ((hyp_seq[j].parity == BSP_UART_PARITY_ODD) ? 1 : 0)) {
+                    hyp_check->error_parity_cnt++;
+                    continue;
+                }
+            }
+
+            hyp_check->valid_cnt++;
+        }
+    }
+}
+
+/** Receiving of words over UART on RS-232 line
+ * 
+ * Words are processed in place of receive buffer of UART and added into replay of traffic,  
+ * words overwritten by DMA during processing are treated as overflow of receive buffer
+ * 
+ * \param[in] type RS-232 line
+ * \param[in,out] check check context of the current hypothesis in UART mode
+ * \param[in,out] raw context of check of hypotheses over raw words, NULL if words are not raw
+ * \return count of received words
+ */
+static uint16_t __sniffer_rs232_uart_receive(enum uart_type type, struct hyp_check_ctx *check, struct raw_check_ctx *raw)
+{
+    struct uart_rx_span span = {0};
+
+    if (bsp_uart_read_acquire(type, &span, 0) != RES_OK)
+        return 0;
+
+    for (uint32_t i = 0; i < ARRAY_SIZE(span.data); i++) {
+        if (!span.len[i])
+            continue;
+
+        /* Raw words are 9 bits without parity, so they are always received as halfwords */
+        if (raw && span.word_size == sizeof(uint16_t))
+            __sniffer_rs232_raw_words_check(span.data[i], span.len[i], raw);
+
+        __sniffer_rs232_replay_add(type, &span, i);
+    }
+
+    uint16_t len = span.len[0] + span.len[1];
+    uint16_t lost = 0;
+    bsp_uart_read_release(type, len, &lost);
+
+    if (lost)
+        check->overflow = true;
+
+    return len - lost;
+}
+
+/** Step of check of UART parameters on RS-232 lines
+ * 
+ * The function counts data received over UART on RS-232 lines since the previous step  
+ * and makes decision about hypothesis, see \ref __sniffer_rs232_hyp_status
+ * 
+ * \param[in] channel_type RS-232 channel detection type
+ * \param[in,out] tx_check check context of the hypothesis on RS-232 TX line
+ * \param[in,out] rx_check check context of the hypothesis on RS-232 RX line
+ * \param[out] status status of the hypothesis
+ * \return \ref RES_OK on success error otherwise
+ */
+static uint8_t __sniffer_rs232_uart_check_step(enum rs232_channel_type channel_type, struct hyp_check_ctx *tx_check,
+                                               struct hyp_check_ctx *rx_check, enum hyp_status *status)
+{
+    *status = HYP_PENDING;
+
+    if (channel_type != RS232_CHANNEL_RX)
+        tx_check->valid_cnt += __sniffer_rs232_uart_receive(BSP_UART_TYPE_RS232_TX, tx_check, NULL);
+
+    if (channel_type != RS232_CHANNEL_TX)
+        rx_check->valid_cnt += __sniffer_rs232_uart_receive(BSP_UART_TYPE_RS232_RX, rx_check, NULL);
+
+    if (tx_check->overflow || rx_check->overflow)
+        return RES_OVERFLOW;
+
+    /* Result processing */
+    *status = __sniffer_rs232_hyp_status(channel_type, tx_check, rx_check);
+
+    return RES_OK;
+}
+
+/** Stop of check of UART parameters on RS-232 lines
+ * 
+ * UART instances are stopped but not deinitialized
+ * 
+ * \param[in] channel_type RS-232 channel detection type
+ * \return \ref RES_OK on success error otherwise
+ */
+static uint8_t __sniffer_rs232_uart_check_stop(enum rs232_channel_type channel_type)
+{
+    uint8_t res = RES_OK;
+
+    if (channel_type != RS232_CHANNEL_RX)
+        res = bsp_uart_stop(BSP_UART_TYPE_RS232_TX);
+
+    if (channel_type != RS232_CHANNEL_TX) {
+        uint8_t __res = bsp_uart_stop(BSP_UART_TYPE_RS232_RX);
+        res = (res == RES_OK) ? __res : res;
+    }
+
+    return res;
+}
+
+/** Check of UART parameters on RS-232 lines
+ * 
+ * The function receives data over UART on RS-232 lines with parameters \p init_ctx  
+ * until hypothesis is approved or failed (see \ref __sniffer_rs232_hyp_status) or \p tmt_ms is expired  
+ * UART instances are stopped at the end but not deinitialized
+ * 
+ * \param[in] channel_type RS-232 channel detection type
+ * \param[in] init_ctx UART parameters of hypothesis, buffers & callbacks are filled in by the function
+ * \param[in] tmt_ms maximum time of the check in ms
+ * \param[in,out] tx_check check context of the hypothesis on RS-232 TX line
+ * \param[in,out] rx_check check context of the hypothesis on RS-232 RX line
+ * \param[out] status status of the hypothesis
+ * \return \ref RES_OK on success, \ref RES_TIMEOUT if decision is not made within \p tmt_ms, error otherwise
+ */
+static uint8_t __sniffer_rs232_uart_check(enum rs232_channel_type channel_type, struct uart_init_ctx *init_ctx, uint32_t tmt_ms,
+                                          struct hyp_check_ctx *tx_check, struct hyp_check_ctx *rx_check, enum hyp_status *status)
+{
+    *status = HYP_PENDING;
+
+    /* Initialization */
+    uint8_t res = __sniffer_rs232_uart_check_start(channel_type, init_ctx, tx_check, rx_check);
+
+    if (res != RES_OK)
+        return res;
+
+    uint32_t start_exec_time = HAL_GetTick();
+
+    /* Calculation */
+    while (true) {
+        if ((HAL_GetTick() - start_exec_time) > tmt_ms) {
+            res = RES_TIMEOUT;
+            break;
+        }
+
+        res = __sniffer_rs232_uart_check_step(channel_type, tx_check, rx_check, status);
+
+        if (res != RES_OK || *status != HYP_PENDING)
+            break;
+    }
+
+    uint8_t __res = __sniffer_rs232_uart_check_stop(channel_type);
+
+    return (res == RES_OK) ? __res : res;
+}
+
+/** Deinitialization of UART instances of RS-232 lines
+ * 
+ * \param[in] channel_type RS-232 channel detection type
+ * \return \ref RES_OK on success error otherwise
+ */
+static uint8_t __sniffer_rs232_uart_deinit(enum rs232_channel_type channel_type)
+{
+    uint8_t res = RES_OK;
+
+    if (channel_type != RS232_CHANNEL_RX) {
+        res = bsp_uart_deinit(BSP_UART_TYPE_RS232_TX);
+
+        if (res != RES_OK)
+            return res;
+    }
+
+    if (channel_type != RS232_CHANNEL_TX)
+        res = bsp_uart_deinit(BSP_UART_TYPE_RS232_RX);
+
+    return res;
+}
+
+/** Start of check of hypothesis of parameter part of the algorithm
+ * 
+ * In \ref RS232_HYP_CHECK_SEQUENTIAL mode half of evidence of the hypothesis from the previous attempt  
+ * with the same baudrate is carried over, see \ref hyp_evidence
+ * 
+ * \param[in] channel_type RS-232 channel detection type
+ * \param[in] baudrate baudrate in bods on RS-232 lines
+ * \param[in] hyp_num number of hypothesis from \ref hyp_seq
+ * \param[out] tx_check check context of the hypothesis on RS-232 TX line
+ * \param[out] rx_check check context of the hypothesis on RS-232 RX line
+ * \return \ref RES_OK on success error otherwise
+ */
+static uint8_t __sniffer_rs232_params_hyp_start(enum rs232_channel_type channel_type, uint32_t baudrate, int8_t hyp_num,
+                                                struct hyp_check_ctx *tx_check, struct hyp_check_ctx *rx_check)
+{
+    struct uart_init_ctx init_ctx = {0};
+    init_ctx.baudrate = baudrate;
+    init_ctx.wordlen = hyp_seq[hyp_num].wordlen;
+    init_ctx.parity = hyp_seq[hyp_num].parity;
+    init_ctx.stopbits = BSP_UART_STOPBITS_1;
+
+    memset(tx_check, 0, sizeof(struct hyp_check_ctx));
+    memset(rx_check, 0, sizeof(struct hyp_check_ctx));
+    tx_check->evidence = hyp_evidence[BSP_UART_TYPE_RS232_TX][hyp_num] / 2;
+    rx_check->evidence = hyp_evidence[BSP_UART_TYPE_RS232_RX][hyp_num] / 2;
+
+    return __sniffer_rs232_uart_check_start(channel_type, &init_ctx, tx_check, rx_check);
+}
+
+/** Finish of check of hypothesis of parameter part of the algorithm
+ * 
+ * The function stores evidence of the checked hypothesis into \ref hyp_evidence  
+ * and chooses the next hypothesis if the current one is failed
+ * 
+ * \param[in] channel_type RS-232 channel detection type
+ * \param[in] hyp_num number of the checked hypothesis from \ref hyp_seq
+ * \param[in] tx_check check context of the hypothesis on RS-232 TX line
+ * \param[in] rx_check check context of the hypothesis on RS-232 RX line
+ * \return number of the next hypothesis from \ref hyp_seq, 0 if all hypotheses have been tried
+ */
+static int8_t __sniffer_rs232_params_hyp_next(enum rs232_channel_type channel_type, int8_t hyp_num,
+                                              struct hyp_check_ctx *tx_check, struct hyp_check_ctx *rx_check)
+{
+    if (channel_type != RS232_CHANNEL_RX)
+        hyp_evidence[BSP_UART_TYPE_RS232_TX][hyp_num] = __sniffer_rs232_hyp_evidence_get(tx_check);
+
+    if (channel_type != RS232_CHANNEL_TX)
+        hyp_evidence[BSP_UART_TYPE_RS232_RX][hyp_num] = __sniffer_rs232_hyp_evidence_get(rx_check);
+
+    bool error_frame = false;
+
+    if (config.hyp_check_type == RS232_HYP_CHECK_SEQUENTIAL)
+        error_frame = (tx_check->error_frame_cnt + rx_check->error_frame_cnt) >= (tx_check->error_parity_cnt + rx_check->error_parity_cnt);
+    else
+        error_frame = (tx_check->error_frame_cnt >= config.uart_error_count || rx_check->error_frame_cnt >= config.uart_error_count);
+
+    if (error_frame)
+        return hyp_seq[hyp_num].jump;
+
+    return (hyp_num == (ARRAY_SIZE(hyp_seq) - 1)) ? 0 : (hyp_num + 1);
+}
+
+/** Start of parameter part of the algorithm over raw words
+ * 
+ * The function initializes UART instances of RS-232 lines to receive 9 bits words without parity,  
+ * all hypotheses from \ref hyp_seq are checked at once in software, see \ref __sniffer_rs232_params_raw_step
+ * 
+ * \param[in] channel_type RS-232 channel detection type
+ * \param[in] baudrate baudrate in bods on RS-232 lines
+ * \param[out] tx_check context of check of hypotheses on RS-232 TX line
+ * \param[out] rx_check context of check of hypotheses on RS-232 RX line
+ * \return \ref RES_OK on success error otherwise
+ */
+static uint8_t __sniffer_rs232_params_raw_start(enum rs232_channel_type channel_type, uint32_t baudrate,
+                                                struct raw_check_ctx *tx_check, struct raw_check_ctx *rx_check)
+{
+    memset(tx_check, 0, sizeof(struct raw_check_ctx));
+    memset(rx_check, 0, sizeof(struct raw_check_ctx));
+
+    struct uart_init_ctx init_ctx = {0};
+    init_ctx.baudrate = baudrate;
+    init_ctx.wordlen = BSP_UART_WORDLEN_9;
+    init_ctx.parity = BSP_UART_PARITY_NONE;
+    init_ctx.stopbits = BSP_UART_STOPBITS_1;
+
+    uint8_t res = __sniffer_rs232_uart_check_start(channel_type, &init_ctx, &tx_check->uart, &rx_check->uart);
+
+    if (channel_type != RS232_CHANNEL_RX)
+        replay[BSP_UART_TYPE_RS232_TX].raw = true;
+
+    if (channel_type != RS232_CHANNEL_TX)
+        replay[BSP_UART_TYPE_RS232_RX].raw = true;
+
+    return res;
+}
+
+/** Step of parameter part of the algorithm over raw words
+ * 
+ * UART frame errors are taken into account only for hypotheses with 9 bits word length,  
+ * see \ref __sniffer_rs232_raw_words_check. Hypotheses are checked in order of \ref hyp_seq,  
+ * the first one which is not failed is taken when it is approved
+ * 
+ * \param[in] channel_type RS-232 channel detection type
+ * \param[in,out] tx_check context of check of hypotheses on RS-232 TX line
+ * \param[in,out] rx_check context of check of hypotheses on RS-232 RX line
+ * \param[out] hyp_num number of the first not failed hypothesis from \ref hyp_seq, -1 if all hypotheses are failed
+ * \param[out] finished flag whether decision is made: \p hyp_num is approved or all hypotheses are failed
+ * \return \ref RES_OK on success error otherwise
+ */
+static uint8_t __sniffer_rs232_params_raw_step(enum rs232_channel_type channel_type, struct raw_check_ctx *tx_check,
+                                               struct raw_check_ctx *rx_check, int8_t *hyp_num, bool *finished)
+{
+    *hyp_num = -1;
+    *finished = true;
+
+    if (channel_type != RS232_CHANNEL_RX)
+        __sniffer_rs232_uart_receive(BSP_UART_TYPE_RS232_TX, &tx_check->uart, tx_check);
+
+    if (channel_type != RS232_CHANNEL_TX)
+        __sniffer_rs232_uart_receive(BSP_UART_TYPE_RS232_RX, &rx_check->uart, rx_check);
+
+    if (tx_check->uart.overflow || rx_check->uart.overflow)
+        return RES_OVERFLOW;
+
+    /* Result processing */
+    for (uint8_t i = 0; i < ARRAY_SIZE(hyp_seq); i++) {
+        if (hyp_seq[i].wordlen == BSP_UART_WORDLEN_9) {
+            tx_check->hyp[i].error_frame_cnt = tx_check->uart.error_frame_cnt;
+            rx_check->hyp[i].error_frame_cnt = rx_check->uart.error_frame_cnt;
+        }
+
+        enum hyp_status status = __sniffer_rs232_hyp_status(channel_type, &tx_check->hyp[i], &rx_check->hyp[i]);
+
+        if (status == HYP_FAILED)
+            continue;
+
+        *hyp_num = (int8_t)i;
+        *finished = (status == HYP_APPROVED);
+        break;
+    }
+
+    return RES_OK;
+}
+
+/** Update of the best candidate of the algorithm calculation by hypotheses of the current stage
+ * 
+ * \param[in,out] calc context of the algorithm calculation
+ */
+static void __sniffer_rs232_calc_candidate_update(struct calc_ctx *calc)
+{
+    if (calc->stage == SNIFFER_RS232_STAGE_DECODE) {
+        for (uint8_t i = 0; i < ARRAY_SIZE(frame_hyp_seq); i++) {
+            if (!__sniffer_rs232_hyp_receivable(&frame_hyp_seq[i], &calc->tx_dec.hyp[i], &calc->rx_dec.hyp[i]))
+                continue;
+
+            __sniffer_rs232_candidate_update(&calc->candidate, calc->channel_type, calc->baudrate, &frame_hyp_seq[i],
+                                             &calc->tx_dec.hyp[i].check, &calc->rx_dec.hyp[i].check);
+        }
+    } else if (calc->stage == SNIFFER_RS232_STAGE_RAW_PARAMS) {
+        for (uint8_t i = 0; i < ARRAY_SIZE(hyp_seq); i++) {
+            const struct frame_hyp_ctx hyp = {hyp_seq[i].wordlen, hyp_seq[i].parity, BSP_UART_STOPBITS_1};
+            __sniffer_rs232_candidate_update(&calc->candidate, calc->params_channel_type, calc->baudrate, &hyp,
+                                             &calc->tx_raw.hyp[i], &calc->rx_raw.hyp[i]);
+        }
+    } else if (calc->stage == SNIFFER_RS232_STAGE_PARAMS && calc->hyp_num >= 0) {
+        const struct frame_hyp_ctx hyp = {hyp_seq[calc->hyp_num].wordlen, hyp_seq[calc->hyp_num].parity, BSP_UART_STOPBITS_1};
+        __sniffer_rs232_candidate_update(&calc->candidate, calc->params_channel_type, calc->baudrate, &hyp,
+                                         &calc->tx_check, &calc->rx_check);
+    }
+}
+
+/** Release of hardware resources of the current stage of the algorithm calculation
+ * 
+ * \param[in,out] calc context of the algorithm calculation
+ * \return \ref RES_OK on success error otherwise
+ */
+static uint8_t __sniffer_rs232_calc_stop(struct calc_ctx *calc)
+{
+    uint8_t res = RES_OK;
+
+    switch (calc->stage) {
+    case SNIFFER_RS232_STAGE_BAUDRATE:
+        __sniffer_rs232_baudrate_calc_stop(calc->channel_type, &calc->tx_ctx, &calc->rx_ctx, 0);
+        break;
+
+    case SNIFFER_RS232_STAGE_DECODE:
+        __sniffer_rs232_baudrate_calc_stop(calc->channel_type, &calc->tx_ctx, &calc->rx_ctx, calc->baudrate);
+        break;
+
+    case SNIFFER_RS232_STAGE_RAW_PARAMS:
+    case SNIFFER_RS232_STAGE_PARAMS:
+        res = __sniffer_rs232_uart_check_stop(calc->params_channel_type);
+
+        uint8_t __res = __sniffer_rs232_uart_deinit(calc->params_channel_type);
+        res = (res == RES_OK) ? __res : res;
+        break;
+
+    default:
+        break;
+    }
+
+    return res;
+}
+
+/** Finish of the algorithm calculation
+ * 
+ * Approved hypothesis becomes the best candidate of the calculation, evidence  
+ * of hypothesis approved without UART words (e.g. LIN detection) is approval threshold
+ * 
+ * \param[in,out] calc context of the algorithm calculation
+ * \param[in] res result of the calculation
+ * \param[in] hyp UART parameters of approved (or accepted on timeout) hypothesis, NULL if the calculation failed
+ */
+static void __sniffer_rs232_calc_finish(struct calc_ctx *calc, uint8_t res, const struct frame_hyp_ctx *hyp)
+{
+    memset(&calc->result, 0, sizeof(calc->result));
+
+    if (hyp) {
+        calc->result.baudrate = calc->baudrate;
+        calc->result.wordlen = hyp->wordlen;
+        calc->result.parity = hyp->parity;
+        calc->result.stopbits = hyp->stopbits;
+    }
+
+    if (hyp && !calc->timeout) {
+        struct calc_candidate *candidate = &calc->candidate;
+
+        if (candidate->baudrate != calc->baudrate || memcmp(&candidate->hyp, hyp, sizeof(*hyp)))
+            *candidate = (struct calc_candidate){.baudrate = calc->baudrate, .hyp = *hyp, .llr = sprt.approve};
+
+        candidate->approved = true;
+    }
+
+    calc->res = res;
+    calc->stage = SNIFFER_RS232_STAGE_DONE;
+}
+
+/** Start of the next attempt of the algorithm calculation
+ * 
+ * The calculation is finished without result if all sniffer_rs232_config::calc_attempts have been tried
+ * 
+ * \param[in,out] calc context of the algorithm calculation
+ * \param[in] first flag whether the first attempt is started
+ * \return \ref RES_OK on success error otherwise
+ */
+static uint8_t __sniffer_rs232_calc_attempt_start(struct calc_ctx *calc, bool first)
+{
+    calc->attempt = first ? 0 : (calc->attempt + 1);
+
+    if (calc->attempt >= config.calc_attempts) {
+        __sniffer_rs232_calc_finish(calc, RES_OK, NULL);
+        return RES_OK;
+    }
+
+    calc->baudrate = 0;
+    calc->hyp_num = -1;
+    calc->stage = SNIFFER_RS232_STAGE_BAUDRATE;
+    calc->start_time = HAL_GetTick();
+
+    return __sniffer_rs232_baudrate_calc_start(calc->channel_type, &calc->tx_ctx, &calc->rx_ctx);
+}
+
+/** Start of parameter part of the algorithm calculation in UART mode
+ * 
+ * \param[in,out] calc context of the algorithm calculation
+ * \return \ref RES_OK on success error otherwise
+ */
+static uint8_t __sniffer_rs232_calc_params_start(struct calc_ctx *calc)
+{
+    /* Evidence is carried over only between attempts with the same baudrate */
+    for (enum uart_type type = BSP_UART_TYPE_RS232_TX; type < BSP_UART_TYPE_MAX; type++) {
+        if (!__sniffer_rs232_calc_line_is_used(calc, type) || calc->baudrate == hyp_evidence_baudrate[type])
+            continue;
+
+        memset(hyp_evidence[type], 0, sizeof(hyp_evidence[type]));
+        hyp_evidence_baudrate[type] = calc->baudrate;
+    }
+
+    calc->hyp_num = 0;
+    calc->stage = SNIFFER_RS232_STAGE_PARAMS;
+    calc->start_time = HAL_GetTick();
+
+    return __sniffer_rs232_params_hyp_start(calc->params_channel_type, calc->baudrate, calc->hyp_num, &calc->tx_check, &calc->rx_check);
+}
+
+/** Finish of baudrate part of the algorithm calculation
+ * 
+ * The function starts the next attempt if baudrate is not calculated, finishes the calculation  
+ * if frame format is approved by LIN detection or software decoding, otherwise starts parameter part
+ * 
+ * \param[in,out] calc context of the algorithm calculation
+ * \param[in] lin_detected flag whether LIN protocol is detected
+ * \param[in] frame_hyp_num number of hypothesis from \ref frame_hyp_seq approved by software decoding, -1 if not approved
+ * \return \ref RES_OK on success error otherwise
+ */
+static uint8_t __sniffer_rs232_calc_baudrate_finish(struct calc_ctx *calc, bool lin_detected, int8_t frame_hyp_num)
+{
+    if (!calc->baudrate) {
+        /* Further attempts on absent or inverted lines make no sense */
+        bool lines_failed = true;
+
+        for (enum uart_type type = BSP_UART_TYPE_RS232_TX; type < BSP_UART_TYPE_MAX; type++) {
+            if (__sniffer_rs232_calc_line_is_used(calc, type))
+                lines_failed &= (baud_info[type].line_state == SNIFFER_RS232_LINE_ABSENT ||
+                                 baud_info[type].line_state == SNIFFER_RS232_LINE_INVERTED);
+        }
+
+        if (lines_failed) {
+            __sniffer_rs232_calc_finish(calc, RES_OK, NULL);
+            return RES_OK;
+        }
+
+        return __sniffer_rs232_calc_attempt_start(calc, false);
+    }
+
+    /* Line without captured IDLE level would fail hypotheses on both lines, so it is excluded */
+    calc->params_channel_type = calc->channel_type;
+
+    if (calc->channel_type == RS232_CHANNEL_ANY) {
+        if (baud_info[BSP_UART_TYPE_RS232_TX].line_state != SNIFFER_RS232_LINE_NORMAL)
+            calc->params_channel_type = RS232_CHANNEL_RX;
+        else if (baud_info[BSP_UART_TYPE_RS232_RX].line_state != SNIFFER_RS232_LINE_NORMAL)
+            calc->params_channel_type = RS232_CHANNEL_TX;
+    }
+
+    if (config.lin_detection && lin_detected) {
+        const struct frame_hyp_ctx lin_hyp = {BSP_UART_WORDLEN_8, BSP_UART_PARITY_NONE, BSP_UART_STOPBITS_1};
+        __sniffer_rs232_calc_finish(calc, RES_OK, &lin_hyp);
+        calc->result.lin_enabled = true;
+        return RES_OK;
+    }
+
+    if (frame_hyp_num >= 0) {
+        __sniffer_rs232_calc_finish(calc, RES_OK, &frame_hyp_seq[frame_hyp_num]);
+        return RES_OK;
+    }
+
+    if (!config.raw_params_check)
+        return __sniffer_rs232_calc_params_start(calc);
+
+    calc->stage = SNIFFER_RS232_STAGE_RAW_PARAMS;
+    calc->start_time = HAL_GetTick();
+
+    return __sniffer_rs232_params_raw_start(calc->params_channel_type, calc->baudrate, &calc->tx_raw, &calc->rx_raw);
+}
+
+/** Step of baudrate part of the algorithm calculation
+ * 
+ * Frames captured in baudrate part are decoded in \ref SNIFFER_RS232_STAGE_DECODE  
+ * by the next steps if baudrate is calculated
+ * 
+ * \param[in,out] calc context of the algorithm calculation
+ * \return \ref RES_OK on success error otherwise
+ */
+static uint8_t __sniffer_rs232_calc_baudrate_step(struct calc_ctx *calc)
+{
+    bool finished = false;
+    uint8_t res = __sniffer_rs232_baudrate_calc_step(calc->channel_type, &calc->tx_ctx, &calc->rx_ctx, &calc->baudrate, &finished);
+
+    if (res != RES_OK || !finished)
+        return res;
+
+    bool lin_detected = calc->tx_ctx.lin_detected || calc->rx_ctx.lin_detected;
+
+    /* Parameter part over the same capture */
+    if (calc->baudrate && config.capture_type != RS232_CAPTURE_EXTI_STREAM && !(config.lin_detection && lin_detected)) {
+        calc->stage = SNIFFER_RS232_STAGE_DECODE;
+        calc->start_time = calc->edge_time = HAL_GetTick();
+
+        __sniffer_rs232_frames_decode_start(calc->channel_type, &calc->tx_ctx, &calc->rx_ctx, calc->baudrate, &calc->tx_dec, &calc->rx_dec);
+        return RES_OK;
+    }
+
+    __sniffer_rs232_baudrate_calc_stop(calc->channel_type, &calc->tx_ctx, &calc->rx_ctx, calc->baudrate);
+
+    return __sniffer_rs232_calc_baudrate_finish(calc, lin_detected, -1);
+}
+
+/** Step of parameter part of the algorithm calculation by software decoding
+ * 
+ * \param[in,out] calc context of the algorithm calculation
+ * \return \ref RES_OK on success error otherwise
+ */
+static uint8_t __sniffer_rs232_calc_decode_step(struct calc_ctx *calc)
+{
+    bool finished = false;
+    int8_t frame_hyp_num = -1;
+
+    __sniffer_rs232_frames_decode_step(calc->channel_type, &calc->tx_ctx, &calc->rx_ctx, &calc->tx_dec, &calc->rx_dec,
+                                       &calc->edge_time, &frame_hyp_num, &finished);
+
+    if (!finished)
+        return RES_OK;
+
+    /* Evidence of inconclusive decoding is kept as well */
+    __sniffer_rs232_calc_candidate_update(calc);
+
+    __sniffer_rs232_baudrate_calc_stop(calc->channel_type, &calc->tx_ctx, &calc->rx_ctx, calc->baudrate);
+
+    return __sniffer_rs232_calc_baudrate_finish(calc, calc->tx_ctx.lin_detected || calc->rx_ctx.lin_detected, frame_hyp_num);
+}
+
+/** Step of parameter part of the algorithm calculation over raw words
+ * 
+ * \param[in,out] calc context of the algorithm calculation
+ * \return \ref RES_OK on success error otherwise
+ */
+static uint8_t __sniffer_rs232_calc_raw_params_step(struct calc_ctx *calc)
+{
+    bool finished = false;
+    uint8_t res = __sniffer_rs232_params_raw_step(calc->params_channel_type, &calc->tx_raw, &calc->rx_raw, &calc->hyp_num, &finished);
+
+    if (res != RES_OK || !finished)
+        return res;
+
+    __sniffer_rs232_calc_candidate_update(calc);
+
+    res = __sniffer_rs232_calc_stop(calc);
+
+    if (res != RES_OK)
+        return res;
+
+    if (calc->hyp_num < 0)
+        return __sniffer_rs232_calc_params_start(calc);
+
+    const struct frame_hyp_ctx hyp = {hyp_seq[calc->hyp_num].wordlen, hyp_seq[calc->hyp_num].parity, BSP_UART_STOPBITS_1};
+    __sniffer_rs232_calc_finish(calc, RES_OK, &hyp);
+
+    return RES_OK;
+}
+
+/** Step of parameter part of the algorithm calculation in UART mode
+ * 
+ * \param[in,out] calc context of the algorithm calculation
+ * \return \ref RES_OK on success error otherwise
+ */
+static uint8_t __sniffer_rs232_calc_params_step(struct calc_ctx *calc)
+{
+    enum hyp_status status = HYP_PENDING;
+    uint8_t res = __sniffer_rs232_uart_check_step(calc->params_channel_type, &calc->tx_check, &calc->rx_check, &status);
+
+    if (res != RES_OK || status == HYP_PENDING)
+        return res;
+
+    res = __sniffer_rs232_uart_check_stop(calc->params_channel_type);
+
+    if (res != RES_OK)
+        return res;
+
+    __sniffer_rs232_calc_candidate_update(calc);
+
+    int8_t next_hyp_num = __sniffer_rs232_params_hyp_next(calc->params_channel_type, calc->hyp_num, &calc->tx_check, &calc->rx_check);
+
+    if (status == HYP_APPROVED || !next_hyp_num) {
+        res = __sniffer_rs232_uart_deinit(calc->params_channel_type);
+
+        if (res != RES_OK)
+            return res;
+
+        if (status != HYP_APPROVED)
+            return __sniffer_rs232_calc_attempt_start(calc, false);
+
+        const struct frame_hyp_ctx hyp = {hyp_seq[calc->hyp_num].wordlen, hyp_seq[calc->hyp_num].parity, BSP_UART_STOPBITS_1};
+        __sniffer_rs232_calc_finish(calc, RES_OK, &hyp);
+
+        return RES_OK;
+    }
+
+    calc->hyp_num = next_hyp_num;
+    calc->start_time = HAL_GetTick();
+
+    return __sniffer_rs232_params_hyp_start(calc->params_channel_type, calc->baudrate, calc->hyp_num, &calc->tx_check, &calc->rx_check);
+}
+
+/* Valid value range of items from algorithm settings, see header file for details */
+uint32_t sniffer_rs232_config_item_range(uint32_t shift, bool is_min)
+{
+    if (shift == offsetof(struct sniffer_rs232_config, valid_packets_count))
+        return is_min ? 1 : UINT32_MAX;
+    else if (shift == offsetof(struct sniffer_rs232_config, uart_error_count))
+        return is_min ? 1 : UINT32_MAX;
+    else if (shift == offsetof(struct sniffer_rs232_config, baudrate_tolerance))
+        return is_min ? 1 : 100;
+    else if (shift == offsetof(struct sniffer_rs232_config, min_detect_bits))
+        return is_min ? 1 : (UINT32_MAX / 4);
+    else if (shift == offsetof(struct sniffer_rs232_config, exec_timeout))
+        return is_min ? 1 : UINT32_MAX;
+    else if (shift == offsetof(struct sniffer_rs232_config, calc_attempts))
+        return is_min ? 1 : UINT32_MAX;
+    else if (shift == offsetof(struct sniffer_rs232_config, hyp_confidence))
+        return is_min ? 80 : 99;
+    else if (shift == offsetof(struct sniffer_rs232_config, verify_timeout))
+        return is_min ? 0 : 10000;
+    else if (shift == offsetof(struct sniffer_rs232_config, glitch_filter))
+        return is_min ? 0 : 500;
+    else if (shift == offsetof(struct sniffer_rs232_config, timeout_confidence))
+        return is_min ? 0 : 99;
+
+    return 0;
+}
+
+/* Check algorithm settings, see header file for details */
+bool sniffer_rs232_config_check(struct sniffer_rs232_config *__config)
+{
+    if (!__config)
+        return false;
+
+    if (!RS232_CHANNEL_TYPE_VALID(__config->channel_type))
+        return false;
+
+    if (!RS232_BAUDRATE_CALC_TYPE_VALID(__config->baudrate_calc_type))
+        return false;
+
+    if (!RS232_CAPTURE_TYPE_VALID(__config->capture_type))
+        return false;
+
+    if (!RS232_HYP_CHECK_TYPE_VALID(__config->hyp_check_type))
+        return false;
+
+    for (uint32_t i = 0; i < SNIFFER_RS232_USER_BAUDRATES; i++) {
+        uint32_t baudrate = __config->user_baudrates[i];
+
+        uint32_t baudrate_max = __config->high_resolution ? SNIFFER_RS232_BAUDRATE_HIGH_MAX : SNIFFER_RS232_BAUDRATE_MAX;
+
+        if (baudrate && (baudrate < SNIFFER_RS232_BAUDRATE_MIN || baudrate > baudrate_max))
+            return false;
+    }
+
+    if (!SNIFFER_RS232_CFG_PARAM_IS_VALID(valid_packets_count, __config->valid_packets_count))
+        return false;
+
+    if (!SNIFFER_RS232_CFG_PARAM_IS_VALID(uart_error_count, __config->uart_error_count))
+        return false;
+
+    if (!SNIFFER_RS232_CFG_PARAM_IS_VALID(baudrate_tolerance, __config->baudrate_tolerance))
+        return false;
+
+    if (!SNIFFER_RS232_CFG_PARAM_IS_VALID(min_detect_bits, __config->min_detect_bits))
+        return false;
+
+    if (!SNIFFER_RS232_CFG_PARAM_IS_VALID(exec_timeout, __config->exec_timeout))
+        return false;
+
+    if (!SNIFFER_RS232_CFG_PARAM_IS_VALID(calc_attempts, __config->calc_attempts))
+        return false;
+
+    if (!SNIFFER_RS232_CFG_PARAM_IS_VALID(hyp_confidence, __config->hyp_confidence))
+        return false;
+
+    if (!SNIFFER_RS232_CFG_PARAM_IS_VALID(verify_timeout, __config->verify_timeout))
+        return false;
+
+    if (!SNIFFER_RS232_CFG_PARAM_IS_VALID(glitch_filter, __config->glitch_filter))
+        return false;
+
+    if (!SNIFFER_RS232_CFG_PARAM_IS_VALID(timeout_confidence, __config->timeout_confidence))
+        return false;
+
+    /* Glitch filter should not remove bits at maximum baudrate */
+    uint32_t baudrate_max = __config->high_resolution ? SNIFFER_RS232_BAUDRATE_HIGH_MAX : SNIFFER_RS232_BAUDRATE_MAX;
+    if ((uint64_t)__config->glitch_filter * 2 * baudrate_max >= 1000000000)
+        return false;
+
+    return true;
+}
+
+/** EXTI configuration of RS-232 lines
+ * 
+ * The function configures both edges triggering of EXTI lines of RS-232 lines,  
+ * configuration is independent of GPIO mode so it is kept while UART owns the pins  
+ * \note The configuration is cleared by HAL_GPIO_DeInit
+ */
+static void __sniffer_rs232_exti_init(void)
+{
+    EXTI_ConfigTypeDef exti_config = {0};
+
+    exti_config.Line            = hexti1.Line;
+    exti_config.Mode            = EXTI_MODE_INTERRUPT;
+    exti_config.Trigger         = EXTI_TRIGGER_RISING_FALLING;
+    exti_config.GPIOSel         = EXTI_GPIOA;
+
+    HAL_EXTI_SetConfigLine(&hexti1, &exti_config);
+    HAL_EXTI_ClearPending(&hexti1, EXTI_TRIGGER_RISING_FALLING);
+
+    exti_config.Line            = hexti2.Line;
+    exti_config.GPIOSel         = EXTI_GPIOC;
+
+    HAL_EXTI_SetConfigLine(&hexti2, &exti_config);
+    HAL_EXTI_ClearPending(&hexti2, EXTI_TRIGGER_RISING_FALLING);
+}
+
+/* Algorithm initialization, see header file for details */
+uint8_t sniffer_rs232_init(struct sniffer_rs232_config *__config)
+{
+    if (!sniffer_rs232_config_check(__config))
+        return RES_INVALID_PAR;
+
+    config = *__config;
+
+    /* RCC GPIO init */
+    if (__HAL_RCC_GPIOA_IS_CLK_DISABLED())
+        __HAL_RCC_GPIOA_CLK_ENABLE();
+
+    if (__HAL_RCC_GPIOC_IS_CLK_DISABLED())
+        __HAL_RCC_GPIOC_CLK_ENABLE();
+
+    /* EXTI configuration */
+    __sniffer_rs232_exti_init();
+
+    /* NVIC configuration */
+    HAL_NVIC_ClearPendingIRQ(EXTI3_IRQn);
+    HAL_NVIC_SetPriority(EXTI3_IRQn, 4, 0);
+
+    HAL_NVIC_ClearPendingIRQ(EXTI9_5_IRQn);
+    HAL_NVIC_SetPriority(EXTI9_5_IRQn, 4, 0);
+
+    /* Timer init & start */
+    HAL_TIM_RegisterCallback(&alg_tim, HAL_TIM_BASE_MSPINIT_CB_ID, __sniffer_rs232_tim_msp_init);
+    HAL_TIM_RegisterCallback(&alg_tim, HAL_TIM_BASE_MSPDEINIT_CB_ID, __sniffer_rs232_tim_msp_deinit);
+
+    /* In high resolution mode the timer runs at full clock, otherwise its resolution depends on the tolerance */
+    if (config.high_resolution)
+        alg_tim.Init.Prescaler = 0;
+    else
+        alg_tim.Init.Prescaler = bsp_rcc_apb_timer_freq_get(alg_tim.Instance) / (1000000 * config.baudrate_tolerance) - 1;
+
+    alg_tim_freq = bsp_rcc_apb_timer_freq_get(alg_tim.Instance) / (alg_tim.Init.Prescaler + 1);
+
+    __sniffer_rs232_baud_windows_init();
+    __sniffer_rs232_sprt_init();
+
+    stream_min_len = __sniffer_rs232_len_bit_get(__sniffer_rs232_baudrate_max_get(), 100 + config.baudrate_tolerance) >> LEN_FRAC_BITS;
+
+    glitch_min_len = (uint32_t)(((uint64_t)config.glitch_filter * alg_tim_freq + 500000000) / 1000000000);
+    if (config.glitch_filter && !glitch_min_len)
+        glitch_min_len = 1;
+
+    alg_tim.Init.Period = UINT32_MAX;
+    alg_tim.Init.CounterMode = TIM_COUNTERMODE_UP;
+    alg_tim.Init.ClockDivision = TIM_CLOCKDIVISION_DIV1;
+    alg_tim.Init.RepetitionCounter = 0;
+    alg_tim.Init.AutoReloadPreload = TIM_AUTORELOAD_PRELOAD_DISABLE;
+    if (HAL_TIM_Base_Init(&alg_tim) != HAL_OK)
+        return RES_NOK;
+
+    if (config.capture_type == RS232_CAPTURE_TIM_DMA) {
+        /* DMA init */
+        if (__HAL_RCC_DMA1_IS_CLK_DISABLED())
+            __HAL_RCC_DMA1_CLK_ENABLE();
+
+        alg_hdma.Init.Channel               = DMA_CHANNEL_6;
+        alg_hdma.Init.Direction             = DMA_PERIPH_TO_MEMORY;
+        alg_hdma.Init.PeriphInc             = DMA_PINC_DISABLE;
+        alg_hdma.Init.MemInc                = DMA_MINC_ENABLE;
+        alg_hdma.Init.PeriphDataAlignment   = DMA_PDATAALIGN_WORD;
+        alg_hdma.Init.MemDataAlignment      = DMA_MDATAALIGN_WORD;
+        alg_hdma.Init.Mode                  = DMA_NORMAL;
+        alg_hdma.Init.Priority              = DMA_PRIORITY_VERY_HIGH;
+        alg_hdma.Init.FIFOMode              = DMA_FIFOMODE_DISABLE;
+        alg_hdma.Init.FIFOThreshold         = DMA_FIFO_THRESHOLD_FULL;
+        alg_hdma.Init.MemBurst              = DMA_MBURST_SINGLE;
+        alg_hdma.Init.PeriphBurst           = DMA_PBURST_SINGLE;
+
+        if (HAL_DMA_Init(&alg_hdma) != HAL_OK)
+            return RES_NOK;
+
+        __HAL_LINKDMA(&alg_tim, hdma[TIM_DMA_ID_CC4], alg_hdma);
+
+        HAL_NVIC_SetPriority(DMA1_Stream3_IRQn, 4, 0);
+        HAL_NVIC_EnableIRQ(DMA1_Stream3_IRQn);
+
+        /* Input capture of both edges on TIM5 CH4 (RS-232 TX line) */
+        if (HAL_TIM_IC_Init(&alg_tim) != HAL_OK)
+            return RES_NOK;
+
+        TIM_IC_InitTypeDef ic_config = {0};
+        ic_config.ICPolarity = TIM_INPUTCHANNELPOLARITY_BOTHEDGE;
+        ic_config.ICSelection = TIM_ICSELECTION_DIRECTTI;
+        ic_config.ICPrescaler = TIM_ICPSC_DIV1;
+        ic_config.ICFilter = 0;
+
+        /* The longest input filter of the timer not exceeding the glitch filter */
+        uint32_t filter_len = (uint32_t)(((uint64_t)config.glitch_filter * bsp_rcc_apb_timer_freq_get(alg_tim.Instance)) / 1000000000);
+        for (uint32_t i = 0; i < ARRAY_SIZE(tim_ic_filters); i++) {
+            if (tim_ic_filters[i].div * tim_ic_filters[i].n <= filter_len)
+                ic_config.ICFilter = i + 1;
+        }
+
+        if (HAL_TIM_IC_ConfigChannel(&alg_tim, &ic_config, TIM_CHANNEL_4) != HAL_OK)
+            return RES_NOK;
+    }
+
+    if (HAL_TIM_Base_Start(&alg_tim) != HAL_OK)
+        return RES_NOK;
+
+    return RES_OK;
+}
+
+/* Algorithm deinitialization, see header file for details */
+uint8_t sniffer_rs232_deinit(void)
+{
+    uint8_t res = sniffer_rs232_calc_cancel();
+
+    if (res != RES_OK)
+        return res;
+
+    res = sniffer_rs232_drift_stop();
+
+    if (res != RES_OK)
+        return res;
+
+    if (HAL_TIM_Base_Stop(&alg_tim) != HAL_OK)
+        return RES_NOK;
+
+    if (HAL_TIM_Base_DeInit(&alg_tim) != HAL_OK)
+        return RES_NOK;
+
+    HAL_NVIC_DisableIRQ(EXTI3_IRQn);
+    HAL_NVIC_DisableIRQ(EXTI9_5_IRQn);
+
+    if (alg_tim.hdma[TIM_DMA_ID_CC4]) {
+        HAL_NVIC_DisableIRQ(DMA1_Stream3_IRQn);
+
+        if (HAL_DMA_DeInit(&alg_hdma) != HAL_OK)
+            return RES_NOK;
+
+        alg_tim.hdma[TIM_DMA_ID_CC4] = NULL;
+    }
+
+    HAL_GPIO_DeInit(GPIOA, GPIO_PIN_3);
+    HAL_GPIO_DeInit(GPIOC, GPIO_PIN_5);
+
+    memset(tx_buffer, 0, sizeof(tx_buffer));
+    memset(rx_buffer, 0, sizeof(rx_buffer));
+    tx_cnt = rx_cnt = 0;
+    memset(&tx_glitch, 0, sizeof(tx_glitch));
+    memset(&rx_glitch, 0, sizeof(rx_glitch));
+
+    return RES_OK;
+}
+
+/* Algorithm calculation, see header file for details */
+uint8_t sniffer_rs232_calc(struct uart_init_ctx *tx_params, struct uart_init_ctx *rx_params)
+{
+    if (!tx_params || !rx_params)
+        return RES_INVALID_PAR;
+
+    memset(tx_params, 0, sizeof(struct uart_init_ctx));
+    memset(rx_params, 0, sizeof(struct uart_init_ctx));
+
+    uint8_t res = sniffer_rs232_calc_start();
+    bool finished = false;
+
+    while (res == RES_OK && !finished)
+        res = sniffer_rs232_calc_step(&finished);
+
+    if (res != RES_OK)
+        return res;
+
+    res = sniffer_rs232_calc_result_get(BSP_UART_TYPE_RS232_TX, tx_params);
+
+    if (res != RES_OK)
+        return res;
+
+    return sniffer_rs232_calc_result_get(BSP_UART_TYPE_RS232_RX, rx_params);
+}
+
+/** Cancel of the algorithm calculation by the context
+ * 
+ * \param[in,out] calc context of the algorithm calculation
+ * \return \ref RES_OK on success error otherwise
+ */
+static uint8_t __sniffer_rs232_calc_cancel(struct calc_ctx *calc)
+{
+    uint8_t res = __sniffer_rs232_calc_stop(calc);
+    calc->stage = SNIFFER_RS232_STAGE_IDLE;
+
+    return res;
+}
+
+/** Start of the algorithm calculation executed by steps
+ * 
+ * The function (re-)starts the calculation by context of one RS-232 line,  
+ * context of the other line is not touched
+ * 
+ * \param[in,out] calc context of the algorithm calculation
+ * \param[in] channel_type RS-232 channel detection type, \ref RS232_CHANNEL_ALL is not allowed
+ * \return \ref RES_OK on success error otherwise
+ */
+static uint8_t __sniffer_rs232_calc_start(struct calc_ctx *calc, enum rs232_channel_type channel_type)
+{
+    uint8_t res = __sniffer_rs232_calc_cancel(calc);
+
+    if (res != RES_OK)
+        return res;
+
+    /* Drift tracking shares statistics of widths and EXTI interrupts */
+    res = sniffer_rs232_drift_stop();
+
+    if (res != RES_OK)
+        return res;
+
+    calc->channel_type = calc->params_channel_type = channel_type;
+    calc->timeout = false;
+    memset(&calc->result, 0, sizeof(calc->result));
+    memset(&calc->candidate, 0, sizeof(calc->candidate));
+
+    for (enum uart_type type = BSP_UART_TYPE_RS232_TX; type < BSP_UART_TYPE_MAX; type++) {
+        if (!__sniffer_rs232_calc_line_is_used(calc, type))
+            continue;
+
+        memset(&baud_info[type], 0, sizeof(baud_info[type]));
+        memset(hyp_evidence[type], 0, sizeof(hyp_evidence[type]));
+        hyp_evidence_baudrate[type] = 0;
+    }
+
+    res = __sniffer_rs232_calc_attempt_start(calc, true);
+
+    if (res != RES_OK) {
+        __sniffer_rs232_calc_stop(calc);
+        __sniffer_rs232_calc_finish(calc, res, NULL);
+    }
+
+    return res;
+}
+
+/* Start of the algorithm calculation executed by steps, see header file for details */
+uint8_t sniffer_rs232_calc_start(void)
+{
+    uint8_t res = sniffer_rs232_calc_cancel();
+
+    if (res != RES_OK)
+        return res;
+
+    if (config.channel_type != RS232_CHANNEL_ALL) {
+        enum uart_type type = (config.channel_type == RS232_CHANNEL_RX) ? BSP_UART_TYPE_RS232_RX : BSP_UART_TYPE_RS232_TX;
+        return __sniffer_rs232_calc_start(&calcs[type], config.channel_type);
+    }
+
+    /* Lines are calculated concurrently, each one with its own parameters */
+    res = __sniffer_rs232_calc_start(&calcs[BSP_UART_TYPE_RS232_TX], RS232_CHANNEL_TX);
+
+    if (res != RES_OK)
+        return res;
+
+    res = __sniffer_rs232_calc_start(&calcs[BSP_UART_TYPE_RS232_RX], RS232_CHANNEL_RX);
+
+    if (res != RES_OK)
+        sniffer_rs232_calc_cancel();
+
+    return res;
+}
+
+/* Start of the algorithm calculation on one RS-232 line, see header file for details */
+uint8_t sniffer_rs232_line_calc_start(enum uart_type type)
+{
+    if (type != BSP_UART_TYPE_RS232_TX && type != BSP_UART_TYPE_RS232_RX)
+        return RES_INVALID_PAR;
+
+    /* Calculation on both lines at once uses the line as well */
+    struct calc_ctx *tx_calc = &calcs[BSP_UART_TYPE_RS232_TX];
+
+    if (tx_calc->channel_type == RS232_CHANNEL_ANY) {
+        uint8_t res = __sniffer_rs232_calc_cancel(tx_calc);
+
+        if (res != RES_OK)
+            return res;
+    }
+
+    return __sniffer_rs232_calc_start(&calcs[type], (type == BSP_UART_TYPE_RS232_TX) ? RS232_CHANNEL_TX : RS232_CHANNEL_RX);
+}
+
+/** Finish of the algorithm calculation by sniffer_rs232_config::exec_timeout
+ * 
+ * Timeout is not an error: the best candidate of UART parameters becomes the result  
+ * if its confidence reaches sniffer_rs232_config::timeout_confidence, otherwise the calculation  
+ * is finished without result, the candidate is available by \ref sniffer_rs232_candidate_get anyway
+ * 
+ * \param[in,out] calc context of the algorithm calculation
+ * \return \ref RES_OK on success error otherwise
+ */
+static uint8_t __sniffer_rs232_calc_timeout(struct calc_ctx *calc)
+{
+    __sniffer_rs232_calc_candidate_update(calc);
+    uint8_t res = __sniffer_rs232_calc_stop(calc);
+
+    const struct calc_candidate *candidate = &calc->candidate;
+    bool accepted = config.timeout_confidence && (__sniffer_rs232_candidate_confidence(candidate) >= config.timeout_confidence);
+
+    calc->timeout = true;
+
+    if (accepted)
+        calc->baudrate = candidate->baudrate;
+
+    __sniffer_rs232_calc_finish(calc, res, accepted ? &candidate->hyp : NULL);
+
+    return res;
+}
+
+/** Step of the algorithm calculation by the context
+ * 
+ * \param[in,out] calc context of the algorithm calculation
+ * \return \ref RES_OK on success error otherwise
+ */
+static uint8_t __sniffer_rs232_calc_step(struct calc_ctx *calc)
+{
+    uint8_t res = RES_OK;
+
+    if ((HAL_GetTick() - calc->start_time) > 1000 * config.exec_timeout)
+        return __sniffer_rs232_calc_timeout(calc);
+
+    switch (calc->stage) {
+    case SNIFFER_RS232_STAGE_BAUDRATE:
+        res = __sniffer_rs232_calc_baudrate_step(calc);
+        break;
+
+    case SNIFFER_RS232_STAGE_DECODE:
+        res = __sniffer_rs232_calc_decode_step(calc);
+        break;
+
+    case SNIFFER_RS232_STAGE_RAW_PARAMS:
+        res = __sniffer_rs232_calc_raw_params_step(calc);
+        break;
+
+    case SNIFFER_RS232_STAGE_PARAMS:
+        res = __sniffer_rs232_calc_params_step(calc);
+        break;
+
+    default:
+        break;
+    }
+
+    if (res != RES_OK) {
+        __sniffer_rs232_calc_stop(calc);
+        __sniffer_rs232_calc_finish(calc, res, NULL);
+    }
+
+    return res;
+}
+
+/* Step of the algorithm calculation, see header file for details */
+uint8_t sniffer_rs232_calc_step(bool *finished)
+{
+    if (!finished)
+        return RES_INVALID_PAR;
+
+    *finished = true;
+    uint8_t res = RES_OK;
+    bool started = false;
+
+    for (enum uart_type type = BSP_UART_TYPE_RS232_TX; type < BSP_UART_TYPE_MAX; type++) {
+        struct calc_ctx *calc = &calcs[type];
+        uint8_t __res = RES_OK;
+
+        switch (calc->stage) {
+        case SNIFFER_RS232_STAGE_IDLE:
+            continue;
+
+        case SNIFFER_RS232_STAGE_DONE:
+            __res = calc->res;
+            break;
+
+        default:
+            __res = __sniffer_rs232_calc_step(calc);
+            break;
+        }
+
+        started = true;
+        res = (res == RES_OK) ? __res : res;
+        *finished = *finished && (calc->stage == SNIFFER_RS232_STAGE_DONE);
+    }
+
+    if (!started) {
+        *finished = false;
+        return RES_NOT_ALLOWED;
+    }
+
+    return res;
+}
+
+/* Cancel of the algorithm calculation, see header file for details */
+uint8_t sniffer_rs232_calc_cancel(void)
+{
+    uint8_t res = RES_OK;
+
+    for (enum uart_type type = BSP_UART_TYPE_RS232_TX; type < BSP_UART_TYPE_MAX; type++) {
+        uint8_t __res = __sniffer_rs232_calc_cancel(&calcs[type]);
+        res = (res == RES_OK) ? __res : res;
+    }
+
+    return res;
+}
+
+/* Progress of the algorithm calculation, see header file for details */
+uint8_t sniffer_rs232_calc_progress_get(enum uart_type type, struct sniffer_rs232_progress *progress)
+{
+    if (!progress || (type != BSP_UART_TYPE_RS232_TX && type != BSP_UART_TYPE_RS232_RX))
+        return RES_INVALID_PAR;
+
+    struct calc_ctx *calc = __sniffer_rs232_line_calc_get(type);
+
+    memset(progress, 0, sizeof(struct sniffer_rs232_progress));
+    progress->stage = calc->stage;
+
+    if (calc->stage == SNIFFER_RS232_STAGE_IDLE || !__sniffer_rs232_calc_line_is_used(calc, type))
+        return RES_OK;
+
+    progress->attempt = calc->attempt + 1;
+    progress->baudrate = calc->baudrate;
+
+    struct baud_calc_ctx *baud_ctx = (type == BSP_UART_TYPE_RS232_TX) ? &calc->tx_ctx : &calc->rx_ctx;
+    struct hyp_check_ctx *check = NULL;
+
+    if (calc->stage == SNIFFER_RS232_STAGE_RAW_PARAMS) {
+        struct raw_check_ctx *raw = (type == BSP_UART_TYPE_RS232_TX) ? &calc->tx_raw : &calc->rx_raw;
+        check = (calc->hyp_num >= 0) ? &raw->hyp[calc->hyp_num] : NULL;
+    } else if (calc->stage == SNIFFER_RS232_STAGE_PARAMS) {
+        check = (type == BSP_UART_TYPE_RS232_TX) ? &calc->tx_check : &calc->rx_check;
+    }
+
+    if (calc->hyp_num >= 0) {
+        progress->wordlen = hyp_seq[calc->hyp_num].wordlen;
+        progress->parity = hyp_seq[calc->hyp_num].parity;
+    }
+
+    if (baud_ctx->stats)
+        progress->edges_cnt = baud_ctx->stats->edges_cnt;
+    else if (baud_ctx->cnt)
+        progress->edges_cnt = __sniffer_rs232_edges_cnt_get(baud_ctx);
+
+    if (check) {
+        progress->valid_cnt = check->valid_cnt;
+        progress->error_parity_cnt = check->error_parity_cnt;
+        progress->error_frame_cnt = check->error_frame_cnt;
+    }
+
+    return RES_OK;
+}
+
+/* Result of the algorithm calculation executed by steps, see header file for details */
+uint8_t sniffer_rs232_calc_result_get(enum uart_type type, struct uart_init_ctx *uart_params)
+{
+    if (!uart_params || (type != BSP_UART_TYPE_RS232_TX && type != BSP_UART_TYPE_RS232_RX))
+        return RES_INVALID_PAR;
+
+    struct calc_ctx *calc = __sniffer_rs232_line_calc_get(type);
+
+    if (calc->stage != SNIFFER_RS232_STAGE_DONE)
+        return RES_NOT_ALLOWED;
+
+    /* Single line detection gives parameters for both lines */
+    *uart_params = calc->result;
+
+    return calc->res;
+}
+
+/* Best candidate of UART parameters of the algorithm calculation, see header file for details */
+uint8_t sniffer_rs232_candidate_get(enum uart_type type, struct sniffer_rs232_candidate *candidate)
+{
+    if (!candidate || (type != BSP_UART_TYPE_RS232_TX && type != BSP_UART_TYPE_RS232_RX))
+        return RES_INVALID_PAR;
+
+    const struct calc_ctx *calc = __sniffer_rs232_line_calc_get(type);
+
+    memset(candidate, 0, sizeof(struct sniffer_rs232_candidate));
+
+    if (!__sniffer_rs232_calc_line_is_used(calc, type) || !calc->candidate.baudrate)
+        return RES_OK;
+
+    candidate->baudrate = calc->candidate.baudrate;
+    candidate->wordlen = calc->candidate.hyp.wordlen;
+    candidate->parity = calc->candidate.hyp.parity;
+    candidate->stopbits = calc->candidate.hyp.stopbits;
+    candidate->confidence = __sniffer_rs232_candidate_confidence(&calc->candidate);
+    candidate->valid_cnt = calc->candidate.valid_cnt;
+    candidate->error_cnt = calc->candidate.error_cnt;
+    candidate->approved = calc->candidate.approved;
+    candidate->timeout = calc->timeout;
+
+    return RES_OK;
+}
+
+/* Verification of known UART parameters, see header file for details */
+uint8_t sniffer_rs232_verify(struct uart_init_ctx *uart_params, bool *tx_verified, bool *rx_verified)
+{
+    if (!uart_params || !tx_verified || !rx_verified || !uart_params->baudrate)
+        return RES_INVALID_PAR;
+
+    *tx_verified = *rx_verified = false;
+
+    if (!config.verify_timeout)
+        return RES_OK;
+
+    struct uart_init_ctx init_ctx = {0};
+    init_ctx.baudrate = uart_params->baudrate;
+    init_ctx.lin_enabled = uart_params->lin_enabled;
+    init_ctx.wordlen = uart_params->wordlen;
+    init_ctx.parity = uart_params->parity;
+    init_ctx.stopbits = uart_params->stopbits;
+
+    struct hyp_check_ctx tx_check_ctx = {0};
+    struct hyp_check_ctx rx_check_ctx = {0};
+    enum hyp_status status = HYP_PENDING;
+
+    uint8_t res = __sniffer_rs232_uart_check(config.channel_type, &init_ctx, config.verify_timeout, &tx_check_ctx, &rx_check_ctx, &status);
+
+    /* Not enough data within the window is not an error */
+    if (res == RES_TIMEOUT)
+        res = RES_OK;
+
+    uint8_t __res = __sniffer_rs232_uart_deinit(config.channel_type);
+    res = (res == RES_OK) ? __res : res;
+
+    if (res != RES_OK)
+        return res;
+
+    if (config.channel_type == RS232_CHANNEL_ALL) {
+        *tx_verified = (__sniffer_rs232_hyp_line_status(&tx_check_ctx) == HYP_APPROVED);
+        *rx_verified = (__sniffer_rs232_hyp_line_status(&rx_check_ctx) == HYP_APPROVED);
+    } else {
+        *tx_verified = *rx_verified = (status == HYP_APPROVED);
+    }
+
+    return RES_OK;
+}
+
+/* Baudrate measurement of the last calculation, see header file for details */
+uint8_t sniffer_rs232_baud_info_get(enum uart_type type, struct sniffer_rs232_baud_info *info)
+{
+    if (!info || (type != BSP_UART_TYPE_RS232_TX && type != BSP_UART_TYPE_RS232_RX))
+        return RES_INVALID_PAR;
+
+    *info = baud_info[type];
+
+    return RES_OK;
+}
+
+/* Start of drift tracking of baudrate, see header file for details */
+uint8_t sniffer_rs232_drift_start(void)
+{
+    if (!alg_tim_freq)
+        return RES_NOT_INITIALIZED;
+
+    for (enum uart_type type = BSP_UART_TYPE_RS232_TX; type < BSP_UART_TYPE_MAX; type++) {
+        if (calcs[type].stage != SNIFFER_RS232_STAGE_IDLE && calcs[type].stage != SNIFFER_RS232_STAGE_DONE)
+            return RES_NOT_ALLOWED;
+    }
+
+    HAL_NVIC_DisableIRQ(EXTI3_IRQn);
+    HAL_NVIC_DisableIRQ(EXTI9_5_IRQn);
+
+    memset(&tx_stats, 0, sizeof(tx_stats));
+    memset(&rx_stats, 0, sizeof(rx_stats));
+    memset(&tx_glitch, 0, sizeof(tx_glitch));
+    memset(&rx_glitch, 0, sizeof(rx_glitch));
+    tx_stats.min_low = rx_stats.min_low = UINT32_MAX;
+    tx_cnt = rx_cnt = 0;
+
+    /* EXTI configuration may be cleared by deinitialization of the pins */
+    __sniffer_rs232_exti_init();
+    drift_active = true;
+
+    /* Lines may be at lower level in the middle of frame */
+    tx_first_falling = BSP_GPIO_PORT_READ(GPIOA, GPIO_PIN_3);
+    rx_first_falling = BSP_GPIO_PORT_READ(GPIOC, GPIO_PIN_5);
+
+    HAL_NVIC_ClearPendingIRQ(EXTI3_IRQn);
+    HAL_NVIC_EnableIRQ(EXTI3_IRQn);
+    HAL_NVIC_ClearPendingIRQ(EXTI9_5_IRQn);
+    HAL_NVIC_EnableIRQ(EXTI9_5_IRQn);
+
+    return RES_OK;
+}
+
+/* Stop of drift tracking of baudrate, see header file for details */
+uint8_t sniffer_rs232_drift_stop(void)
+{
+    if (!drift_active)
+        return RES_OK;
+
+    HAL_NVIC_DisableIRQ(EXTI3_IRQn);
+    HAL_NVIC_DisableIRQ(EXTI9_5_IRQn);
+
+    drift_active = false;
+
+    return RES_OK;
+}
+
+/* Measured baudrate of drift tracking, see header file for details */
+uint8_t sniffer_rs232_drift_get(enum uart_type type, uint32_t *baudrate)
+{
+    if (!baudrate || (type != BSP_UART_TYPE_RS232_TX && type != BSP_UART_TYPE_RS232_RX))
+        return RES_INVALID_PAR;
+
+    if (!drift_active)
+        return RES_NOT_ALLOWED;
+
+    struct width_stats *stats = (type == BSP_UART_TYPE_RS232_TX) ? &tx_stats : &rx_stats;
+    struct glitch_filter *filter = (type == BSP_UART_TYPE_RS232_TX) ? &tx_glitch : &rx_glitch;
+    uint32_t *cnt = (type == BSP_UART_TYPE_RS232_TX) ? &tx_cnt : &rx_cnt;
+    bool *first_falling = (type == BSP_UART_TYPE_RS232_TX) ? &tx_first_falling : &rx_first_falling;
+    IRQn_Type irq_type = (type == BSP_UART_TYPE_RS232_TX) ? EXTI3_IRQn : EXTI9_5_IRQn;
+
+    /* Snapshot of the window and start of the next one, glitches are counted through windows */
+    HAL_NVIC_DisableIRQ(irq_type);
+    struct width_stats snapshot = *stats;
+    memset(stats, 0, sizeof(*stats));
+    stats->min_low = UINT32_MAX;
+    filter->pending_valid = false;
+    *cnt = 0;
+
+    /* The next window may be started in the middle of frame, pending edge of glitch filter is dropped above */
+    *first_falling = (type == BSP_UART_TYPE_RS232_TX) ? BSP_GPIO_PORT_READ(GPIOA, GPIO_PIN_3) : BSP_GPIO_PORT_READ(GPIOC, GPIO_PIN_5);
+    HAL_NVIC_ClearPendingIRQ(irq_type);
+    HAL_NVIC_EnableIRQ(irq_type);
+
+    uint64_t len_bits = 0;
+    uint32_t bits_cnt = 0;
+    __sniffer_rs232_hist_calc(&snapshot.hist, &len_bits, &bits_cnt);
+
+    /* Raw measurement without snapping to known baudrates as drift itself is of interest */
+    if (bits_cnt >= config.min_detect_bits && len_bits)
+        *baudrate = (uint32_t)(((uint64_t)alg_tim_freq * bits_cnt + len_bits / 2) / len_bits);
+    else
+        *baudrate = 0;
+
+    return RES_OK;
+}
+
+/* Quality of signal on RS-232 line, see header file for details */
+uint8_t sniffer_rs232_quality_get(enum uart_type type, uint32_t baudrate, struct sniffer_rs232_quality *quality)
+{
+    if (!quality || !baudrate || (type != BSP_UART_TYPE_RS232_TX && type != BSP_UART_TYPE_RS232_RX))
+        return RES_INVALID_PAR;
+
+    if (!alg_tim_freq)
+        return RES_NOT_INITIALIZED;
+
+    /* Edges of the line are being captured by the calculation */
+    const struct calc_ctx *calc = __sniffer_rs232_line_calc_get(type);
+    if (calc->stage != SNIFFER_RS232_STAGE_IDLE && calc->stage != SNIFFER_RS232_STAGE_DONE)
+        return RES_NOT_ALLOWED;
+
+    const uint32_t *buffer = (type == BSP_UART_TYPE_RS232_TX) ? tx_buffer : rx_buffer;
+    uint32_t cnt = (type == BSP_UART_TYPE_RS232_TX) ? tx_cnt : rx_cnt;
+    bool first_falling = (type == BSP_UART_TYPE_RS232_TX) ? tx_first_falling : rx_first_falling;
+    uint32_t len_bit = __sniffer_rs232_len_bit_get(baudrate, 100);
+
+    memset(quality, 0, sizeof(*quality));
+    quality->glitch_cnt = (type == BSP_UART_TYPE_RS232_TX) ? tx_glitch.glitch_cnt : rx_glitch.glitch_cnt;
+
+    /* Width of a bit is measured over levels of known count of bits, IDLE gaps are skipped */
+    uint64_t len_sum = 0;
+    uint32_t bits_sum = 0;
+
+    for (uint32_t i = 1; i < cnt; i++) {
+        uint32_t len = buffer[i] - buffer[i - 1];
+        uint32_t bits = (uint32_t)((((uint64_t)len << LEN_FRAC_BITS) + len_bit / 2) / len_bit);
+
+        if (!bits || bits > HIST_RUN_MAX_BITS)
+            continue;
+
+        len_sum += len;
+        bits_sum += bits;
+        quality->widths_cnt++;
+    }
+
+    if (!bits_sum)
+        return RES_OK;
+
+    float meas_len_bit = (float)len_sum / (float)bits_sum;
+    float ns_per_tick = 1000000000.0f / (float)alg_tim_freq;
+    float dev_sum[2] = {0.0f};
+    float dev_sq_sum = 0.0f;
+    uint32_t dev_cnt[2] = {0};
+
+    for (uint32_t i = 1; i < cnt; i++) {
+        uint32_t len = buffer[i] - buffer[i - 1];
+        uint32_t bits = (uint32_t)((((uint64_t)len << LEN_FRAC_BITS) + len_bit / 2) / len_bit);
+
+        if (!bits || bits > HIST_RUN_MAX_BITS)
+            continue;
+
+        /* Level after falling edge is lower one, edges alternate starting with the first one */
+        uint8_t lower = ((i - 1) & 1) ^ (first_falling ? 1 : 0);
+        float dev = (float)len - (float)bits * meas_len_bit;
+
+        dev_sum[lower] += dev;
+        dev_sq_sum += dev * dev;
+        dev_cnt[lower]++;
+    }
+
+    float meas_baudrate = (float)alg_tim_freq / meas_len_bit;
+    quality->baud_error_ppm = (int32_t)((meas_baudrate - (float)baudrate) * 1000000.0f / (float)baudrate);
+
+    /* Systematic deviations of levels are duty distortion, the rest is jitter */
+    for (uint8_t i = 0; i < 2; i++) {
+        if (dev_cnt[i])
+            dev_sq_sum -= dev_sum[i] * dev_sum[i] / (float)dev_cnt[i];
+    }
+
+    quality->jitter_ns = (uint32_t)(sqrtf(MAX(dev_sq_sum, 0.0f) / (float)quality->widths_cnt) * ns_per_tick);
+
+    if (dev_cnt[0] && dev_cnt[1])
+        quality->duty_distortion_ns = (int32_t)((dev_sum[1] / dev_cnt[1] - dev_sum[0] / dev_cnt[0]) * ns_per_tick / 2.0f);
+
+    return RES_OK;
+}
+
+/* Replay of traffic captured during the algorithm calculation, see header file for details */
+uint8_t sniffer_rs232_replay_get(enum uart_type type, const struct uart_init_ctx *uart_params, uint16_t *data, uint32_t *len)
+{
+    if (!uart_params || !data || !len || !uart_params->baudrate || (type != BSP_UART_TYPE_RS232_TX && type != BSP_UART_TYPE_RS232_RX))
+        return RES_INVALID_PAR;
+
+    if (!UART_WORDLEN_VALID(uart_params->wordlen) || !UART_PARITY_VALID(uart_params->parity) || !UART_STOPBITS_VALID(uart_params->stopbits))
+        return RES_INVALID_PAR;
+
+    if (!alg_tim_freq)
+        return RES_NOT_INITIALIZED;
+
+    const struct calc_ctx *calc = __sniffer_rs232_line_calc_get(type);
+    if (calc->stage != SNIFFER_RS232_STAGE_IDLE && calc->stage != SNIFFER_RS232_STAGE_DONE)
+        return RES_NOT_ALLOWED;
+
+    const struct frame_hyp_ctx hyp = {uart_params->wordlen, uart_params->parity, uart_params->stopbits};
+    uint8_t data_bits = hyp.wordlen - ((hyp.parity != BSP_UART_PARITY_NONE) ? 1 : 0);
+    uint16_t mask = (uint16_t)((1 << data_bits) - 1);
+    uint32_t size = *len;
+    *len = 0;
+
+    /* Software decoding of edges captured in baudrate part */
+    const uint32_t *buffer = (type == BSP_UART_TYPE_RS232_TX) ? tx_buffer : rx_buffer;
+    uint32_t cnt = (type == BSP_UART_TYPE_RS232_TX) ? tx_cnt : rx_cnt;
+    uint32_t len_bit = __sniffer_rs232_len_bit_get(uart_params->baudrate, 100);
+    struct frame_hyp_state state = {0};
+
+    uint32_t frames_cnt = 0;
+
+    /* Capture may be started and stopped in the middle of frame, so the first and the last frames are dropped */
+    for (uint32_t idx = __sniffer_rs232_hyp_align_get(&hyp, buffer, cnt, len_bit); idx < cnt && *len < size; idx++) {
+        const struct hyp_check_ctx *check = &state.check;
+
+        __sniffer_rs232_frame_edge_apply(&hyp, &state, buffer[idx], !(idx & 1), len_bit);
+
+        if ((check->valid_cnt + check->error_frame_cnt + check->error_parity_cnt) == frames_cnt)
+            continue;
+
+        if (frames_cnt++)
+            data[(*len)++] = (state.last_frame >> 1) & mask;
+    }
+
+    /* Low bits of raw 9 bits words are word bits for 8 & 9 bits formats,  
+       7 bits frames are shorter than raw ones, so raw words are not aligned with them */
+    const struct replay_words *words = &replay[type];
+
+    if (words->raw && hyp.wordlen == BSP_UART_WORDLEN_7)
+        return RES_OK;
+
+    for (uint32_t i = 0; i < words->cnt && *len < size; i++)
+        data[(*len)++] = words->words[i] & mask;
+
+    return RES_OK;
+}
+
+/** Capture of edge on RS-232 line
+ * 
+ * The function is called from EXTI interrupt of the line. The edge is stored into  
+ * statistics of widths (\ref RS232_CAPTURE_EXTI_STREAM mode or drift tracking) and into buffer of the line.  
+ * If glitch filter is enabled, the edge is delayed until the next one, both of them are removed  
+ * if the pulse between them is narrower than \ref glitch_min_len
+ * 
+ * \param[in,out] filter glitch filter of the line
+ * \param[in,out] stats statistics of widths of the line
+ * \param[in,out] buffer buffer of timestamps of the line
+ * \param[in,out] cnt filling level of \p buffer
+ * \param[in] irq_type NVIC IRQ type of EXTI of the line
+ * \param[in] timestamp timestamp of the edge
+ */
+static inline void __sniffer_rs232_edge_capture(struct glitch_filter *filter, struct width_stats *stats, uint32_t *buffer,
+                                                uint32_t *cnt, IRQn_Type irq_type, uint32_t timestamp)
+{
+    if (glitch_min_len) {
+        if (filter->pending_valid && (timestamp - filter->pending) < glitch_min_len) {
+            filter->pending_valid = false;
+            filter->glitch_cnt++;
+            return;
+        }
+
+        bool pending_valid = filter->pending_valid;
+        uint32_t pending = filter->pending;
+
+        filter->pending = timestamp;
+        filter->pending_valid = true;
+
+        if (!pending_valid)
+            return;
+
+        timestamp = pending;
+    }
+
+    if (config.capture_type == RS232_CAPTURE_EXTI_STREAM || drift_active) {
+        __sniffer_rs232_width_stats_add(stats, timestamp);
+
+        /* The first edges are kept for \ref sniffer_rs232_quality_get */
+        if (*cnt < BUFFER_SIZE)
+            buffer[(*cnt)++] = timestamp;
+
+        if (drift_active && stats->edges_cnt == DRIFT_EDGES_CNT)
+            HAL_NVIC_DisableIRQ(irq_type);
+    } else {
+        buffer[(*cnt)++] = timestamp;
+
+        if (*cnt == BUFFER_SIZE)
+            HAL_NVIC_DisableIRQ(irq_type);
+    }
+}
+
+/** NVIC IRQ EXTI3 handler
+ * 
+ * Handler is used to fill in \ref tx_buffer or \ref tx_stats
+*/
+void EXTI3_IRQHandler(void)
+{
+    uint32_t timestamp = alg_tim.Instance->CNT;
+
+    __sniffer_rs232_edge_capture(&tx_glitch, &tx_stats, tx_buffer, &tx_cnt, EXTI3_IRQn, timestamp);
+
+    __HAL_GPIO_EXTI_CLEAR_IT(GPIO_PIN_3);
+}
+
+/** NVIC IRQ DMA1 Stream3 handler
+ * 
+ * Handler is used to fill in \ref tx_buffer in \ref RS232_CAPTURE_TIM_DMA mode
+*/
+void DMA1_Stream3_IRQHandler(void)
+{
+    HAL_DMA_IRQHandler(&alg_hdma);
+}
+
+/** NVIC IRQ EXTI5 handler
+ * 
+ * Handler is used to fill in \ref rx_buffer or \ref rx_stats
+*/
+void EXTI9_5_IRQHandler(void)
+{
+    uint32_t timestamp = alg_tim.Instance->CNT;
+
+    __sniffer_rs232_edge_capture(&rx_glitch, &rx_stats, rx_buffer, &rx_cnt, EXTI9_5_IRQn, timestamp);
+
+    __HAL_GPIO_EXTI_CLEAR_IT(GPIO_PIN_5);
+}
+
 /** @} */
\ No newline at end of file
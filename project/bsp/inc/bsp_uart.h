@@ -1,189 +1,342 @@
-/**
-\file
-\author JavaLandau
-\copyright MIT License
-\brief Header of BSP UART module
-*/
-
-#ifndef __BSP_UART_H__
-#define __BSP_UART_H__
-
-#include <stdint.h>
-#include <stdbool.h>
-#include "stm32f4xx_hal.h"
-
-/** 
- * \addtogroup bsp_uart
- * @{
-*/
-
-/** MACRO Check BSP UART type
- * 
- * The macro checks whether \p X is valid BSP UART type
- * 
- * \param[in] X BSP UART type
- * \return true if type is valid false otherwise
-*/
-#define UART_TYPE_VALID(X)      (((uint32_t)(X) < BSP_UART_TYPE_MAX))
-
-/** MACRO Check BSP UART word length
- * 
- * The macro checks whether \p X is valid BSP UART word length
- * 
- * \param[in] X BSP UART word length
- * \return true if word length is valid false otherwise
-*/
-#define UART_WORDLEN_VALID(X)   (((X) == BSP_UART_WORDLEN_8) || ((X) == BSP_UART_WORDLEN_9))
-
-/** MACRO Check BSP UART parity type
- * 
- * The macro checks whether \p X is valid BSP UART parity type
- * 
- * \param[in] X BSP UART parity type
- * \return true if parity type is valid false otherwise
-*/
-#define UART_PARITY_VALID(X)    (((X) == BSP_UART_PARITY_NONE) || ((X) == BSP_UART_PARITY_EVEN) || ((X) == BSP_UART_PARITY_ODD))
-
-/** MACRO Check BSP UART stop bits count
- * 
- * The macro checks whether \p X is valid BSP UART stop bits count
- * 
- * \param[in] X BSP UART stop bits count
- * \return true if stop bits count is valid false otherwise
-*/
-#define UART_STOPBITS_VALID(X)  (((X) == BSP_UART_STOPBITS_1) || ((X) == BSP_UART_STOPBITS_2))
-
-#define BSP_UART_ERROR_PE       HAL_UART_ERROR_PE   ///< BSP UART parity error
-#define BSP_UART_ERROR_NE       HAL_UART_ERROR_NE   ///< BSP UART noise error
-#define BSP_UART_ERROR_FE       HAL_UART_ERROR_FE   ///< BSP UART frame error
-#define BSP_UART_ERROR_ORE      HAL_UART_ERROR_ORE  ///< BSP UART overrun error
-#define BSP_UART_ERROR_DMA      HAL_UART_ERROR_DMA  ///< BSP UART DMA error
-
-/// Mask including all possible BSP UART errors
-#define BSP_UART_ERRORS_ALL     (BSP_UART_ERROR_PE | BSP_UART_ERROR_NE | BSP_UART_ERROR_FE | BSP_UART_ERROR_ORE | BSP_UART_ERROR_DMA)
-
-/// Types of BSP UART instances
-enum uart_type {
-    BSP_UART_TYPE_CLI = 0,      ///< CLI
-    BSP_UART_TYPE_RS232_TX,     ///< RS-232 TX channel (RX only)
-    BSP_UART_TYPE_RS232_RX,     ///< RS-232 RX channel (RX only)
-    BSP_UART_TYPE_MAX           ///< Count of BSP UART types
-};
-
-/// BSP UART word length
-enum uart_wordlen {
-    BSP_UART_WORDLEN_8 = 8,     ///< Word length is 8 bits
-    BSP_UART_WORDLEN_9 = 9      ///< Word length is 9 bits
-};
-
-/// BSP UART parity types
-enum uart_parity {
-    BSP_UART_PARITY_NONE = 0,   ///< None parity
-    BSP_UART_PARITY_EVEN = 1,   ///< Even parity
-    BSP_UART_PARITY_ODD = 2     ///< Odd parity
-};
-
-/// BSP UART stop bits count
-enum uart_stopbits {
-    BSP_UART_STOPBITS_1 = 1,    ///< 1 stop bit
-    BSP_UART_STOPBITS_2 = 2     ///< 2 stop bits
-};
-
-/// BSP UART initializing context
-struct uart_init_ctx {
-    uint32_t baudrate;                                                          ///< UART baudrate
-    uint32_t tx_size;                                                           ///< Size of sent buffer
-    uint32_t rx_size;                                                           ///< Size of received buffer
-    bool lin_enabled;                                                           ///< Flag whether LIN protocol is supported
-    enum uart_wordlen wordlen;                                                  ///< Word length
-    enum uart_parity parity;                                                    ///< Parity type
-    enum uart_stopbits stopbits;                                                ///< Count of stop bits
-    void (*error_isr_cb)(enum uart_type type, uint32_t error, void *params);    ///< Callback for occurrence of BSP UART error
-    void (*overflow_isr_cb)(enum uart_type type, void *params);                 ///< Callback for occurrence of overflow of receive buffer
-    void (*lin_break_isr_cb)(enum uart_type type, void *params);                ///< Callback for occurrence of LIN break detection
-    void *params;                                                               ///< Optional parameters, passed to the callbacks
-};
-
-/** Initialization of BSP UART instance
- * 
- * The function executes initizalition of BSP UART instance according  
- * to settings stored in \p init  
- * if appropriate BSP UART instance is initialized it will be reinitialized
- * 
- * \param[in] type BSP UART type
- * \param[in] init initializating context of BSP UART instance
- * \return \ref RES_OK on success error otherwise
- */
-uint8_t bsp_uart_init(enum uart_type type, struct uart_init_ctx *init);
-
-/** Deinitialization of BSP UART instance
- * 
- * The function executes deinitizalition of BSP UART instance
- * 
- * \param[in] type BSP UART type
- * \return \ref RES_OK on success error otherwise
- */
-uint8_t bsp_uart_deinit(enum uart_type type);
-
-/** Receive BSP UART data
- * 
- * The function executes reading of data received via DMA UART
- * \note The function is blocking if \p tmt_ms is not zero
- * 
- * \param[in] type BSP UART type
- * \param[out] data received data
- * \param[out] len size of received data
- * \param[in] tmt_ms timeout for receiving in ms
- * \return \ref RES_OK on success error otherwise
- */
-uint8_t bsp_uart_read(enum uart_type type, void *data, uint16_t *len, uint32_t tmt_ms);
-
-/** Send BSP UART data
- * 
- * The function executes sending of data via DMA UART
- * \note The function is blocking if previous DMA UART sending is not completed  
- * and \p tmt_ms is not zero
- * 
- * \param[in] type BSP UART type
- * \param[in] data sent data
- * \param[in] len size of sent data
- * \param[in] tmt_ms timeout for sending in ms
- * \return \ref RES_OK on success error otherwise
- */
-uint8_t bsp_uart_write(enum uart_type type, void *data, uint16_t len, uint32_t tmt_ms);
-
-/** BSP UART instance start
- * 
- * The function (re-)start UART DMA reception, enable appropriate interrupts and etc.
- * 
- * \param[in] type BSP UART type
- * \return \ref RES_OK on success error otherwise
- */
-uint8_t bsp_uart_start(enum uart_type type);
-
-/** BSP UART instance stop
- * 
- * The function stop UART DMA reception/sending
- * 
- * \param[in] type BSP UART type
- * \return \ref RES_OK on success error otherwise
- */
-uint8_t bsp_uart_stop(enum uart_type type);
-
-/** Flag whether BSP UART instance is started
- * 
- * \param[in] type BSP UART type
- * \return true if the instance is started false otherwise
- */
-bool bsp_uart_is_started(enum uart_type type);
-
-/** Flag whether received buffer is empty
- * 
- * \param[in] type BSP UART type
- * \return true if \ref uart_ctx::rx_buff is empty false otherwise
- */
-bool bsp_uart_rx_buffer_is_empty(enum uart_type type);
-
-/** @} */
-
+/**
+\file
+\author JavaLandau
+\copyright MIT License
+\brief Header of BSP UART module
+*/
+
+#ifndef __BSP_UART_H__
+#define __BSP_UART_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "stm32f4xx_hal.h"
+
+/** 
+ * \addtogroup bsp_uart
+ * @{
+*/
+
+/** MACRO Check BSP UART type
+ * 
+ * The macro checks whether \p X is valid BSP UART type
+ * 
+ * \param[in] X BSP UART type
+ * \return true if type is valid false otherwise
+*/
+#define UART_TYPE_VALID(X)      (((uint32_t)(X) < BSP_UART_TYPE_MAX))
+
+/** MACRO Check BSP UART word length
+ * 
+ * The macro checks whether \p X is valid BSP UART word length
+ * 
+ * \param[in] X BSP UART word length
+ * \return true if word length is valid false otherwise
+*/
+#define UART_WORDLEN_VALID(X)   (((X) == BSP_UART_WORDLEN_7) || ((X) == BSP_UART_WORDLEN_8) || ((X) == BSP_UART_WORDLEN_9))
+
+/** MACRO Check BSP UART parity type
+ * 
+ * The macro checks whether \p X is valid BSP UART parity type
+ * 
+ * \param[in] X BSP UART parity type
+ * \return true if parity type is valid false otherwise
+*/
+#define UART_PARITY_VALID(X)    (((X) == BSP_UART_PARITY_NONE) || ((X) == BSP_UART_PARITY_EVEN) || ((X) == BSP_UART_PARITY_ODD))
+
+/** MACRO Check BSP UART stop bits count
+ * 
+ * The macro checks whether \p X is valid BSP UART stop bits count
+ * 
+ * \param[in] X BSP UART stop bits count
+ * \return true if stop bits count is valid false otherwise
+*/
+#define UART_STOPBITS_VALID(X)  (((X) == BSP_UART_STOPBITS_1) || ((X) == BSP_UART_STOPBITS_2))
+
+#ifndef BSP_UART_CLI_RX_SIZE
+#define BSP_UART_CLI_RX_SIZE    (256)   ///< Capacity of static received buffer of CLI in bytes, can be set by build flags
+#endif
+
+#ifndef BSP_UART_CLI_TX_SIZE
+#define BSP_UART_CLI_TX_SIZE    (2048)  ///< Capacity of static sent buffer of CLI in bytes, can be set by build flags
+#endif
+
+#ifndef BSP_UART_RS232_RX_SIZE
+#define BSP_UART_RS232_RX_SIZE  (256)   ///< Capacity of static received buffer of RS-232 line in 16 bits words, can be set by build flags
+#endif
+
+#ifndef BSP_UART_RAM_CTX
+#define BSP_UART_RAM_CTX        (768)   ///< Maximum static RAM of context, STM32 HAL DMA instances & timestamps of each instance in bytes, can be set by build flags
+#endif
+
+/// Maximum static RAM of CLI in bytes, checked at build time, actual one is printed by host test test_uart_ram
+#define BSP_UART_RAM_CLI        (BSP_UART_CLI_RX_SIZE + BSP_UART_CLI_TX_SIZE + BSP_UART_RAM_CTX)
+
+/// Maximum static RAM of each RS-232 line in bytes, checked at build time, actual one is printed by host test test_uart_ram
+#define BSP_UART_RAM_RS232      (BSP_UART_RS232_RX_SIZE * sizeof(uint16_t) + BSP_UART_RAM_CTX)
+
+#define BSP_UART_ERROR_PE       HAL_UART_ERROR_PE   ///< BSP UART parity error
+#define BSP_UART_ERROR_NE       HAL_UART_ERROR_NE   ///< BSP UART noise error
+#define BSP_UART_ERROR_FE       HAL_UART_ERROR_FE   ///< BSP UART frame error
+#define BSP_UART_ERROR_ORE      HAL_UART_ERROR_ORE  ///< BSP UART overrun error
+#define BSP_UART_ERROR_DMA      HAL_UART_ERROR_DMA  ///< BSP UART DMA error
+
+/// Mask including all possible BSP UART errors
+#define BSP_UART_ERRORS_ALL     (BSP_UART_ERROR_PE | BSP_UART_ERROR_NE | BSP_UART_ERROR_FE | BSP_UART_ERROR_ORE | BSP_UART_ERROR_DMA)
+
+/// Types of BSP UART instances
+enum uart_type {
+    BSP_UART_TYPE_CLI = 0,      ///< CLI
+    BSP_UART_TYPE_RS232_TX,     ///< RS-232 TX channel (RX only)
+    BSP_UART_TYPE_RS232_RX,     ///< RS-232 RX channel (RX only)
+    BSP_UART_TYPE_MAX           ///< Count of BSP UART types
+};
+
+/// BSP UART word length
+enum uart_wordlen {
+    BSP_UART_WORDLEN_7 = 7,     ///< Word length is 7 bits, only without parity  
+                                ///< \note Received as 8 bits word with masking of MSB which is the first stop bit,  
+                                ///< so the stop bit is sampled one bit late and 7N1 frames without gaps between them  
+                                ///< lose synchronization, 7N2 frames and 7N1 ones separated by idle line are received
+    BSP_UART_WORDLEN_8 = 8,     ///< Word length is 8 bits
+    BSP_UART_WORDLEN_9 = 9      ///< Word length is 9 bits
+};
+
+/// BSP UART parity types
+enum uart_parity {
+    BSP_UART_PARITY_NONE = 0,   ///< None parity
+    BSP_UART_PARITY_EVEN = 1,   ///< Even parity
+    BSP_UART_PARITY_ODD = 2     ///< Odd parity
+};
+
+/// BSP UART stop bits count
+enum uart_stopbits {
+    BSP_UART_STOPBITS_1 = 1,    ///< 1 stop bit
+    BSP_UART_STOPBITS_2 = 2     ///< 2 stop bits
+};
+
+/// BSP UART initializing context
+struct uart_init_ctx {
+    uint32_t baudrate;                                                          ///< UART baudrate
+    uint32_t tx_size;                                                           ///< Size of sent buffer, power of two or 0, up to \ref BSP_UART_CLI_TX_SIZE
+    uint32_t rx_size;                                                           ///< Size of received buffer in words, power of two or 0, up to capacity of static buffer
+    bool lin_enabled;                                                           ///< Flag whether LIN protocol is supported
+    enum uart_wordlen wordlen;                                                  ///< Word length
+    enum uart_parity parity;                                                    ///< Parity type
+    enum uart_stopbits stopbits;                                                ///< Count of stop bits
+    void (*error_isr_cb)(enum uart_type type, uint32_t error, void *params);    ///< Callback for occurrence of BSP UART error
+    void (*overflow_isr_cb)(enum uart_type type, void *params);                 ///< Callback for occurrence of overflow of receive buffer
+    void (*lin_break_isr_cb)(enum uart_type type, void *params);                ///< Callback for occurrence of LIN break detection
+    void *params;                                                               ///< Optional parameters, passed to the callbacks
+};
+
+/** Received data of BSP UART instance in place of the receive ring buffer, see \ref bsp_uart_read_acquire
+ * 
+ * Words are 16 bits only for RS-232 instances with 9 bits word length without parity  
+ * and 8 bits otherwise, words are not masked by UART settings (see \ref bsp_uart_data_mask_get)  
+ * but can be masked by \ref copy specialised for UART settings
+ */
+struct uart_rx_span {
+    const void *data[2];        ///< Segments of received data, the second one is used only if data wraps around the end of the buffer
+    uint16_t len[2];            ///< Count of words in the segments, 0 for unused segment
+    uint8_t word_size;          ///< Size of word in bytes
+    void (*copy)(uint16_t *dst, const void *src, uint16_t len);     ///< Copying of \p len words of the segment \p src into 16 bits words masked by data bits
+};
+
+/// Statistics of ring buffers of BSP UART instance since its initialization, kept over restarts by \ref bsp_uart_start
+struct uart_stats {
+    uint32_t rx_high_water;     ///< Maximum count of unread words in receive buffer
+    uint32_t rx_dropped;        ///< Count of received words overwritten or discarded by restart before reading
+    uint32_t tx_high_water;     ///< Maximum count of unsent bytes in sent buffer
+    uint32_t tx_dropped;        ///< Count of bytes not fitting in sent buffer
+};
+
+/** Initialization of BSP UART instance
+ * 
+ * The function executes initizalition of BSP UART instance according  
+ * to settings stored in \p init  
+ * if appropriate BSP UART instance is initialized it will be reinitialized  
+ * \note Storage of the instance is static, so reinitialization does not allocate memory
+ * 
+ * \param[in] type BSP UART type
+ * \param[in] init initializating context of BSP UART instance
+ * \return \ref RES_OK on success, \ref RES_OVERFLOW if buffers do not fit in static storage, error otherwise
+ */
+uint8_t bsp_uart_init(enum uart_type type, struct uart_init_ctx *init);
+
+/** Deinitialization of BSP UART instance
+ * 
+ * The function executes deinitizalition of BSP UART instance
+ * 
+ * \param[in] type BSP UART type
+ * \return \ref RES_OK on success error otherwise
+ */
+uint8_t bsp_uart_deinit(enum uart_type type);
+
+/** Receive BSP UART data
+ * 
+ * The function executes reading of data received via DMA UART
+ * \note The function is blocking if \p tmt_ms is not zero  
+ * Data is copied into \p data, use \ref bsp_uart_read_acquire to access it in place
+ * 
+ * \param[in] type BSP UART type
+ * \param[out] data received data, 8 bits words for \ref BSP_UART_TYPE_CLI and masked 16 bits words otherwise
+ * \param[out] len size of received data
+ * \param[in] tmt_ms timeout for receiving in ms
+ * \return \ref RES_OK on success error otherwise
+ */
+uint8_t bsp_uart_read(enum uart_type type, void *data, uint16_t *len, uint32_t tmt_ms);
+
+/** Receive BSP UART data with arrival times
+ * 
+ * The function executes reading of data received via DMA UART like \ref bsp_uart_read  
+ * and returns arrival time of each word, see \ref bsp_uart_rx_times_get
+ * \note The function is blocking if \p tmt_ms is not zero
+ * 
+ * \param[in] type BSP UART type
+ * \param[out] data received data, 8 bits words for \ref BSP_UART_TYPE_CLI and masked 16 bits words otherwise
+ * \param[out] time_us arrival times of received words in us, may be NULL
+ * \param[out] len size of received data
+ * \param[in] tmt_ms timeout for receiving in ms
+ * \return \ref RES_OK on success error otherwise
+ */
+uint8_t bsp_uart_read_stamped(enum uart_type type, void *data, uint32_t *time_us, uint16_t *len, uint32_t tmt_ms);
+
+/** Arrival times of BSP UART received data
+ * 
+ * The function returns arrival times (end of stop bit) of unreleased received words,  
+ * time base is \ref bsp_rcc_us_get. Each DMA reception event (idle line, half & full transfer)  
+ * is timestamped, times of words inside the chunk are reconstructed back from the timestamp  
+ * by character time, so inter-word gaps shorter than character time are not resolved
+ * \note The function should be called before \ref bsp_uart_read_release of the words
+ * 
+ * \param[in] type BSP UART type
+ * \param[out] time_us arrival times of words in us
+ * \param[in] len count of words from the beginning of data acquired by \ref bsp_uart_read_acquire
+ * \return \ref RES_OK on success error otherwise
+ */
+uint8_t bsp_uart_rx_times_get(enum uart_type type, uint32_t *time_us, uint16_t len);
+
+/** Acquire of BSP UART received data in place
+ * 
+ * The function gives read-only access to data received via DMA UART without copying,  
+ * data stays in the receive buffer until it is released by \ref bsp_uart_read_release  
+ * and is counted by overflow check, so it should be released as soon as possible
+ * \note The function is blocking if \p tmt_ms is not zero
+ * 
+ * \param[in] type BSP UART type
+ * \param[out] span segments of received data
+ * \param[in] tmt_ms timeout for receiving in ms
+ * \return \ref RES_OK on success error otherwise
+ */
+uint8_t bsp_uart_read_acquire(enum uart_type type, struct uart_rx_span *span, uint32_t tmt_ms);
+
+/** Release of BSP UART received data
+ * 
+ * The function frees received data acquired by \ref bsp_uart_read_acquire  
+ * Words overwritten by DMA before the release are counted in uart_stats::rx_dropped  
+ * and reported by \p lost, they are the first ones of the acquired data  
+ * and should be discarded by the caller
+ * 
+ * \param[in] type BSP UART type
+ * \param[in] len count of released words from the beginning of the acquired data
+ * \param[out] lost count of the first \p len words overwritten before the release, may be NULL
+ * \return \ref RES_OK on success error otherwise
+ */
+uint8_t bsp_uart_read_release(enum uart_type type, uint16_t len, uint16_t *lost);
+
+/** Mask of data bits of received words
+ * 
+ * The function returns mask of data bits of words received by BSP UART instance  
+ * according to its word length & parity, parity bit is excluded
+ * 
+ * \param[in] type BSP UART type
+ * \return mask of data bits, 0 if instance is not initialized
+ */
+uint16_t bsp_uart_data_mask_get(enum uart_type type);
+
+/** Character time of BSP UART instance
+ * 
+ * The function returns duration of the frame of BSP UART instance  
+ * including start bit, word bits (with parity) & stop bits
+ * 
+ * \param[in] type BSP UART type
+ * \return character time in ns, 0 if instance is not initialized
+ */
+uint32_t bsp_uart_char_time_get(enum uart_type type);
+
+/** Send BSP UART data
+ * 
+ * The function queues data into sent buffer, data is sent via DMA UART in background
+ * \note The function is blocking if there is no room for data in sent buffer  
+ * and \p tmt_ms is not zero, data not fitting in sent buffer on timeout is dropped
+ * 
+ * \param[in] type BSP UART type
+ * \param[in] data sent data
+ * \param[in] len size of sent data
+ * \param[in] tmt_ms timeout for waiting of room in sent buffer in ms
+ * \return \ref RES_OK on success, \ref RES_OVERFLOW if data is partially dropped, error otherwise
+ */
+uint8_t bsp_uart_write(enum uart_type type, void *data, uint16_t len, uint32_t tmt_ms);
+
+/** Statistics of ring buffers of BSP UART instance
+ * 
+ * \param[in] type BSP UART type
+ * \param[out] stats statistics of ring buffers
+ * \return \ref RES_OK on success error otherwise
+ */
+uint8_t bsp_uart_stats_get(enum uart_type type, struct uart_stats *stats);
+
+/** BSP UART instance start
+ * 
+ * The function (re-)start UART DMA reception, enable appropriate interrupts and etc.  
+ * Unread received data is discarded, reader holding acquired data releases it as usual  
+ * \note May be called from interrupt with stopped DMA reception, e.g. on UART error
+ * 
+ * \param[in] type BSP UART type
+ * \return \ref RES_OK on success error otherwise
+ */
+uint8_t bsp_uart_start(enum uart_type type);
+
+/** BSP UART instance stop
+ * 
+ * The function stop UART DMA reception/sending
+ * 
+ * \param[in] type BSP UART type
+ * \return \ref RES_OK on success error otherwise
+ */
+uint8_t bsp_uart_stop(enum uart_type type);
+
+/** Flag whether BSP UART instance is started
+ * 
+ * \param[in] type BSP UART type
+ * \return true if the instance is started false otherwise
+ */
+bool bsp_uart_is_started(enum uart_type type);
+
+/** Flag whether received buffer is empty
+ * 
+ * \param[in] type BSP UART type
+ * \return true if \ref uart_ctx::rx_buff is empty false otherwise
+ */
+bool bsp_uart_rx_buffer_is_empty(enum uart_type type);
+
+/** Change of BSP UART baudrate on the fly
+ * 
+ * The function rewrites baudrate register of BSP UART instance  
+ * without stopping of DMA reception. Baud counters are reloaded as soon as  
+ * the register is written, so started instance gets the new baudrate on the next  
+ * idle line and words go on to be received with the old one until then,  
+ * stopped instance gets it at once
+ * \note Baudrate requiring another oversampling is not supported, 
+ * use \ref bsp_uart_init instead
+ * 
+ * \param[in] type BSP UART type
+ * \param[in] baudrate new baudrate
+ * \return \ref RES_OK on success error otherwise
+ */
+uint8_t bsp_uart_baudrate_set(enum uart_type type, uint32_t baudrate);
+
+/** @} */
+
 #endif //__BSP_UART_H__
\ No newline at end of file
@@ -1,78 +1,128 @@
-/**
-\file
-\author JavaLandau
-\copyright MIT License
-\brief BSP RCC module
-
-The file includes implementation of BSP layer of the RCC
-*/
-
-#include "common.h"
-#include "bsp_rcc.h"
-#include "stm32f4xx_ll_rcc.h"
-
-/** 
- * \defgroup bsp_rcc BSP RCC
- * \brief Module of BSP RCC
- * \ingroup bsp
- * @{
-*/
-
-/* Configuration of main clocks, see header file for details */
-uint8_t bsp_rcc_main_config_init(void)
-{
-    RCC_OscInitTypeDef RCC_OscInitStruct = {0};
-    RCC_ClkInitTypeDef RCC_ClkInitStruct = {0};
-
-    /* Configure the main internal regulator output voltage */
-    __HAL_RCC_PWR_CLK_ENABLE();
-    __HAL_PWR_VOLTAGESCALING_CONFIG(PWR_REGULATOR_VOLTAGE_SCALE1);
-    /* Initializes the RCC Oscillators according to the specified parameters in the RCC_OscInitTypeDef structure. */
-    RCC_OscInitStruct.OscillatorType = RCC_OSCILLATORTYPE_HSE;
-    RCC_OscInitStruct.HSEState = RCC_HSE_ON;
-    RCC_OscInitStruct.PLL.PLLState = RCC_PLL_ON;
-    RCC_OscInitStruct.PLL.PLLSource = RCC_PLLSOURCE_HSE;
-    RCC_OscInitStruct.PLL.PLLM = 15;
-    RCC_OscInitStruct.PLL.PLLN = 216;
-    RCC_OscInitStruct.PLL.PLLP = RCC_PLLP_DIV2;
-    RCC_OscInitStruct.PLL.PLLQ = 2;
-    RCC_OscInitStruct.PLL.PLLR = 2;
-    if (HAL_RCC_OscConfig(&RCC_OscInitStruct) != HAL_OK)
-        return RES_NOK;
-
-    /* Activate the Over-Drive mode */
-    if (HAL_PWREx_EnableOverDrive() != HAL_OK)
-        return RES_NOK;
-
-    /* Initializes the CPU, AHB and APB buses clocks */
-    RCC_ClkInitStruct.ClockType = RCC_CLOCKTYPE_HCLK | RCC_CLOCKTYPE_SYSCLK |RCC_CLOCKTYPE_PCLK1 | RCC_CLOCKTYPE_PCLK2;
-    RCC_ClkInitStruct.SYSCLKSource = RCC_SYSCLKSOURCE_PLLCLK;
-    RCC_ClkInitStruct.AHBCLKDivider = RCC_SYSCLK_DIV1;
-    RCC_ClkInitStruct.APB1CLKDivider = RCC_HCLK_DIV4;
-    RCC_ClkInitStruct.APB2CLKDivider = RCC_HCLK_DIV2;
-
-    if (HAL_RCC_ClockConfig(&RCC_ClkInitStruct, FLASH_LATENCY_5) != HAL_OK)
-        return RES_NOK;
-
-    return RES_OK;
-}
-
-/* Get frequency of TIM internal clock, see header file for details */
-uint32_t bsp_rcc_apb_timer_freq_get(TIM_TypeDef *instance)
-{
-    if (!IS_TIM_INSTANCE(instance))
-        return 0;
-
-    uint32_t timclk_prescaler = LL_RCC_GetTIMPrescaler() >> RCC_DCKCFGR_TIMPRE_Pos;
-    uint32_t hclk_freq = HAL_RCC_GetHCLKFreq();
-    uint32_t pclk_freq = (TIM_APB_NUM_CLOCK_GET(instance) == 2) ? HAL_RCC_GetPCLK2Freq() : HAL_RCC_GetPCLK1Freq();
-
-    uint32_t tim_freq = 0;
-
-    tim_freq = pclk_freq * (2UL << timclk_prescaler);
-    tim_freq = (tim_freq > hclk_freq) ? hclk_freq : tim_freq;
-
-    return tim_freq;
-}
-
+/**
+\file
+\author JavaLandau
+\copyright MIT License
+\brief BSP RCC module
+
+The file includes implementation of BSP layer of the RCC
+*/
+
+#include "common.h"
+#include "bsp_rcc.h"
+#include "stm32f4xx_ll_rcc.h"
+
+/** 
+ * \defgroup bsp_rcc BSP RCC
+ * \brief Module of BSP RCC
+ * \ingroup bsp
+ * @{
+*/
+
+/// Context of microsecond timer extended from cycle counter of the core
+static struct {
+    uint32_t cycles_per_us;     ///< Count of HCLK cycles in 1 us, 0 if the timer is not initialized
+    uint32_t cycles;            ///< Value of cycle counter at \ref time_us
+    uint32_t time_us;           ///< Time in us
+} us_timer = {0};
+
+/* Configuration of main clocks, see header file for details */
+uint8_t bsp_rcc_main_config_init(void)
+{
+    RCC_OscInitTypeDef RCC_OscInitStruct = {0};
+    RCC_ClkInitTypeDef RCC_ClkInitStruct = {0};
+
+    /* Configure the main internal regulator output voltage */
+    __HAL_RCC_PWR_CLK_ENABLE();
+    __HAL_PWR_VOLTAGESCALING_CONFIG(PWR_REGULATOR_VOLTAGE_SCALE1);
+    /* Initializes the RCC Oscillators according to the specified parameters in the RCC_OscInitTypeDef structure. */
+    RCC_OscInitStruct.OscillatorType = RCC_OSCILLATORTYPE_HSE;
+    RCC_OscInitStruct.HSEState = RCC_HSE_ON;
+    RCC_OscInitStruct.PLL.PLLState = RCC_PLL_ON;
+    RCC_OscInitStruct.PLL.PLLSource = RCC_PLLSOURCE_HSE;
+    RCC_OscInitStruct.PLL.PLLM = 15;
+    RCC_OscInitStruct.PLL.PLLN = 216;
+    RCC_OscInitStruct.PLL.PLLP = RCC_PLLP_DIV2;
+    RCC_OscInitStruct.PLL.PLLQ = 2;
+    RCC_OscInitStruct.PLL.PLLR = 2;
+    if (HAL_RCC_OscConfig(&RCC_OscInitStruct) != HAL_OK)
+        return RES_NOK;
+
+    /* Activate the Over-Drive mode */
+    if (HAL_PWREx_EnableOverDrive() != HAL_OK)
+        return RES_NOK;
+
+    /* Initializes the CPU, AHB and APB buses clocks */
+    RCC_ClkInitStruct.ClockType = RCC_CLOCKTYPE_HCLK | RCC_CLOCKTYPE_SYSCLK |RCC_CLOCKTYPE_PCLK1 | RCC_CLOCKTYPE_PCLK2;
+    RCC_ClkInitStruct.SYSCLKSource = RCC_SYSCLKSOURCE_PLLCLK;
+    RCC_ClkInitStruct.AHBCLKDivider = RCC_SYSCLK_DIV1;
+    RCC_ClkInitStruct.APB1CLKDivider = RCC_HCLK_DIV4;
+    RCC_ClkInitStruct.APB2CLKDivider = RCC_HCLK_DIV2;
+
+    if (HAL_RCC_ClockConfig(&RCC_ClkInitStruct, FLASH_LATENCY_5) != HAL_OK)
+        return RES_NOK;
+
+    return bsp_rcc_us_timer_init();
+}
+
+/* Initialization of microsecond timer, see header file for details */
+uint8_t bsp_rcc_us_timer_init(void)
+{
+    uint32_t cycles_per_us = HAL_RCC_GetHCLKFreq() / 1000000;
+
+    if (!cycles_per_us)
+        return RES_NOT_SUPPORTED;
+
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+
+    us_timer.cycles = DWT->CYCCNT;
+    us_timer.cycles_per_us = cycles_per_us;
+
+    __set_PRIMASK(primask);
+
+    return RES_OK;
+}
+
+/* Get time of microsecond timer, see header file for details */
+uint32_t bsp_rcc_us_get(void)
+{
+    if (!us_timer.cycles_per_us)
+        return 0;
+
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+
+    /* Remainder of cycles is kept, so the time does not drift */
+    uint32_t elapsed_us = (DWT->CYCCNT - us_timer.cycles) / us_timer.cycles_per_us;
+    us_timer.cycles += elapsed_us * us_timer.cycles_per_us;
+    us_timer.time_us += elapsed_us;
+
+    uint32_t time_us = us_timer.time_us;
+
+    __set_PRIMASK(primask);
+
+    return time_us;
+}
+
+/* Get frequency of TIM internal clock, see header file for details */
+uint32_t bsp_rcc_apb_timer_freq_get(TIM_TypeDef *instance)
+{
+    if (!IS_TIM_INSTANCE(instance))
+        return 0;
+
+    uint32_t timclk_prescaler = LL_RCC_GetTIMPrescaler() >> RCC_DCKCFGR_TIMPRE_Pos;
+    uint32_t hclk_freq = HAL_RCC_GetHCLKFreq();
+    uint32_t pclk_freq = (TIM_APB_NUM_CLOCK_GET(instance) == 2) ? HAL_RCC_GetPCLK2Freq() : HAL_RCC_GetPCLK1Freq();
+
+    uint32_t tim_freq = 0;
+
+    tim_freq = pclk_freq * (2UL << timclk_prescaler);
+    tim_freq = (tim_freq > hclk_freq) ? hclk_freq : tim_freq;
+
+    return tim_freq;
+}
+
 /** @} */
\ No newline at end of file
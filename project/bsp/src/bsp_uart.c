@@ -1,941 +1,1326 @@
-/**
-\file
-\author JavaLandau
-\copyright MIT License
-\brief BSP UART module
-
-The file includes implementation of BSP layer of the UART
-*/
-
-#include "common.h"
-#include "bsp_uart.h"
-#include <stdlib.h>
-#include <string.h>
-#include <stdbool.h>
-#include "stm32f4xx_ll_usart.h"
-
-/** 
- * \defgroup bsp BSP
- * \brief Board suppport package
-*/
-
-/** 
- * \defgroup bsp_uart BSP UART
- * \brief Module of BSP UART
- * \ingroup bsp
- * @{
-*/
-
-/** MACRO BSP UART word length typecasting
- * 
- * The macro makes typecasting of \ref uart_wordlen to STM32 HAL UART word length
- * 
- * \param[in] X BSP UART word length
- * \return STM32 HAL UART word length
-*/
-#define HAL_UART_WORDLEN_TO(X)     (((X) == BSP_UART_WORDLEN_8) ? UART_WORDLENGTH_8B : UART_WORDLENGTH_9B)
-
-/** MACRO BSP UART stop bits count typecasting
- * 
- * The macro makes typecasting of \ref uart_stopbits to STM32 HAL UART stop bits count
- * 
- * \param[in] X BSP UART stop bits count
- * \return STM32 HAL UART stop bits count
-*/
-#define HAL_UART_STOPBITS_TO(X)    (((X) == BSP_UART_STOPBITS_1) ? UART_STOPBITS_1 : UART_STOPBITS_2)
-
-/** MACRO BSP UART parity type typecasting
- * 
- * The macro makes typecasting of \ref uart_parity to STM32 HAL UART parity type
- * 
- * \param[in] X BSP UART parity type
- * \return STM32 HAL UART parity type
-*/
-#define HAL_UART_PARITY_TO(X)      (((X) == BSP_UART_PARITY_NONE) ? UART_PARITY_NONE : \
-                                    (((X) == BSP_UART_PARITY_EVEN) ? UART_PARITY_EVEN : UART_PARITY_ODD))
-
-/// Context of the BSP UART instance
-struct uart_ctx {
-    struct uart_init_ctx init;  ///< Initializing context of the instance
-    void *tx_buff;              ///< Sent buffer used by DMA TX
-    void *rx_buff;              ///< Received buffer used by DMA RX
-    uint16_t rx_idx_get;        ///< Read poisition in \ref rx_buff used as ring buffer
-    uint16_t rx_idx_set;        ///< Write poisition in \ref rx_buff used as ring buffer
-    bool frame_error;           ///< Flag whetner UART frame error is occured, used to separate LIN break from other frame errors
-};
-
-/** Array of BSP UART instances
- * 
- * Includes three instances:  
- * \ref BSP_UART_TYPE_CLI       - CLI using STM32 UART4 TX/RX  
- * \ref BSP_UART_TYPE_RS232_TX  - RS-232 TX channel using STM32 USART2 RX  
- * \ref BSP_UART_TYPE_RS232_RX  - RS-232 RX channel using STM32 USART3 RX
-*/
-static struct {
-    UART_HandleTypeDef uart;    ///< STM32 HAL UART instance
-    struct uart_ctx *ctx;       ///< Context of the instance
-} uart_obj[BSP_UART_TYPE_MAX] = {
-    {.uart = {.Instance = UART4}, .ctx = NULL},
-    {.uart = {.Instance = USART2}, .ctx = NULL},
-    {.uart = {.Instance = USART3}, .ctx = NULL}
-};
-
-/** Get BSP UART type by STM32 HAL UART instance
- * 
- * \param[in] instance STM32 HAL UART instance
- * \return BSP UART type on success \ref BSP_UART_TYPE_MAX otherwise
- */
-static enum uart_type __uart_type_get(USART_TypeDef *instance)
-{
-    if (instance == UART4)
-        return BSP_UART_TYPE_CLI;
-    else if (instance == USART2)
-        return BSP_UART_TYPE_RS232_TX;
-    else if (instance == USART3)
-        return BSP_UART_TYPE_RS232_RX;
-    else
-        return BSP_UART_TYPE_MAX;
-}
-
-/** STM32 DMA UART deinitialization
- * 
- * The function executes DMA TX/RX (according to BSP UART type) deinitialization
- * 
- * \param[in] type BSP UART type
- * \return \ref RES_OK on success error otherwise
- */
-static uint8_t __uart_dma_deinit(enum uart_type type)
-{
-    if (!UART_TYPE_VALID(type) || !uart_obj[type].ctx)
-        return RES_INVALID_PAR;
-
-    switch (type) {
-    case BSP_UART_TYPE_CLI:
-        HAL_NVIC_DisableIRQ(DMA1_Stream2_IRQn);
-        HAL_NVIC_DisableIRQ(DMA1_Stream4_IRQn);
-        break;
-
-    case BSP_UART_TYPE_RS232_TX:
-        HAL_NVIC_DisableIRQ(DMA1_Stream5_IRQn);
-        break;
-
-    case BSP_UART_TYPE_RS232_RX:
-        HAL_NVIC_DisableIRQ(DMA1_Stream1_IRQn);
-        break;
-
-    default:
-        break;
-    }
-
-    DMA_HandleTypeDef *hdma_tx = uart_obj[type].uart.hdmatx;
-    DMA_HandleTypeDef *hdma_rx = uart_obj[type].uart.hdmarx;
-
-    if (hdma_tx) {
-        if (HAL_DMA_DeInit(hdma_tx) != HAL_OK)
-            return RES_NOK;
-
-        uart_obj[type].uart.hdmatx = NULL;
-        free(hdma_tx);
-    }
-
-    if (hdma_rx) {
-        if (HAL_DMA_DeInit(hdma_rx) != HAL_OK)
-            return RES_NOK;
-
-        uart_obj[type].uart.hdmarx = NULL;
-        free(hdma_rx);
-    }
-
-    return RES_OK;
-}
-
-/** STM32 UART MSP deinitialization
- * 
- * The function executes GPIO, DMA deinitialization, disables corresponding clocks
- * 
- * \param[in] type BSP UART type
- * \return \ref RES_OK on success error otherwise
- */
-static uint8_t __uart_msp_deinit(enum uart_type type)
-{
-    if (!UART_TYPE_VALID(type) || !uart_obj[type].ctx)
-        return RES_INVALID_PAR;
-
-    uint8_t res = __uart_dma_deinit(type);
-
-    if (res != RES_OK)
-        return res;
-
-    switch (type) {
-    case BSP_UART_TYPE_CLI:
-        HAL_NVIC_DisableIRQ(UART4_IRQn);
-        HAL_GPIO_DeInit(GPIOA, GPIO_PIN_0 | GPIO_PIN_1);
-        __HAL_RCC_UART4_CLK_DISABLE();
-
-        break;
-
-    case BSP_UART_TYPE_RS232_TX:
-        HAL_NVIC_DisableIRQ(USART2_IRQn);
-        HAL_GPIO_DeInit(GPIOA, GPIO_PIN_3);
-        __HAL_RCC_USART2_CLK_DISABLE();
-
-        break;
-
-    case BSP_UART_TYPE_RS232_RX:
-        HAL_NVIC_DisableIRQ(USART3_IRQn);
-        HAL_GPIO_DeInit(GPIOC, GPIO_PIN_5);
-        __HAL_RCC_USART3_CLK_DISABLE();
-
-        break;
-
-    default:
-        break;
-    }
-
-    return RES_OK;
-}
-
-/** STM32 DMA UART initialization
- * 
- * The function executes DMA TX/RX (according to BSP UART type) initialization
- * 
- * \param[in] type BSP UART type
- * \return \ref RES_OK on success error otherwise
- */
-static uint8_t __uart_dma_init(enum uart_type type)
-{
-    if (!UART_TYPE_VALID(type) || !uart_obj[type].ctx)
-        return RES_INVALID_PAR;
-
-    if (__HAL_RCC_DMA1_IS_CLK_DISABLED())
-        __HAL_RCC_DMA1_CLK_ENABLE();
-
-    DMA_HandleTypeDef *hdma_tx = uart_obj[type].uart.hdmatx;
-    DMA_HandleTypeDef *hdma_rx = uart_obj[type].uart.hdmarx;
-
-    /* Free DMA UART instance if was allocated */
-    if (hdma_tx) {
-        uart_obj[type].uart.hdmatx = NULL;
-
-        free(hdma_tx);
-        hdma_tx = NULL;
-    }
-
-    if (hdma_rx) {
-        uart_obj[type].uart.hdmarx = NULL;
-
-        free(hdma_rx);
-        hdma_rx = NULL;
-    }
-
-    uint8_t res = RES_OK;
-    IRQn_Type irq_type;
-
-    /* DMA UART initialization */
-    switch (type) {
-    case BSP_UART_TYPE_CLI:
-        hdma_tx = (DMA_HandleTypeDef*)malloc(sizeof(DMA_HandleTypeDef));
-
-        if (!hdma_tx) {
-            res = RES_MEMORY_ERR;
-            break;
-        }
-
-        hdma_tx->Instance                   = DMA1_Stream4;
-        hdma_tx->Init.Channel               = DMA_CHANNEL_4;
-        hdma_tx->Init.Direction             = DMA_MEMORY_TO_PERIPH;
-        hdma_tx->Init.PeriphInc             = DMA_PINC_DISABLE;
-        hdma_tx->Init.MemInc                = DMA_MINC_ENABLE;
-        hdma_tx->Init.PeriphDataAlignment   = DMA_PDATAALIGN_BYTE;
-        hdma_tx->Init.MemDataAlignment      = DMA_MDATAALIGN_BYTE;
-        hdma_tx->Init.Mode                  = DMA_NORMAL;
-        hdma_tx->Init.Priority              = DMA_PRIORITY_LOW;
-        hdma_tx->Init.FIFOMode              = DMA_FIFOMODE_DISABLE;
-        hdma_tx->Init.FIFOThreshold         = DMA_FIFO_THRESHOLD_FULL;
-        hdma_tx->Init.MemBurst              = DMA_MBURST_INC4;
-        hdma_tx->Init.PeriphBurst           = DMA_PBURST_INC4;
-
-        if (HAL_DMA_Init(hdma_tx) != HAL_OK) {
-            res = RES_NOK;
-            break;
-        }
-
-        uart_obj[type].uart.hdmatx = hdma_tx;
-        hdma_tx->Parent = &uart_obj[type].uart;
-
-        hdma_rx = (DMA_HandleTypeDef*)malloc(sizeof(DMA_HandleTypeDef));
-
-        if (!hdma_rx) {
-            res = RES_MEMORY_ERR;
-            break;
-        }
-
-        hdma_rx->Instance                   = DMA1_Stream2;
-        hdma_rx->Init.Channel               = DMA_CHANNEL_4;
-        hdma_rx->Init.Direction             = DMA_PERIPH_TO_MEMORY;
-        hdma_rx->Init.PeriphInc             = DMA_PINC_DISABLE;
-        hdma_rx->Init.MemInc                = DMA_MINC_ENABLE;
-        hdma_rx->Init.PeriphDataAlignment   = DMA_PDATAALIGN_BYTE;
-        hdma_rx->Init.MemDataAlignment      = DMA_MDATAALIGN_BYTE;
-        hdma_rx->Init.Mode                  = DMA_CIRCULAR;
-        hdma_rx->Init.Priority              = DMA_PRIORITY_LOW;
-        hdma_rx->Init.FIFOMode              = DMA_FIFOMODE_DISABLE;
-        hdma_rx->Init.FIFOThreshold         = DMA_FIFO_THRESHOLD_FULL;
-        hdma_rx->Init.MemBurst              = DMA_MBURST_INC4;
-        hdma_rx->Init.PeriphBurst           = DMA_MBURST_INC4;
-
-        if (HAL_DMA_Init(hdma_rx) != HAL_OK) {
-            res = RES_NOK;
-            break;
-        }
-
-        uart_obj[type].uart.hdmarx = hdma_rx;
-        hdma_rx->Parent = &uart_obj[type].uart;
-
-        HAL_NVIC_ClearPendingIRQ(DMA1_Stream2_IRQn);
-        HAL_NVIC_SetPriority(DMA1_Stream2_IRQn, 5, 0);
-        HAL_NVIC_EnableIRQ(DMA1_Stream2_IRQn);
-
-        HAL_NVIC_ClearPendingIRQ(DMA1_Stream4_IRQn);
-        HAL_NVIC_SetPriority(DMA1_Stream4_IRQn, 5, 0);
-        HAL_NVIC_EnableIRQ(DMA1_Stream4_IRQn);
-
-        break;
-
-    case BSP_UART_TYPE_RS232_TX:
-    case BSP_UART_TYPE_RS232_RX:
-        hdma_rx = (DMA_HandleTypeDef*)malloc(sizeof(DMA_HandleTypeDef));
-
-        hdma_rx->Instance                   = (uart_obj[type].uart.Instance == USART2) ? DMA1_Stream5 : DMA1_Stream1;
-        hdma_rx->Init.Channel               = DMA_CHANNEL_4;
-        hdma_rx->Init.Direction             = DMA_PERIPH_TO_MEMORY;
-        hdma_rx->Init.PeriphInc             = DMA_PINC_DISABLE;
-        hdma_rx->Init.MemInc                = DMA_MINC_ENABLE;
-        hdma_rx->Init.PeriphDataAlignment   = DMA_PDATAALIGN_HALFWORD;
-        hdma_rx->Init.MemDataAlignment      = DMA_PDATAALIGN_HALFWORD;
-        hdma_rx->Init.Mode                  = DMA_CIRCULAR;
-        hdma_rx->Init.Priority              = DMA_PRIORITY_LOW;
-        hdma_rx->Init.FIFOMode              = DMA_FIFOMODE_DISABLE;
-        hdma_rx->Init.FIFOThreshold         = DMA_FIFO_THRESHOLD_FULL;
-        hdma_rx->Init.MemBurst              = DMA_MBURST_INC4;
-        hdma_rx->Init.PeriphBurst           = DMA_MBURST_INC4;
-
-        if (HAL_DMA_Init(hdma_rx) != HAL_OK) {
-            res = RES_NOK;
-            break;
-        }
-
-        uart_obj[type].uart.hdmarx = hdma_rx;
-        hdma_rx->Parent = &uart_obj[type].uart;
-
-        irq_type = (uart_obj[type].uart.Instance == USART2) ? DMA1_Stream5_IRQn : DMA1_Stream1_IRQn;
-
-        HAL_NVIC_ClearPendingIRQ(irq_type);
-        HAL_NVIC_SetPriority(irq_type, 5, 0);
-        HAL_NVIC_EnableIRQ(irq_type);
-
-        break;
-
-    default:
-        break;
-    }
-
-    /* If initialization failed free allocated DMA UART instances */
-    if (res != RES_OK) {
-        uart_obj[type].uart.hdmatx = NULL;
-        uart_obj[type].uart.hdmarx = NULL;
-
-        if (hdma_tx)
-            free(hdma_tx);
-
-        if (hdma_rx)
-            free(hdma_rx);
-    }
-
-    return RES_OK;
-}
-
-/** STM32 UART MSP initialization
- * 
- * The function executes GPIO, DMA initialization, enables corresponding clocks
- * 
- * \param[in] type BSP UART type
- * \return \ref RES_OK on success error otherwise
- */
-static uint8_t __uart_msp_init(enum uart_type type)
-{
-    if (!UART_TYPE_VALID(type) || !uart_obj[type].ctx)
-        return RES_INVALID_PAR;
-
-    uint8_t res = RES_OK;
-    GPIO_InitTypeDef GPIO_InitStruct = {0};
-
-    if (__HAL_RCC_DMA1_IS_CLK_DISABLED())
-        __HAL_RCC_DMA1_CLK_ENABLE();
-
-    /* GPIO, RCC, NVIC initialization */
-    switch (type) {
-    case BSP_UART_TYPE_CLI:
-        if (__HAL_RCC_GPIOA_IS_CLK_DISABLED())
-            __HAL_RCC_GPIOA_CLK_ENABLE();
-
-        GPIO_InitStruct.Pin = GPIO_PIN_0 | GPIO_PIN_1;
-        GPIO_InitStruct.Mode = GPIO_MODE_AF_PP;
-        GPIO_InitStruct.Pull = GPIO_NOPULL;
-        GPIO_InitStruct.Speed = GPIO_SPEED_FREQ_VERY_HIGH;
-        GPIO_InitStruct.Alternate = GPIO_AF8_UART4;
-
-        HAL_GPIO_Init(GPIOA, &GPIO_InitStruct);
-
-        __HAL_RCC_UART4_CLK_ENABLE();
-
-        HAL_NVIC_ClearPendingIRQ(UART4_IRQn);
-        HAL_NVIC_SetPriority(UART4_IRQn, 5, 0);
-        HAL_NVIC_EnableIRQ(UART4_IRQn);
-
-        break;
-
-    case BSP_UART_TYPE_RS232_TX:
-        if (__HAL_RCC_GPIOA_IS_CLK_DISABLED())
-            __HAL_RCC_GPIOA_CLK_ENABLE();
-
-        GPIO_InitStruct.Pin = GPIO_PIN_3;
-        GPIO_InitStruct.Mode = GPIO_MODE_AF_PP;
-        GPIO_InitStruct.Pull = GPIO_NOPULL;
-        GPIO_InitStruct.Speed = GPIO_SPEED_FREQ_VERY_HIGH;
-        GPIO_InitStruct.Alternate = GPIO_AF7_USART2;
-
-        HAL_GPIO_Init(GPIOA, &GPIO_InitStruct);
-
-        __HAL_RCC_USART2_CLK_ENABLE();
-
-        HAL_NVIC_ClearPendingIRQ(USART2_IRQn);
-        HAL_NVIC_SetPriority(USART2_IRQn, 5, 0);
-        HAL_NVIC_EnableIRQ(USART2_IRQn);
-
-        break;
-
-    case BSP_UART_TYPE_RS232_RX:
-        if (__HAL_RCC_GPIOC_IS_CLK_DISABLED())
-            __HAL_RCC_GPIOC_CLK_ENABLE();
-
-        GPIO_InitStruct.Pin = GPIO_PIN_5;
-        GPIO_InitStruct.Mode = GPIO_MODE_AF_PP;
-        GPIO_InitStruct.Pull = GPIO_NOPULL;
-        GPIO_InitStruct.Speed = GPIO_SPEED_FREQ_VERY_HIGH;
-        GPIO_InitStruct.Alternate = GPIO_AF7_USART3;
-
-        HAL_GPIO_Init(GPIOC, &GPIO_InitStruct);
-
-        __HAL_RCC_USART3_CLK_ENABLE();
-
-        HAL_NVIC_ClearPendingIRQ(USART3_IRQn);
-        HAL_NVIC_SetPriority(USART3_IRQn, 5, 0);
-        HAL_NVIC_EnableIRQ(USART3_IRQn);
-
-        break;
-
-    default:
-        break;
-    }
-
-    /* If initialization was successfull 
-       do DMA UART initialization */
-    if (res == RES_OK)
-        res = __uart_dma_init(type);
-
-    return RES_OK;
-}
-
-/** Callback by data reception
- * 
- * The function is called by STM32 HAL UART by idle detection if data was received  
- * The function operates with write position of \ref uart_ctx::rx_buff, set overflow flag  
- * if appropriate event is occured
- * 
- * \param[in] huart STM32 HAL UART instance
- * \param[in] pos current write position of \ref uart_ctx::rx_buff
-*/
-static void __uart_rx_callback(UART_HandleTypeDef *huart, uint16_t pos)
-{
-    if (!huart)
-        return;
-
-    enum uart_type type = __uart_type_get(huart->Instance);
-
-    if (type != BSP_UART_TYPE_MAX) {
-        if (uart_obj[type].ctx && uart_obj[type].ctx->rx_buff) {
-            uint16_t idx_set = uart_obj[type].ctx->rx_idx_set;
-            uint16_t idx_get = uart_obj[type].ctx->rx_idx_get;
-            uint32_t rx_size = uart_obj[type].ctx->init.rx_size;
-            bool overflow = false;
-
-            pos = (pos == rx_size) ? 0 : pos;
-
-            if (idx_set == pos)
-                return;
-
-            if (pos < idx_set)
-                overflow = (idx_get > idx_set) || (idx_get <= pos);
-            else
-                overflow = (idx_get > idx_set) && (idx_get <= pos);
-
-            if (overflow && uart_obj[type].ctx->init.overflow_isr_cb)
-                uart_obj[type].ctx->init.overflow_isr_cb(type, uart_obj[type].ctx->init.params);
-
-            uart_obj[type].ctx->rx_idx_set = pos;
-        }
-    }
-}
-
-/** Callback by BSP UART error
- * 
- * The function is called from \ref __uart_irq_handler when BSP UART error occured  
- * The function is the wrapper over user callback \ref uart_init_ctx::error_isr_cb  
- * 
- * \param[in] type BSP UART type
- * \param[in] error mask of occured BSP UART errors
-*/
-static void __uart_error_callback(enum uart_type type, uint32_t error)
-{
-    if (!UART_TYPE_VALID(type))
-        return;
-
-    if (type != BSP_UART_TYPE_MAX) {
-        if (uart_obj[type].ctx && uart_obj[type].ctx->init.error_isr_cb)
-            uart_obj[type].ctx->init.error_isr_cb(type, error, uart_obj[type].ctx->init.params);
-    }
-}
-
-/** UART data mask
- * 
- * The function executes masking of UART data according to UART settings
- * 
- * \param[in] type BSP UART type
- * \param[in,out] data masked data
- * \param[in] len size of \p data
- */
-static void __uart_data_mask(enum uart_type type, uint16_t *data, uint16_t len)
-{
-    if (!UART_TYPE_VALID(type) || !uart_obj[type].ctx || !len)
-        return;
-
-    uint16_t data_mask = 0;
-    struct uart_init_ctx *params = &uart_obj[type].ctx->init;
-
-    if (params->wordlen == BSP_UART_WORDLEN_9)
-        data_mask = (params->parity == BSP_UART_PARITY_NONE) ? 0x1FF : 0xFF;
-    else
-        data_mask = (params->parity == BSP_UART_PARITY_NONE) ? 0xFF : 0x7F;
-
-    for (uint16_t i = 0; i < len; i++)
-        data[i] &= data_mask;
-}
-
-/* BSP UART instance start, see header file for details */
-uint8_t bsp_uart_start(enum uart_type type)
-{
-    if (!UART_TYPE_VALID(type))
-        return RES_INVALID_PAR;
-
-    if (uart_obj[type].ctx && uart_obj[type].ctx->rx_buff) {
-        uart_obj[type].ctx->rx_idx_get = 0;
-        uart_obj[type].ctx->rx_idx_set = 0;
-        uart_obj[type].ctx->frame_error = false;
-
-        if (HAL_UARTEx_ReceiveToIdle_DMA(&uart_obj[type].uart, uart_obj[type].ctx->rx_buff, uart_obj[type].ctx->init.rx_size) != HAL_OK)
-            return RES_NOK;
-
-        if (uart_obj[type].ctx->init.lin_enabled)
-            __HAL_UART_ENABLE_IT(&uart_obj[type].uart, UART_IT_LBD);
-    }
-
-    return RES_OK;
-}
-
-/* BSP UART instance stop, see header file for details */
-uint8_t bsp_uart_stop(enum uart_type type)
-{
-    if (!UART_TYPE_VALID(type) || !uart_obj[type].ctx)
-        return RES_INVALID_PAR;
-
-    HAL_StatusTypeDef hal_res = HAL_UART_DMAStop(&uart_obj[type].uart);
-
-    return (hal_res == HAL_OK) ? RES_OK : RES_NOK;
-}
-
-/* Flag whether BSP UART instance is started, see header file for details */
-bool bsp_uart_is_started(enum uart_type type)
-{
-    if (!UART_TYPE_VALID(type) || !uart_obj[type].ctx || !uart_obj[type].ctx->rx_buff)
-        return false;
-
-    bool status = (READ_BIT(uart_obj[type].uart.Instance->CR3, USART_CR3_DMAR) != 0) ||
-                  (READ_BIT(uart_obj[type].uart.Instance->CR3, USART_CR3_DMAT) != 0);
-
-    return status;
-}
-
-/* Send BSP UART data, see header file for details */
-uint8_t bsp_uart_write(enum uart_type type, void *data, uint16_t len, uint32_t tmt_ms)
-{
-    if (!UART_TYPE_VALID(type) || !uart_obj[type].ctx || !uart_obj[type].ctx->tx_buff)
-        return RES_INVALID_PAR;
-
-    if (!data || !len)
-        return RES_INVALID_PAR;
-
-    if (len > uart_obj[type].ctx->init.tx_size)
-        return RES_INVALID_PAR;
-
-    /* Wait when previous DMA UART sending is completed */
-    uint8_t res = RES_TIMEOUT;
-    uint32_t start_time = HAL_GetTick();
-    while((HAL_GetTick() - start_time) < tmt_ms) {
-        if (!READ_BIT(uart_obj[type].uart.Instance->CR3, USART_CR3_DMAT) && 
-            READ_BIT(uart_obj[type].uart.Instance->SR, USART_SR_TC)) {
-            res = RES_OK;
-            break;
-        }
-    }
-
-    if (res != RES_OK)
-        HAL_UART_AbortTransmit(&uart_obj[type].uart);
-
-    memcpy(uart_obj[type].ctx->tx_buff, data, len);
-
-    HAL_StatusTypeDef hal_res = HAL_UART_Transmit_DMA(&uart_obj[type].uart, uart_obj[type].ctx->tx_buff, len);
-
-    if (hal_res != HAL_OK)
-        return RES_NOK;
-
-    return RES_OK;
-}
-
-/* Flag whether received buffer is empty, see header file for details */
-bool bsp_uart_rx_buffer_is_empty(enum uart_type type)
-{
-    if (!UART_TYPE_VALID(type))
-        return true;
-
-    return (uart_obj[type].ctx->rx_idx_set == uart_obj[type].ctx->rx_idx_get);
-}
-
-/* Receive BSP UART data, see header file for details */
-uint8_t bsp_uart_read(enum uart_type type, void *data, uint16_t *len, uint32_t tmt_ms)
-{
-    if (!UART_TYPE_VALID(type) || !uart_obj[type].ctx || !uart_obj[type].ctx->rx_buff)
-        return RES_INVALID_PAR;
-
-    uint8_t res = RES_OK;
-    uint32_t start_time = HAL_GetTick();
-    uint16_t idx_get = uart_obj[type].ctx->rx_idx_get;
-
-    uint8_t data_size = 0;
-
-    if (type == BSP_UART_TYPE_CLI)
-        data_size = sizeof(uint8_t);
-    else
-        data_size = sizeof(uint16_t);
-
-    while(true) {
-        uint16_t idx_set = uart_obj[type].ctx->rx_idx_set;
-        if (idx_get != idx_set) {
-            uint16_t __len = 0;
-            uint32_t rx_size = uart_obj[type].ctx->init.rx_size;
-
-            if (idx_set > idx_get) {
-                if (data)
-                    memcpy(data, (uint8_t*)uart_obj[type].ctx->rx_buff + idx_get * data_size, (idx_set - idx_get) * data_size);
-                __len = idx_set - idx_get;
-            } else {
-                if (data) {
-                    memcpy(data, (uint8_t*)uart_obj[type].ctx->rx_buff + idx_get * data_size, (rx_size - idx_get) * data_size);
-                    memcpy((uint8_t*)data + data_size * (rx_size - idx_get), uart_obj[type].ctx->rx_buff, idx_set * data_size);
-                }
-                __len = rx_size - idx_get + idx_set;
-            }
-
-            if (len)
-                *len = __len;
-
-            if (data && type != BSP_UART_TYPE_CLI)
-                __uart_data_mask(type, (uint16_t*)data, __len);
-
-            uart_obj[type].ctx->rx_idx_get = idx_set;
-
-            break;
-        }
-
-        if ((HAL_GetTick() - start_time) >= tmt_ms) {
-            res = RES_TIMEOUT;
-            break;
-        }
-    }
-
-    return res;
-}
-
-/* Initialization of BSP UART instance, see header file for details */
-uint8_t bsp_uart_init(enum uart_type type, struct uart_init_ctx *init)
-{
-    if (!UART_TYPE_VALID(type) || !init)
-        return RES_INVALID_PAR;
-
-    if (!UART_WORDLEN_VALID(init->wordlen) || !UART_PARITY_VALID(init->parity))
-        return RES_INVALID_PAR;
-
-    if (!UART_STOPBITS_VALID(init->stopbits))
-        return RES_INVALID_PAR;
-
-    if (!init->baudrate)
-        return RES_INVALID_PAR;
-
-    if (type == BSP_UART_TYPE_CLI && init->lin_enabled)
-        return RES_NOT_SUPPORTED;
-
-    uint8_t rx_data_size = 0;
-
-    if (type == BSP_UART_TYPE_CLI)
-        rx_data_size = sizeof(uint8_t);
-    else
-        rx_data_size = sizeof(uint16_t);
-
-    uint8_t res = RES_OK;
-    HAL_StatusTypeDef hal_res = HAL_OK;
-
-    do {
-        if (!uart_obj[type].ctx) {
-            uart_obj[type].ctx = (struct uart_ctx*)malloc(sizeof(struct uart_ctx));
-
-            if (!uart_obj[type].ctx) {
-                res = RES_MEMORY_ERR;
-                break;
-            }
-
-            memset(uart_obj[type].ctx, 0, sizeof(struct uart_ctx));
-        } else {
-            res = bsp_uart_stop(type);
-
-            if (res != RES_OK)
-                return res;
-        }
-
-        uint32_t rx_size = init->rx_size;
-        if (uart_obj[type].ctx->rx_buff && uart_obj[type].ctx->init.rx_size != rx_size) {
-            free(uart_obj[type].ctx->rx_buff);
-            uart_obj[type].ctx->rx_buff = NULL;
-        }
-
-        uint32_t tx_size = init->tx_size;
-        if (uart_obj[type].ctx->tx_buff && uart_obj[type].ctx->init.tx_size != tx_size) {
-            free(uart_obj[type].ctx->tx_buff);
-            uart_obj[type].ctx->tx_buff = NULL;
-        }
-
-        if (!uart_obj[type].ctx->rx_buff && rx_size) {
-            uart_obj[type].ctx->rx_buff = malloc(rx_size * rx_data_size);
-
-            if (!uart_obj[type].ctx->rx_buff) {
-                res = RES_MEMORY_ERR;
-                break;
-            }
-            memset(uart_obj[type].ctx->rx_buff, 0, rx_size * rx_data_size);
-        }
-
-        if (!uart_obj[type].ctx->tx_buff && tx_size) {
-            uart_obj[type].ctx->tx_buff = malloc(tx_size * sizeof(uint8_t));
-
-            if (!uart_obj[type].ctx->tx_buff) {
-                res = RES_MEMORY_ERR;
-                break;
-            }
-            memset(uart_obj[type].ctx->tx_buff, 0, tx_size * sizeof(uint8_t));
-        }
-
-        uart_obj[type].ctx->init = *init;
-
-        if (uart_obj[type].uart.gState == HAL_UART_STATE_RESET) {
-            res = __uart_msp_init(type);
-
-            if (res != RES_OK)
-                break;
-        }
-
-        uart_obj[type].uart.Init.BaudRate       = uart_obj[type].ctx->init.baudrate;
-        uart_obj[type].uart.Init.WordLength     = HAL_UART_WORDLEN_TO(uart_obj[type].ctx->init.wordlen);
-        uart_obj[type].uart.Init.StopBits       = HAL_UART_STOPBITS_TO(uart_obj[type].ctx->init.stopbits);
-        uart_obj[type].uart.Init.Parity         = HAL_UART_PARITY_TO(uart_obj[type].ctx->init.parity);
-        uart_obj[type].uart.Init.HwFlowCtl      = UART_HWCONTROL_NONE;
-        uart_obj[type].uart.Init.Mode           = (type == BSP_UART_TYPE_CLI) ? UART_MODE_TX_RX : UART_MODE_RX;
-        uart_obj[type].uart.Init.OverSampling   = UART_OVERSAMPLING_16;
-
-        if (!uart_obj[type].ctx->init.lin_enabled)
-            hal_res = HAL_UART_Init(&uart_obj[type].uart);
-        else
-            hal_res = HAL_LIN_Init(&uart_obj[type].uart, UART_LINBREAKDETECTLENGTH_11B);
-
-        if (hal_res != HAL_OK) {
-            res = RES_NOK;
-            break;
-        }
-
-        hal_res = HAL_UART_RegisterRxEventCallback(&uart_obj[type].uart, __uart_rx_callback);
-
-        if (hal_res != HAL_OK) {
-            res = RES_NOK;
-            break;
-        }
-
-        res = bsp_uart_start(type);
-
-        if (res != RES_OK)
-            break;
-
-    } while(0);
-
-    if (res != RES_OK) {
-        bsp_uart_deinit(type);
-    }
-
-    return res;
-}
-
-/* Deinitialization of BSP UART instance, see header file for details */
-uint8_t bsp_uart_deinit(enum uart_type type)
-{
-    if (!UART_TYPE_VALID(type))
-        return RES_INVALID_PAR;
-
-    uint8_t res = RES_OK;
-    HAL_StatusTypeDef hal_res = HAL_OK;
-
-    if (uart_obj[type].ctx) {
-        hal_res = HAL_UART_DMAStop(&uart_obj[type].uart);
-
-        if (hal_res != HAL_OK)
-            return RES_NOK;
-
-        hal_res = HAL_UART_DeInit(&uart_obj[type].uart);
-
-        if (hal_res != HAL_OK)
-            return RES_NOK;
-
-        res = __uart_msp_deinit(type);
-
-        if (res != RES_OK)
-            return res;
-
-        if (uart_obj[type].ctx->rx_buff)
-            free(uart_obj[type].ctx->rx_buff);
-
-        free(uart_obj[type].ctx);
-        uart_obj[type].ctx = NULL;
-    }
-
-    return res;
-}
-
-/** UART IRQ handler
- * 
- * The function is called from NVIC UART interrupts, processes receiption,  
- * errors and LIN break detection
- * 
- * \param[in] type BSP UART type
- */
-static void __uart_irq_handler(enum uart_type type)
-{
-    if (!UART_TYPE_VALID(type) || !uart_obj[type].ctx)
-        return;
-
-    uint32_t error = 0;
-    USART_TypeDef *instance = uart_obj[type].uart.Instance;
-
-    /* Workaround if UART error occurred before DMA receiver is enabled (see UART_Start_Receive_DMA) */
-    if (!HAL_IS_BIT_SET(instance->CR3, USART_CR3_DMAR)) {
-        // ORE flag is proccesed separately in HAL_UART_IRQHandler
-        if (!(instance->SR & USART_SR_ORE)) {
-            if (instance->SR & (USART_SR_PE | USART_SR_FE | USART_SR_NE)) {
-                // Clear mentioned errors
-                __HAL_UART_CLEAR_PEFLAG(&uart_obj[type].uart);
-                return;
-            }
-        }
-    }
-
-    /* Process LIN break detection if enabled */
-    if (LL_USART_IsEnabledLIN(instance) && LL_USART_IsEnabledIT_LBD(instance)) {
-        if (LL_USART_IsActiveFlag_LBD(instance)) {
-            uart_obj[type].ctx->frame_error = false;
-            LL_USART_ClearFlag_LBD(instance);
-
-            if (uart_obj[type].ctx->init.lin_break_isr_cb)
-                uart_obj[type].ctx->init.lin_break_isr_cb(type, uart_obj[type].ctx->init.params);
-        }
-
-        /* If after occured frame error LIN break is not detected 
-           generates frame error */
-        if (uart_obj[type].ctx->frame_error) {
-            error = BSP_UART_ERROR_FE;
-            uart_obj[type].ctx->frame_error = false;
-        } else {
-            if (LL_USART_IsActiveFlag_FE(instance)) {
-                if (LL_USART_IsActiveFlag_RXNE(instance)) {
-                    return;
-                } else {
-                    uart_obj[type].ctx->frame_error = true;
-                    LL_USART_ClearFlag_FE(instance);
-                }
-            }
-        }
-    }
-
-    HAL_UART_IRQHandler(&uart_obj[type].uart);
-
-    if ((uart_obj[type].uart.ErrorCode & BSP_UART_ERRORS_ALL) | error)
-        __uart_error_callback(type, (uart_obj[type].uart.ErrorCode & BSP_UART_ERRORS_ALL) | error);
-}
-
-/** NVIC UART4 IRQ handler */
-void UART4_IRQHandler(void)
-{
-    __uart_irq_handler(BSP_UART_TYPE_CLI);
-}
-
-/** NVIC USART2 IRQ handler */
-void USART2_IRQHandler(void)
-{
-    __uart_irq_handler(BSP_UART_TYPE_RS232_TX);
-}
-
-/** NVIC USART3 IRQ handler */
-void USART3_IRQHandler(void)
-{
-    __uart_irq_handler(BSP_UART_TYPE_RS232_RX);
-}
-
-/** NVIC DMA1 (Stream 1) IRQ handler */
-void DMA1_Stream1_IRQHandler(void)
-{
-    HAL_DMA_IRQHandler(uart_obj[BSP_UART_TYPE_RS232_RX].uart.hdmarx);
-}
-
-/** NVIC DMA1 (Stream 2) IRQ handler */
-void DMA1_Stream2_IRQHandler(void)
-{
-    HAL_DMA_IRQHandler(uart_obj[BSP_UART_TYPE_CLI].uart.hdmarx);
-}
-
-/** NVIC DMA1 (Stream 4) IRQ handler */
-void DMA1_Stream4_IRQHandler(void)
-{
-    HAL_DMA_IRQHandler(uart_obj[BSP_UART_TYPE_CLI].uart.hdmatx);
-}
-
-/** NVIC DMA1 (Stream 5) IRQ handler */
-void DMA1_Stream5_IRQHandler(void)
-{
-    HAL_DMA_IRQHandler(uart_obj[BSP_UART_TYPE_RS232_TX].uart.hdmarx);
-}
-
+/**
+\file
+\author JavaLandau
+\copyright MIT License
+\brief BSP UART module
+
+The file includes implementation of BSP layer of the UART
+*/
+
+#include "common.h"
+#include "bsp_uart.h"
+#include "spsc_ring.h"
+#include "bsp_rcc.h"
+#include <string.h>
+#include <stdbool.h>
+#include "stm32f4xx_ll_usart.h"
+
+/** 
+ * \defgroup bsp BSP
+ * \brief Board suppport package
+*/
+
+/** 
+ * \defgroup bsp_uart BSP UART
+ * \brief Module of BSP UART
+ * \ingroup bsp
+ * @{
+*/
+
+/** MACRO BSP UART word length typecasting
+ * 
+ * The macro makes typecasting of \ref uart_wordlen to STM32 HAL UART word length
+ * 
+ * \param[in] X BSP UART word length
+ * \return STM32 HAL UART word length
+*/
+#define HAL_UART_WORDLEN_TO(X)     (((X) == BSP_UART_WORDLEN_9) ? UART_WORDLENGTH_9B : UART_WORDLENGTH_8B)
+
+/** MACRO BSP UART stop bits count typecasting
+ * 
+ * The macro makes typecasting of \ref uart_stopbits to STM32 HAL UART stop bits count
+ * 
+ * \param[in] X BSP UART stop bits count
+ * \return STM32 HAL UART stop bits count
+*/
+#define HAL_UART_STOPBITS_TO(X)    (((X) == BSP_UART_STOPBITS_1) ? UART_STOPBITS_1 : UART_STOPBITS_2)
+
+/** MACRO BSP UART parity type typecasting
+ * 
+ * The macro makes typecasting of \ref uart_parity to STM32 HAL UART parity type
+ * 
+ * \param[in] X BSP UART parity type
+ * \return STM32 HAL UART parity type
+*/
+#define HAL_UART_PARITY_TO(X)      (((X) == BSP_UART_PARITY_NONE) ? UART_PARITY_NONE : \
+                                    (((X) == BSP_UART_PARITY_EVEN) ? UART_PARITY_EVEN : UART_PARITY_ODD))
+
+/** MACRO BSP UART oversampling
+ * 
+ * The macro selects STM32 HAL UART oversampling for baudrate,  
+ * oversampling by 8 is used only if baudrate is unreachable with oversampling by 16  
+ * \note All BSP UART instances are clocked from APB1
+ * 
+ * \param[in] X baudrate in bods
+ * \return STM32 HAL UART oversampling
+*/
+#define HAL_UART_OVERSAMPLING_GET(X) (((X) > (HAL_RCC_GetPCLK1Freq() / 16)) ? UART_OVERSAMPLING_8 : UART_OVERSAMPLING_16)
+
+/// Count of timestamps of chunks of received data kept for each BSP UART instance, power of two
+#define UART_RX_STAMPS_SIZE     (32)
+
+/** MACRO Definition of copying routine of received words
+ * 
+ * The macro defines function copying words of type \p T from the receive buffer  
+ * into 16 bits words masked by \p MASK, so masking is resolved at compile time  
+ * for each UART format instead of per word
+ * 
+ * \param[in] NAME name of the function
+ * \param[in] T type of word in the receive buffer
+ * \param[in] MASK mask of data bits
+*/
+#define UART_RX_COPY_DEFINE(NAME, T, MASK)                              \
+    static void NAME(uint16_t *dst, const void *src, uint16_t len)      \
+    {                                                                   \
+        const T *__src = (const T*)src;                                 \
+        for (uint16_t i = 0; i < len; i++)                              \
+            dst[i] = __src[i] & (MASK);                                 \
+    }
+
+/// Timestamp of chunk of received data
+struct uart_rx_stamp {
+    uint32_t end;               ///< Position of the word following the chunk, counted as \ref spsc_ring::head
+    uint32_t time_us;           ///< Arrival time of the last word of the chunk by \ref bsp_rcc_us_get
+};
+
+/// Context of the BSP UART instance
+struct uart_ctx {
+    struct uart_init_ctx init;  ///< Initializing context of the instance
+    void *tx_buff;              ///< Sent buffer used by DMA TX
+    void *rx_buff;              ///< Received buffer used by DMA RX
+    uint8_t rx_word_size;       ///< Size of word in \ref rx_buff in bytes, see \ref __uart_rx_word_size_get
+    void (*rx_copy)(uint16_t *dst, const void *src, uint16_t len);  ///< Copying routine of received words, see \ref UART_RX_COPY_DEFINE
+    struct spsc_ring rx_ring;   ///< Ring over \ref rx_buff, DMA RX is producer
+    struct spsc_ring rx_stamps; ///< Ring of timestamps of chunks of \ref rx_ring, callback by data reception is producer
+    uint32_t rx_stamp_time;     ///< Arrival time of the last word of released chunks
+    uint32_t char_time_ns;      ///< Character time in ns, see \ref __uart_char_time_calc
+    volatile uint32_t brr_pending;  ///< Baudrate register applied by \ref __uart_rx_callback on idle line, 0 if none
+    uint32_t baudrate_pending;  ///< Baudrate of \ref brr_pending in bods
+    struct spsc_ring tx_ring;   ///< Ring over \ref tx_buff, DMA TX is consumer
+    volatile uint16_t tx_chunk; ///< Count of bytes of \ref tx_ring sent by DMA TX now, 0 if DMA TX is idle
+    bool frame_error;           ///< Flag whetner UART frame error is occured, used to separate LIN break from other frame errors
+};
+
+/// Static storage of CLI instance
+struct uart_ram_cli {
+    struct uart_ctx ctx;                            ///< Context of the instance
+    DMA_HandleTypeDef hdma_tx;                      ///< STM32 HAL DMA TX instance
+    DMA_HandleTypeDef hdma_rx;                      ///< STM32 HAL DMA RX instance
+    uint8_t tx_buff[BSP_UART_CLI_TX_SIZE];          ///< Sent buffer
+    uint8_t rx_buff[BSP_UART_CLI_RX_SIZE];          ///< Received buffer
+    struct uart_rx_stamp rx_stamps[UART_RX_STAMPS_SIZE];    ///< Timestamps of chunks of received data
+};
+
+/// Static storage of RS-232 instance
+struct uart_ram_rs232 {
+    struct uart_ctx ctx;                            ///< Context of the instance
+    DMA_HandleTypeDef hdma_rx;                      ///< STM32 HAL DMA RX instance
+    uint16_t rx_buff[BSP_UART_RS232_RX_SIZE];       ///< Received buffer, used by bytes for 8 bits words
+    struct uart_rx_stamp rx_stamps[UART_RX_STAMPS_SIZE];    ///< Timestamps of chunks of received data
+};
+
+_Static_assert(sizeof(struct uart_ram_cli) <= BSP_UART_RAM_CLI, "Static RAM of BSP UART CLI exceeds BSP_UART_RAM_CLI");
+_Static_assert(sizeof(struct uart_ram_rs232) <= BSP_UART_RAM_RS232, "Static RAM of BSP UART RS-232 line exceeds BSP_UART_RAM_RS232");
+
+static struct uart_ram_cli uart_ram_cli;           ///< Static storage of \ref BSP_UART_TYPE_CLI
+static struct uart_ram_rs232 uart_ram_rs232_tx;    ///< Static storage of \ref BSP_UART_TYPE_RS232_TX
+static struct uart_ram_rs232 uart_ram_rs232_rx;    ///< Static storage of \ref BSP_UART_TYPE_RS232_RX
+
+/** Array of BSP UART instances
+ * 
+ * Includes three instances:  
+ * \ref BSP_UART_TYPE_CLI       - CLI using STM32 UART4 TX/RX  
+ * \ref BSP_UART_TYPE_RS232_TX  - RS-232 TX channel using STM32 USART2 RX  
+ * \ref BSP_UART_TYPE_RS232_RX  - RS-232 RX channel using STM32 USART3 RX  
+ * All storage of the instances is static, see \ref BSP_UART_RAM_CLI & \ref BSP_UART_RAM_RS232
+*/
+static struct {
+    UART_HandleTypeDef uart;    ///< STM32 HAL UART instance
+    struct uart_ctx *ctx;       ///< Context of the instance, NULL if the instance is not initialized
+    struct uart_ctx *ram_ctx;   ///< Static storage of \ref ctx
+    DMA_HandleTypeDef *hdma_tx; ///< Static storage of STM32 HAL DMA TX instance, NULL if not used
+    DMA_HandleTypeDef *hdma_rx; ///< Static storage of STM32 HAL DMA RX instance
+    void *tx_buff;              ///< Static storage of sent buffer, NULL if not used
+    uint32_t tx_buff_size;      ///< Size of \ref tx_buff in bytes
+    void *rx_buff;              ///< Static storage of received buffer
+    uint32_t rx_buff_size;      ///< Size of \ref rx_buff in bytes
+    struct uart_rx_stamp *rx_stamps;    ///< Static storage of timestamps of chunks of received data
+} uart_obj[BSP_UART_TYPE_MAX] = {
+    {.uart = {.Instance = UART4}, .ctx = NULL, .ram_ctx = &uart_ram_cli.ctx,
+     .hdma_tx = &uart_ram_cli.hdma_tx, .hdma_rx = &uart_ram_cli.hdma_rx,
+     .tx_buff = uart_ram_cli.tx_buff, .tx_buff_size = sizeof(uart_ram_cli.tx_buff),
+     .rx_buff = uart_ram_cli.rx_buff, .rx_buff_size = sizeof(uart_ram_cli.rx_buff),
+     .rx_stamps = uart_ram_cli.rx_stamps},
+    {.uart = {.Instance = USART2}, .ctx = NULL, .ram_ctx = &uart_ram_rs232_tx.ctx,
+     .hdma_tx = NULL, .hdma_rx = &uart_ram_rs232_tx.hdma_rx,
+     .tx_buff = NULL, .tx_buff_size = 0,
+     .rx_buff = uart_ram_rs232_tx.rx_buff, .rx_buff_size = sizeof(uart_ram_rs232_tx.rx_buff),
+     .rx_stamps = uart_ram_rs232_tx.rx_stamps},
+    {.uart = {.Instance = USART3}, .ctx = NULL, .ram_ctx = &uart_ram_rs232_rx.ctx,
+     .hdma_tx = NULL, .hdma_rx = &uart_ram_rs232_rx.hdma_rx,
+     .tx_buff = NULL, .tx_buff_size = 0,
+     .rx_buff = uart_ram_rs232_rx.rx_buff, .rx_buff_size = sizeof(uart_ram_rs232_rx.rx_buff),
+     .rx_stamps = uart_ram_rs232_rx.rx_stamps}
+};
+
+UART_RX_COPY_DEFINE(__uart_rx_copy_7bit, uint8_t, 0x7F)     ///< Copying of 7 data bits received as byte
+UART_RX_COPY_DEFINE(__uart_rx_copy_8bit, uint8_t, 0xFF)     ///< Copying of 8 data bits received as byte
+UART_RX_COPY_DEFINE(__uart_rx_copy_9bit, uint16_t, 0x1FF)   ///< Copying of 9 data bits received as halfword
+
+/** Size of word in receive buffer
+ * 
+ * DMA transfers only low byte of UART data register if data bits with parity bit excluded  
+ * fit in byte, so halfword is needed only for 9 bits word length without parity  
+ * \note Parity bit of 9 bits word is not transferred, parity bit of 8 bits word is masked on copying
+ * 
+ * \param[in] type BSP UART type
+ * \param[in] init initializing context of the instance
+ * \return size of word in bytes
+ */
+static uint8_t __uart_rx_word_size_get(enum uart_type type, const struct uart_init_ctx *init)
+{
+    if (type != BSP_UART_TYPE_CLI && init->wordlen == BSP_UART_WORDLEN_9 && init->parity == BSP_UART_PARITY_NONE)
+        return sizeof(uint16_t);
+
+    return sizeof(uint8_t);
+}
+
+/** Get BSP UART type by STM32 HAL UART instance
+ * 
+ * \param[in] instance STM32 HAL UART instance
+ * \return BSP UART type on success \ref BSP_UART_TYPE_MAX otherwise
+ */
+static enum uart_type __uart_type_get(USART_TypeDef *instance)
+{
+    if (instance == UART4)
+        return BSP_UART_TYPE_CLI;
+    else if (instance == USART2)
+        return BSP_UART_TYPE_RS232_TX;
+    else if (instance == USART3)
+        return BSP_UART_TYPE_RS232_RX;
+    else
+        return BSP_UART_TYPE_MAX;
+}
+
+/** STM32 DMA UART deinitialization
+ * 
+ * The function executes DMA TX/RX (according to BSP UART type) deinitialization
+ * 
+ * \param[in] type BSP UART type
+ * \return \ref RES_OK on success error otherwise
+ */
+static uint8_t __uart_dma_deinit(enum uart_type type)
+{
+    if (!UART_TYPE_VALID(type) || !uart_obj[type].ctx)
+        return RES_INVALID_PAR;
+
+    switch (type) {
+    case BSP_UART_TYPE_CLI:
+        HAL_NVIC_DisableIRQ(DMA1_Stream2_IRQn);
+        HAL_NVIC_DisableIRQ(DMA1_Stream4_IRQn);
+        break;
+
+    case BSP_UART_TYPE_RS232_TX:
+        HAL_NVIC_DisableIRQ(DMA1_Stream5_IRQn);
+        break;
+
+    case BSP_UART_TYPE_RS232_RX:
+        HAL_NVIC_DisableIRQ(DMA1_Stream1_IRQn);
+        break;
+
+    default:
+        break;
+    }
+
+    DMA_HandleTypeDef *hdma_tx = uart_obj[type].uart.hdmatx;
+    DMA_HandleTypeDef *hdma_rx = uart_obj[type].uart.hdmarx;
+
+    if (hdma_tx) {
+        if (HAL_DMA_DeInit(hdma_tx) != HAL_OK)
+            return RES_NOK;
+
+        uart_obj[type].uart.hdmatx = NULL;
+    }
+
+    if (hdma_rx) {
+        if (HAL_DMA_DeInit(hdma_rx) != HAL_OK)
+            return RES_NOK;
+
+        uart_obj[type].uart.hdmarx = NULL;
+    }
+
+    return RES_OK;
+}
+
+/** STM32 UART MSP deinitialization
+ * 
+ * The function executes GPIO, DMA deinitialization, disables corresponding clocks
+ * 
+ * \param[in] type BSP UART type
+ * \return \ref RES_OK on success error otherwise
+ */
+static uint8_t __uart_msp_deinit(enum uart_type type)
+{
+    if (!UART_TYPE_VALID(type) || !uart_obj[type].ctx)
+        return RES_INVALID_PAR;
+
+    uint8_t res = __uart_dma_deinit(type);
+
+    if (res != RES_OK)
+        return res;
+
+    switch (type) {
+    case BSP_UART_TYPE_CLI:
+        HAL_NVIC_DisableIRQ(UART4_IRQn);
+        HAL_GPIO_DeInit(GPIOA, GPIO_PIN_0 | GPIO_PIN_1);
+        __HAL_RCC_UART4_CLK_DISABLE();
+
+        break;
+
+    case BSP_UART_TYPE_RS232_TX:
+        HAL_NVIC_DisableIRQ(USART2_IRQn);
+        HAL_GPIO_DeInit(GPIOA, GPIO_PIN_3);
+        __HAL_RCC_USART2_CLK_DISABLE();
+
+        break;
+
+    case BSP_UART_TYPE_RS232_RX:
+        HAL_NVIC_DisableIRQ(USART3_IRQn);
+        HAL_GPIO_DeInit(GPIOC, GPIO_PIN_5);
+        __HAL_RCC_USART3_CLK_DISABLE();
+
+        break;
+
+    default:
+        break;
+    }
+
+    return RES_OK;
+}
+
+/** STM32 DMA UART initialization
+ * 
+ * The function executes DMA TX/RX (according to BSP UART type) initialization
+ * 
+ * \param[in] type BSP UART type
+ * \return \ref RES_OK on success error otherwise
+ */
+static uint8_t __uart_dma_init(enum uart_type type)
+{
+    if (!UART_TYPE_VALID(type) || !uart_obj[type].ctx)
+        return RES_INVALID_PAR;
+
+    if (__HAL_RCC_DMA1_IS_CLK_DISABLED())
+        __HAL_RCC_DMA1_CLK_ENABLE();
+
+    /* DMA UART instances are static, they are reinitialized in place */
+    DMA_HandleTypeDef *hdma_tx = uart_obj[type].hdma_tx;
+    DMA_HandleTypeDef *hdma_rx = uart_obj[type].hdma_rx;
+
+    uart_obj[type].uart.hdmatx = NULL;
+    uart_obj[type].uart.hdmarx = NULL;
+
+    if (hdma_tx)
+        memset(hdma_tx, 0, sizeof(DMA_HandleTypeDef));
+
+    memset(hdma_rx, 0, sizeof(DMA_HandleTypeDef));
+
+    uint8_t res = RES_OK;
+    IRQn_Type irq_type;
+
+    /* DMA UART initialization */
+    switch (type) {
+    case BSP_UART_TYPE_CLI:
+        hdma_tx->Instance                   = DMA1_Stream4;
+        hdma_tx->Init.Channel               = DMA_CHANNEL_4;
+        hdma_tx->Init.Direction             = DMA_MEMORY_TO_PERIPH;
+        hdma_tx->Init.PeriphInc             = DMA_PINC_DISABLE;
+        hdma_tx->Init.MemInc                = DMA_MINC_ENABLE;
+        hdma_tx->Init.PeriphDataAlignment   = DMA_PDATAALIGN_BYTE;
+        hdma_tx->Init.MemDataAlignment      = DMA_MDATAALIGN_BYTE;
+        hdma_tx->Init.Mode                  = DMA_NORMAL;
+        hdma_tx->Init.Priority              = DMA_PRIORITY_LOW;
+        hdma_tx->Init.FIFOMode              = DMA_FIFOMODE_DISABLE;
+        hdma_tx->Init.FIFOThreshold         = DMA_FIFO_THRESHOLD_FULL;
+        hdma_tx->Init.MemBurst              = DMA_MBURST_INC4;
+        hdma_tx->Init.PeriphBurst           = DMA_PBURST_INC4;
+
+        if (HAL_DMA_Init(hdma_tx) != HAL_OK) {
+            res = RES_NOK;
+            break;
+        }
+
+        uart_obj[type].uart.hdmatx = hdma_tx;
+        hdma_tx->Parent = &uart_obj[type].uart;
+
+        hdma_rx->Instance                   = DMA1_Stream2;
+        hdma_rx->Init.Channel               = DMA_CHANNEL_4;
+        hdma_rx->Init.Direction             = DMA_PERIPH_TO_MEMORY;
+        hdma_rx->Init.PeriphInc             = DMA_PINC_DISABLE;
+        hdma_rx->Init.MemInc                = DMA_MINC_ENABLE;
+        hdma_rx->Init.PeriphDataAlignment   = DMA_PDATAALIGN_BYTE;
+        hdma_rx->Init.MemDataAlignment      = DMA_MDATAALIGN_BYTE;
+        hdma_rx->Init.Mode                  = DMA_CIRCULAR;
+        hdma_rx->Init.Priority              = DMA_PRIORITY_LOW;
+        hdma_rx->Init.FIFOMode              = DMA_FIFOMODE_DISABLE;
+        hdma_rx->Init.FIFOThreshold         = DMA_FIFO_THRESHOLD_FULL;
+        hdma_rx->Init.MemBurst              = DMA_MBURST_INC4;
+        hdma_rx->Init.PeriphBurst           = DMA_MBURST_INC4;
+
+        if (HAL_DMA_Init(hdma_rx) != HAL_OK) {
+            res = RES_NOK;
+            break;
+        }
+
+        uart_obj[type].uart.hdmarx = hdma_rx;
+        hdma_rx->Parent = &uart_obj[type].uart;
+
+        HAL_NVIC_ClearPendingIRQ(DMA1_Stream2_IRQn);
+        HAL_NVIC_SetPriority(DMA1_Stream2_IRQn, 5, 0);
+        HAL_NVIC_EnableIRQ(DMA1_Stream2_IRQn);
+
+        HAL_NVIC_ClearPendingIRQ(DMA1_Stream4_IRQn);
+        HAL_NVIC_SetPriority(DMA1_Stream4_IRQn, 5, 0);
+        HAL_NVIC_EnableIRQ(DMA1_Stream4_IRQn);
+
+        break;
+
+    case BSP_UART_TYPE_RS232_TX:
+    case BSP_UART_TYPE_RS232_RX:
+        hdma_rx->Instance                   = (uart_obj[type].uart.Instance == USART2) ? DMA1_Stream5 : DMA1_Stream1;
+        hdma_rx->Init.Channel               = DMA_CHANNEL_4;
+        hdma_rx->Init.Direction             = DMA_PERIPH_TO_MEMORY;
+        hdma_rx->Init.PeriphInc             = DMA_PINC_DISABLE;
+        hdma_rx->Init.MemInc                = DMA_MINC_ENABLE;
+        hdma_rx->Init.PeriphDataAlignment   = (uart_obj[type].ctx->rx_word_size == sizeof(uint16_t)) ? DMA_PDATAALIGN_HALFWORD : DMA_PDATAALIGN_BYTE;
+        hdma_rx->Init.MemDataAlignment      = (uart_obj[type].ctx->rx_word_size == sizeof(uint16_t)) ? DMA_MDATAALIGN_HALFWORD : DMA_MDATAALIGN_BYTE;
+        hdma_rx->Init.Mode                  = DMA_CIRCULAR;
+        hdma_rx->Init.Priority              = DMA_PRIORITY_LOW;
+        hdma_rx->Init.FIFOMode              = DMA_FIFOMODE_DISABLE;
+        hdma_rx->Init.FIFOThreshold         = DMA_FIFO_THRESHOLD_FULL;
+        hdma_rx->Init.MemBurst              = DMA_MBURST_INC4;
+        hdma_rx->Init.PeriphBurst           = DMA_MBURST_INC4;
+
+        if (HAL_DMA_Init(hdma_rx) != HAL_OK) {
+            res = RES_NOK;
+            break;
+        }
+
+        uart_obj[type].uart.hdmarx = hdma_rx;
+        hdma_rx->Parent = &uart_obj[type].uart;
+
+        irq_type = (uart_obj[type].uart.Instance == USART2) ? DMA1_Stream5_IRQn : DMA1_Stream1_IRQn;
+
+        HAL_NVIC_ClearPendingIRQ(irq_type);
+        HAL_NVIC_SetPriority(irq_type, 5, 0);
+        HAL_NVIC_EnableIRQ(irq_type);
+
+        break;
+
+    default:
+        break;
+    }
+
+    /* If initialization failed DMA UART instances are detached */
+    if (res != RES_OK) {
+        uart_obj[type].uart.hdmatx = NULL;
+        uart_obj[type].uart.hdmarx = NULL;
+    }
+
+    return res;
+}
+
+/** STM32 UART MSP initialization
+ * 
+ * The function executes GPIO, DMA initialization, enables corresponding clocks
+ * 
+ * \param[in] type BSP UART type
+ * \return \ref RES_OK on success error otherwise
+ */
+static uint8_t __uart_msp_init(enum uart_type type)
+{
+    if (!UART_TYPE_VALID(type) || !uart_obj[type].ctx)
+        return RES_INVALID_PAR;
+
+    uint8_t res = RES_OK;
+    GPIO_InitTypeDef GPIO_InitStruct = {0};
+
+    if (__HAL_RCC_DMA1_IS_CLK_DISABLED())
+        __HAL_RCC_DMA1_CLK_ENABLE();
+
+    /* GPIO, RCC, NVIC initialization */
+    switch (type) {
+    case BSP_UART_TYPE_CLI:
+        if (__HAL_RCC_GPIOA_IS_CLK_DISABLED())
+            __HAL_RCC_GPIOA_CLK_ENABLE();
+
+        GPIO_InitStruct.Pin = GPIO_PIN_0 | GPIO_PIN_1;
+        GPIO_InitStruct.Mode = GPIO_MODE_AF_PP;
+        GPIO_InitStruct.Pull = GPIO_NOPULL;
+        GPIO_InitStruct.Speed = GPIO_SPEED_FREQ_VERY_HIGH;
+        GPIO_InitStruct.Alternate = GPIO_AF8_UART4;
+
+        HAL_GPIO_Init(GPIOA, &GPIO_InitStruct);
+
+        __HAL_RCC_UART4_CLK_ENABLE();
+
+        HAL_NVIC_ClearPendingIRQ(UART4_IRQn);
+        HAL_NVIC_SetPriority(UART4_IRQn, 5, 0);
+        HAL_NVIC_EnableIRQ(UART4_IRQn);
+
+        break;
+
+    case BSP_UART_TYPE_RS232_TX:
+        if (__HAL_RCC_GPIOA_IS_CLK_DISABLED())
+            __HAL_RCC_GPIOA_CLK_ENABLE();
+
+        GPIO_InitStruct.Pin = GPIO_PIN_3;
+        GPIO_InitStruct.Mode = GPIO_MODE_AF_PP;
+        GPIO_InitStruct.Pull = GPIO_NOPULL;
+        GPIO_InitStruct.Speed = GPIO_SPEED_FREQ_VERY_HIGH;
+        GPIO_InitStruct.Alternate = GPIO_AF7_USART2;
+
+        HAL_GPIO_Init(GPIOA, &GPIO_InitStruct);
+
+        __HAL_RCC_USART2_CLK_ENABLE();
+
+        HAL_NVIC_ClearPendingIRQ(USART2_IRQn);
+        HAL_NVIC_SetPriority(USART2_IRQn, 5, 0);
+        HAL_NVIC_EnableIRQ(USART2_IRQn);
+
+        break;
+
+    case BSP_UART_TYPE_RS232_RX:
+        if (__HAL_RCC_GPIOC_IS_CLK_DISABLED())
+            __HAL_RCC_GPIOC_CLK_ENABLE();
+
+        GPIO_InitStruct.Pin = GPIO_PIN_5;
+        GPIO_InitStruct.Mode = GPIO_MODE_AF_PP;
+        GPIO_InitStruct.Pull = GPIO_NOPULL;
+        GPIO_InitStruct.Speed = GPIO_SPEED_FREQ_VERY_HIGH;
+        GPIO_InitStruct.Alternate = GPIO_AF7_USART3;
+
+        HAL_GPIO_Init(GPIOC, &GPIO_InitStruct);
+
+        __HAL_RCC_USART3_CLK_ENABLE();
+
+        HAL_NVIC_ClearPendingIRQ(USART3_IRQn);
+        HAL_NVIC_SetPriority(USART3_IRQn, 5, 0);
+        HAL_NVIC_EnableIRQ(USART3_IRQn);
+
+        break;
+
+    default:
+        break;
+    }
+
+    /* If initialization was successfull 
+       do DMA UART initialization */
+    if (res == RES_OK)
+        res = __uart_dma_init(type);
+
+    return res;
+}
+
+/** Calculation of character time
+ * 
+ * The function is called on change of UART format only, so callback  
+ * by data reception does not divide 64 bits values
+ * 
+ * \param[in] params initializing context of BSP UART instance
+ * \return character time in ns including start bit, word bits (with parity) & stop bits
+*/
+static uint32_t __uart_char_time_calc(const struct uart_init_ctx *params)
+{
+    uint32_t frame_bits = 1 + params->wordlen + params->stopbits;
+
+    return (uint32_t)(((uint64_t)frame_bits * 1000000000) / params->baudrate);
+}
+
+/** Apply of baudrate pending since \ref bsp_uart_baudrate_set
+ * 
+ * Baud counters of USART are reloaded as soon as BRR is written, so BRR is written  
+ * only while no word is being received: on idle line or with receiver disabled
+ * 
+ * \param[in] type BSP UART type
+*/
+static void __uart_baudrate_apply(enum uart_type type)
+{
+    struct uart_ctx *ctx = uart_obj[type].ctx;
+    uint32_t brr = ctx->brr_pending;
+
+    if (!brr)
+        return;
+
+    WRITE_REG(uart_obj[type].uart.Instance->BRR, brr);
+
+    uart_obj[type].uart.Init.BaudRate = ctx->baudrate_pending;
+    ctx->init.baudrate = ctx->baudrate_pending;
+    ctx->char_time_ns = __uart_char_time_calc(&ctx->init);
+    ctx->brr_pending = 0;
+}
+
+/** Callback by data reception
+ * 
+ * The function is called by STM32 HAL UART by idle detection if data was received  
+ * The function commits words written by DMA into \ref uart_ctx::rx_ring, calls  
+ * overflow callback if unread words are overwritten. Pending baudrate is applied  
+ * on idle line, see \ref bsp_uart_baudrate_set
+ * 
+ * \param[in] huart STM32 HAL UART instance
+ * \param[in] pos current write position of \ref uart_ctx::rx_buff
+*/
+static void __uart_rx_callback(UART_HandleTypeDef *huart, uint16_t pos)
+{
+    if (!huart)
+        return;
+
+    enum uart_type type = __uart_type_get(huart->Instance);
+
+    if (type != BSP_UART_TYPE_MAX) {
+        if (uart_obj[type].ctx && uart_obj[type].ctx->rx_buff) {
+            struct spsc_ring *ring = &uart_obj[type].ctx->rx_ring;
+            uint32_t cnt = (pos - ring->head) & (ring->size - 1);
+            bool idle = (HAL_UARTEx_GetRxEventType(huart) == HAL_UART_RXEVENT_IDLE);
+
+            if (cnt) {
+                /* Half & full transfer events come with the last word, idle event comes  
+                   one character time after it. Timestamp is published before the words */
+                struct uart_rx_stamp stamp = {.end = ring->head + cnt, .time_us = bsp_rcc_us_get()};
+
+                if (idle)
+                    stamp.time_us -= uart_obj[type].ctx->char_time_ns / 1000;
+
+                spsc_ring_push(&uart_obj[type].ctx->rx_stamps, &stamp, 1);
+
+                if (spsc_ring_produced(ring, cnt) && uart_obj[type].ctx->init.overflow_isr_cb)
+                    uart_obj[type].ctx->init.overflow_isr_cb(type, uart_obj[type].ctx->init.params);
+            }
+
+            /* Line has been idle for a character time, no word is being received */
+            if (idle)
+                __uart_baudrate_apply(type);
+        }
+    }
+}
+
+/** Start of DMA TX of the next chunk
+ * 
+ * The function releases chunk sent by DMA TX from \ref uart_ctx::tx_ring  
+ * and starts sending of the next one if DMA TX is idle  
+ * \note Called from both thread & DMA TX interrupt, so it is executed with interrupts disabled
+ * 
+ * \param[in] type BSP UART type
+ * \param[in] sent flag whether the current chunk is sent
+*/
+static void __uart_tx_next(enum uart_type type, bool sent)
+{
+    struct uart_ctx *ctx = uart_obj[type].ctx;
+    uint32_t primask = __get_PRIMASK();
+
+    __disable_irq();
+
+    /* Chunk is released if it is sent or its sending is aborted without callback */
+    if (ctx->tx_chunk && (sent || uart_obj[type].uart.gState == HAL_UART_STATE_READY)) {
+        spsc_ring_consume(&ctx->tx_ring, ctx->tx_chunk, NULL);
+        ctx->tx_chunk = 0;
+    }
+
+    if (!ctx->tx_chunk) {
+        const void *data[2] = {NULL};
+        uint32_t len[2] = {0};
+
+        if (spsc_ring_peek(&ctx->tx_ring, data, len)) {
+            ctx->tx_chunk = len[0];
+
+            if (HAL_UART_Transmit_DMA(&uart_obj[type].uart, (uint8_t*)data[0], len[0]) != HAL_OK)
+                ctx->tx_chunk = 0;
+        }
+    }
+
+    __set_PRIMASK(primask);
+}
+
+/** Callback by completion of data sending
+ * 
+ * \param[in] huart STM32 HAL UART instance
+*/
+static void __uart_tx_callback(UART_HandleTypeDef *huart)
+{
+    if (!huart)
+        return;
+
+    enum uart_type type = __uart_type_get(huart->Instance);
+
+    if (type != BSP_UART_TYPE_MAX && uart_obj[type].ctx && uart_obj[type].ctx->tx_buff)
+        __uart_tx_next(type, true);
+}
+
+/** Callback by BSP UART error
+ * 
+ * The function is called from \ref __uart_irq_handler when BSP UART error occured  
+ * The function is the wrapper over user callback \ref uart_init_ctx::error_isr_cb  
+ * 
+ * \param[in] type BSP UART type
+ * \param[in] error mask of occured BSP UART errors
+*/
+static void __uart_error_callback(enum uart_type type, uint32_t error)
+{
+    if (!UART_TYPE_VALID(type))
+        return;
+
+    if (type != BSP_UART_TYPE_MAX) {
+        if (uart_obj[type].ctx && uart_obj[type].ctx->init.error_isr_cb)
+            uart_obj[type].ctx->init.error_isr_cb(type, error, uart_obj[type].ctx->init.params);
+    }
+}
+
+/* Mask of data bits of received words, see header file for details */
+uint16_t bsp_uart_data_mask_get(enum uart_type type)
+{
+    if (!UART_TYPE_VALID(type) || !uart_obj[type].ctx)
+        return 0;
+
+    struct uart_init_ctx *params = &uart_obj[type].ctx->init;
+
+    if (params->wordlen == BSP_UART_WORDLEN_9)
+        return (params->parity == BSP_UART_PARITY_NONE) ? 0x1FF : 0xFF;
+    else if (params->wordlen == BSP_UART_WORDLEN_8)
+        return (params->parity == BSP_UART_PARITY_NONE) ? 0xFF : 0x7F;
+
+    return 0x7F;
+}
+
+/* Character time of BSP UART instance, see header file for details */
+uint32_t bsp_uart_char_time_get(enum uart_type type)
+{
+    if (!UART_TYPE_VALID(type) || !uart_obj[type].ctx)
+        return 0;
+
+    return uart_obj[type].ctx->char_time_ns;
+}
+
+/* BSP UART instance start, see header file for details */
+uint8_t bsp_uart_start(enum uart_type type)
+{
+    if (!UART_TYPE_VALID(type))
+        return RES_INVALID_PAR;
+
+    if (uart_obj[type].ctx && uart_obj[type].ctx->rx_buff) {
+        spsc_ring_restart(&uart_obj[type].ctx->rx_ring);
+        spsc_ring_restart(&uart_obj[type].ctx->rx_stamps);
+        uart_obj[type].ctx->rx_stamp_time = bsp_rcc_us_get();
+        uart_obj[type].ctx->frame_error = false;
+
+        if (HAL_UARTEx_ReceiveToIdle_DMA(&uart_obj[type].uart, uart_obj[type].ctx->rx_buff, uart_obj[type].ctx->init.rx_size) != HAL_OK)
+            return RES_NOK;
+
+        if (uart_obj[type].ctx->init.lin_enabled)
+            __HAL_UART_ENABLE_IT(&uart_obj[type].uart, UART_IT_LBD);
+    }
+
+    return RES_OK;
+}
+
+/* BSP UART instance stop, see header file for details */
+uint8_t bsp_uart_stop(enum uart_type type)
+{
+    if (!UART_TYPE_VALID(type) || !uart_obj[type].ctx)
+        return RES_INVALID_PAR;
+
+    HAL_StatusTypeDef hal_res = HAL_UART_DMAStop(&uart_obj[type].uart);
+
+    return (hal_res == HAL_OK) ? RES_OK : RES_NOK;
+}
+
+/* Flag whether BSP UART instance is started, see header file for details */
+bool bsp_uart_is_started(enum uart_type type)
+{
+    if (!UART_TYPE_VALID(type) || !uart_obj[type].ctx || !uart_obj[type].ctx->rx_buff)
+        return false;
+
+    bool status = (READ_BIT(uart_obj[type].uart.Instance->CR3, USART_CR3_DMAR) != 0) ||
+                  (READ_BIT(uart_obj[type].uart.Instance->CR3, USART_CR3_DMAT) != 0);
+
+    return status;
+}
+
+/* Send BSP UART data, see header file for details */
+uint8_t bsp_uart_write(enum uart_type type, void *data, uint16_t len, uint32_t tmt_ms)
+{
+    if (!UART_TYPE_VALID(type) || !uart_obj[type].ctx || !uart_obj[type].ctx->tx_buff)
+        return RES_INVALID_PAR;
+
+    if (!data || !len)
+        return RES_INVALID_PAR;
+
+    if (len > uart_obj[type].ctx->init.tx_size)
+        return RES_INVALID_PAR;
+
+    /* Wait when there is room for data in the ring, DMA TX is not waited for */
+    struct spsc_ring *ring = &uart_obj[type].ctx->tx_ring;
+    uint32_t start_time = HAL_GetTick();
+
+    while (spsc_ring_free(ring) < len && (HAL_GetTick() - start_time) < tmt_ms)
+        __uart_tx_next(type, false);
+
+    /* Data not fitting in the ring is dropped and counted in the ring */
+    uint32_t pushed = spsc_ring_push(ring, data, len);
+
+    __uart_tx_next(type, false);
+
+    return (pushed == len) ? RES_OK : RES_OVERFLOW;
+}
+
+/* Statistics of BSP UART ring buffers, see header file for details */
+uint8_t bsp_uart_stats_get(enum uart_type type, struct uart_stats *stats)
+{
+    if (!UART_TYPE_VALID(type) || !stats || !uart_obj[type].ctx)
+        return RES_INVALID_PAR;
+
+    stats->rx_high_water = uart_obj[type].ctx->rx_ring.high_water;
+    stats->rx_dropped = uart_obj[type].ctx->rx_ring.dropped;
+    stats->tx_high_water = uart_obj[type].ctx->tx_ring.high_water;
+    stats->tx_dropped = uart_obj[type].ctx->tx_ring.dropped;
+
+    return RES_OK;
+}
+
+/* Flag whether received buffer is empty, see header file for details */
+bool bsp_uart_rx_buffer_is_empty(enum uart_type type)
+{
+    if (!UART_TYPE_VALID(type))
+        return true;
+
+    return !uart_obj[type].ctx || !spsc_ring_used(&uart_obj[type].ctx->rx_ring);
+}
+
+/* Change of BSP UART baudrate on the fly, see header file for details */
+uint8_t bsp_uart_baudrate_set(enum uart_type type, uint32_t baudrate)
+{
+    if (!UART_TYPE_VALID(type) || !baudrate)
+        return RES_INVALID_PAR;
+
+    if (!uart_obj[type].ctx)
+        return RES_NOT_INITIALIZED;
+
+    UART_HandleTypeDef *huart = &uart_obj[type].uart;
+
+    /* Oversampling is changed only via full reinitialization */
+    if (HAL_UART_OVERSAMPLING_GET(baudrate) != huart->Init.OverSampling)
+        return RES_NOT_SUPPORTED;
+
+    uint32_t pclk = HAL_RCC_GetPCLK1Freq();
+    uint32_t brr = (huart->Init.OverSampling == UART_OVERSAMPLING_8) ? UART_BRR_SAMPLING8(pclk, baudrate) : 
+                                                                       UART_BRR_SAMPLING16(pclk, baudrate);
+
+    struct uart_ctx *ctx = uart_obj[type].ctx;
+    uint32_t primask = __get_PRIMASK();
+
+    __disable_irq();
+
+    ctx->baudrate_pending = baudrate;
+    ctx->brr_pending = brr;
+
+    /* BRR must not change while a word is received, started reception  
+     * gets the new value on idle line, otherwise receiver is disabled around the write */
+    if (!bsp_uart_is_started(type)) {
+        CLEAR_BIT(huart->Instance->CR1, USART_CR1_RE);
+        __uart_baudrate_apply(type);
+        SET_BIT(huart->Instance->CR1, USART_CR1_RE);
+    }
+
+    __set_PRIMASK(primask);
+
+    return RES_OK;
+}
+
+/* Acquire of BSP UART received data in place, see header file for details */
+uint8_t bsp_uart_read_acquire(enum uart_type type, struct uart_rx_span *span, uint32_t tmt_ms)
+{
+    if (!UART_TYPE_VALID(type) || !span || !uart_obj[type].ctx || !uart_obj[type].ctx->rx_buff)
+        return RES_INVALID_PAR;
+
+    memset(span, 0, sizeof(struct uart_rx_span));
+
+    uint32_t start_time = HAL_GetTick();
+    struct spsc_ring *ring = &uart_obj[type].ctx->rx_ring;
+
+    span->word_size = uart_obj[type].ctx->rx_word_size;
+    span->copy = uart_obj[type].ctx->rx_copy;
+
+    while(true) {
+        uint32_t len[2] = {0};
+
+        /* Data wrapped around the end of the ring buffer is split into two segments */
+        if (spsc_ring_peek(ring, span->data, len)) {
+            span->len[0] = len[0];
+            span->len[1] = len[1];
+            return RES_OK;
+        }
+
+        if ((HAL_GetTick() - start_time) >= tmt_ms)
+            return RES_TIMEOUT;
+    }
+}
+
+/** Get timestamp of chunk of received data
+ * 
+ * \param[in] type BSP UART type
+ * \param[in] idx index of timestamp among unreleased ones
+ * \param[out] stamp timestamp
+ * \return true if timestamp exists false otherwise
+ */
+static bool __uart_rx_stamp_get(enum uart_type type, uint32_t idx, struct uart_rx_stamp *stamp)
+{
+    const void *seg[2] = {NULL};
+    uint32_t len[2] = {0};
+
+    if (idx >= spsc_ring_peek(&uart_obj[type].ctx->rx_stamps, seg, len))
+        return false;
+
+    if (idx < len[0])
+        memcpy(stamp, (const struct uart_rx_stamp*)seg[0] + idx, sizeof(struct uart_rx_stamp));
+    else
+        memcpy(stamp, (const struct uart_rx_stamp*)seg[1] + (idx - len[0]), sizeof(struct uart_rx_stamp));
+
+    return true;
+}
+
+/* Arrival times of BSP UART received data, see header file for details */
+uint8_t bsp_uart_rx_times_get(enum uart_type type, uint32_t *time_us, uint16_t len)
+{
+    if (!UART_TYPE_VALID(type) || !time_us || !uart_obj[type].ctx || !uart_obj[type].ctx->rx_buff)
+        return RES_INVALID_PAR;
+
+    struct uart_ctx *ctx = uart_obj[type].ctx;
+    uint32_t char_ns = bsp_uart_char_time_get(type);
+    uint32_t prev_time = ctx->rx_stamp_time;
+    uint32_t word = ctx->rx_ring.held;
+    uint32_t idx = 0;
+    struct uart_rx_stamp stamp;
+
+    for (uint16_t i = 0; i < len; i++, word++) {
+        /* Chunk of the word is the first one ending after it */
+        bool found = false;
+        while (__uart_rx_stamp_get(type, idx, &stamp)) {
+            if ((int32_t)(stamp.end - word) > 0) {
+                found = true;
+                break;
+            }
+
+            prev_time = stamp.time_us;
+            idx++;
+        }
+
+        /* Timestamp is lost by overflow of timestamps ring, the word has just been received */
+        if (!found) {
+            time_us[i] = bsp_rcc_us_get();
+            continue;
+        }
+
+        /* Words of the chunk go back to back by character time,  
+           the chunk starts not earlier than the previous one ends */
+        uint32_t back_us = (uint32_t)(((uint64_t)(stamp.end - 1 - word) * char_ns) / 1000);
+        uint32_t span_us = stamp.time_us - prev_time;
+
+        time_us[i] = stamp.time_us - MIN(back_us, span_us);
+    }
+
+    return RES_OK;
+}
+
+/** Write position of DMA RX
+ * 
+ * \param[in] type BSP UART type
+ * \return free-running position of the word written next by DMA RX, counted as \ref spsc_ring::head
+ */
+static uint32_t __uart_rx_dma_pos_get(enum uart_type type)
+{
+    struct spsc_ring *ring = &uart_obj[type].ctx->rx_ring;
+    uint32_t head = ring->head;
+
+    if (!uart_obj[type].uart.hdmarx)
+        return head;
+
+    /* Head is loaded before the counter, so DMA RX is not behind it */
+    uint32_t pos = ring->size - __HAL_DMA_GET_COUNTER(uart_obj[type].uart.hdmarx);
+
+    return head + ((pos - head) & (ring->size - 1));
+}
+
+/* Release of BSP UART received data, see header file for details */
+uint8_t bsp_uart_read_release(enum uart_type type, uint16_t len, uint16_t *lost)
+{
+    if (!UART_TYPE_VALID(type) || !uart_obj[type].ctx || !uart_obj[type].ctx->rx_buff)
+        return RES_INVALID_PAR;
+
+    struct spsc_ring *ring = &uart_obj[type].ctx->rx_ring;
+    uint32_t __lost = 0;
+
+    /* Words overwritten by DMA RX since acquire are lost, even if they are not committed yet */
+    spsc_ring_written(ring, __uart_rx_dma_pos_get(type));
+
+    uint8_t res = spsc_ring_consume(ring, len, &__lost);
+
+    if (res != RES_OK)
+        return res;
+
+    if (lost)
+        *lost = (uint16_t)__lost;
+
+    /* Timestamps of released chunks are released as well */
+    struct uart_rx_stamp stamp;
+
+    while (__uart_rx_stamp_get(type, 0, &stamp)) {
+        if ((int32_t)(stamp.end - uart_obj[type].ctx->rx_ring.tail) > 0)
+            break;
+
+        uart_obj[type].ctx->rx_stamp_time = stamp.time_us;
+        spsc_ring_consume(&uart_obj[type].ctx->rx_stamps, 1, NULL);
+    }
+
+    return RES_OK;
+}
+
+/* Receive BSP UART data with arrival times, see header file for details */
+uint8_t bsp_uart_read_stamped(enum uart_type type, void *data, uint32_t *time_us, uint16_t *len, uint32_t tmt_ms)
+{
+    struct uart_rx_span span = {0};
+    uint8_t res = bsp_uart_read_acquire(type, &span, tmt_ms);
+
+    if (res != RES_OK)
+        return res;
+
+    uint16_t __len = span.len[0] + span.len[1];
+
+    if (data) {
+        if (type == BSP_UART_TYPE_CLI) {
+            memcpy(data, span.data[0], span.len[0]);
+
+            if (span.len[1])
+                memcpy((uint8_t*)data + span.len[0], span.data[1], span.len[1]);
+        } else {
+            uart_obj[type].ctx->rx_copy((uint16_t*)data, span.data[0], span.len[0]);
+            uart_obj[type].ctx->rx_copy((uint16_t*)data + span.len[0], span.data[1], span.len[1]);
+        }
+    }
+
+    if (time_us) {
+        res = bsp_uart_rx_times_get(type, time_us, __len);
+        if (res != RES_OK)
+            return res;
+    }
+
+    uint16_t lost = 0;
+    res = bsp_uart_read_release(type, __len, &lost);
+
+    if (res != RES_OK)
+        return res;
+
+    /* Words overwritten by DMA RX while they were copied are discarded, they are the first ones */
+    if (lost) {
+        uint32_t word_size = (type == BSP_UART_TYPE_CLI) ? sizeof(uint8_t) : sizeof(uint16_t);
+
+        if (data)
+            memmove(data, (uint8_t*)data + lost * word_size, (__len - lost) * word_size);
+
+        if (time_us)
+            memmove(time_us, time_us + lost, (__len - lost) * sizeof(uint32_t));
+    }
+
+    if (len)
+        *len = __len - lost;
+
+    return RES_OK;
+}
+
+/* Receive BSP UART data, see header file for details */
+uint8_t bsp_uart_read(enum uart_type type, void *data, uint16_t *len, uint32_t tmt_ms)
+{
+    return bsp_uart_read_stamped(type, data, NULL, len, tmt_ms);
+}
+
+/* Initialization of BSP UART instance, see header file for details */
+uint8_t bsp_uart_init(enum uart_type type, struct uart_init_ctx *init)
+{
+    if (!UART_TYPE_VALID(type) || !init)
+        return RES_INVALID_PAR;
+
+    if (!UART_WORDLEN_VALID(init->wordlen) || !UART_PARITY_VALID(init->parity))
+        return RES_INVALID_PAR;
+
+    if (!UART_STOPBITS_VALID(init->stopbits))
+        return RES_INVALID_PAR;
+
+    if (init->wordlen == BSP_UART_WORDLEN_7 && init->parity != BSP_UART_PARITY_NONE)
+        return RES_INVALID_PAR;
+
+    if (!init->baudrate)
+        return RES_INVALID_PAR;
+
+    if (type == BSP_UART_TYPE_CLI && init->lin_enabled)
+        return RES_NOT_SUPPORTED;
+
+    /* Buffers are used as rings masked by their sizes */
+    if ((init->rx_size && !SPSC_RING_SIZE_VALID(init->rx_size)) || (init->tx_size && !SPSC_RING_SIZE_VALID(init->tx_size)))
+        return RES_INVALID_PAR;
+
+    uint8_t rx_data_size = __uart_rx_word_size_get(type, init);
+
+    uint8_t res = RES_OK;
+    HAL_StatusTypeDef hal_res = HAL_OK;
+
+    /* Buffers should fit in static storage of the instance */
+    if ((init->rx_size * rx_data_size) > uart_obj[type].rx_buff_size || init->tx_size > uart_obj[type].tx_buff_size)
+        return RES_OVERFLOW;
+
+    do {
+        if (!uart_obj[type].ctx) {
+            uart_obj[type].ctx = uart_obj[type].ram_ctx;
+            memset(uart_obj[type].ctx, 0, sizeof(struct uart_ctx));
+        } else {
+            res = bsp_uart_stop(type);
+
+            if (res != RES_OK)
+                return res;
+        }
+
+        uint32_t rx_size = init->rx_size;
+        uint32_t tx_size = init->tx_size;
+
+        uart_obj[type].ctx->rx_buff = rx_size ? uart_obj[type].rx_buff : NULL;
+        uart_obj[type].ctx->tx_buff = tx_size ? uart_obj[type].tx_buff : NULL;
+
+        if (uart_obj[type].ctx->rx_buff)
+            spsc_ring_init(&uart_obj[type].ctx->rx_ring, uart_obj[type].ctx->rx_buff, rx_size, rx_data_size);
+
+        spsc_ring_init(&uart_obj[type].ctx->rx_stamps, uart_obj[type].rx_stamps, UART_RX_STAMPS_SIZE, sizeof(struct uart_rx_stamp));
+
+        if (uart_obj[type].ctx->tx_buff)
+            spsc_ring_init(&uart_obj[type].ctx->tx_ring, uart_obj[type].ctx->tx_buff, tx_size, sizeof(uint8_t));
+
+        uart_obj[type].ctx->tx_chunk = 0;
+
+        bool rx_word_changed = (uart_obj[type].ctx->rx_word_size != rx_data_size);
+
+        uart_obj[type].ctx->init = *init;
+        uart_obj[type].ctx->char_time_ns = __uart_char_time_calc(init);
+        uart_obj[type].ctx->brr_pending = 0;
+        uart_obj[type].ctx->rx_word_size = rx_data_size;
+
+        if (rx_data_size == sizeof(uint16_t))
+            uart_obj[type].ctx->rx_copy = __uart_rx_copy_9bit;
+        else if (init->wordlen == BSP_UART_WORDLEN_7 || (init->wordlen == BSP_UART_WORDLEN_8 && init->parity != BSP_UART_PARITY_NONE))
+            uart_obj[type].ctx->rx_copy = __uart_rx_copy_7bit;
+        else
+            uart_obj[type].ctx->rx_copy = __uart_rx_copy_8bit;
+
+        if (uart_obj[type].uart.gState == HAL_UART_STATE_RESET) {
+            res = __uart_msp_init(type);
+
+            if (res != RES_OK)
+                break;
+        } else if (rx_word_changed && uart_obj[type].uart.hdmarx) {
+            /* Data alignment of stopped DMA RX is changed according to new word size */
+            DMA_HandleTypeDef *hdma_rx = uart_obj[type].uart.hdmarx;
+
+            hdma_rx->Init.PeriphDataAlignment   = (rx_data_size == sizeof(uint16_t)) ? DMA_PDATAALIGN_HALFWORD : DMA_PDATAALIGN_BYTE;
+            hdma_rx->Init.MemDataAlignment      = (rx_data_size == sizeof(uint16_t)) ? DMA_MDATAALIGN_HALFWORD : DMA_MDATAALIGN_BYTE;
+
+            if (HAL_DMA_Init(hdma_rx) != HAL_OK) {
+                res = RES_NOK;
+                break;
+            }
+        }
+
+        uart_obj[type].uart.Init.BaudRate       = uart_obj[type].ctx->init.baudrate;
+        uart_obj[type].uart.Init.WordLength     = HAL_UART_WORDLEN_TO(uart_obj[type].ctx->init.wordlen);
+        uart_obj[type].uart.Init.StopBits       = HAL_UART_STOPBITS_TO(uart_obj[type].ctx->init.stopbits);
+
+        /* 7 bits word is received as 8 bits one, so its first stop bit is MSB */
+        if (uart_obj[type].ctx->init.wordlen == BSP_UART_WORDLEN_7)
+            uart_obj[type].uart.Init.StopBits   = UART_STOPBITS_1;
+        uart_obj[type].uart.Init.Parity         = HAL_UART_PARITY_TO(uart_obj[type].ctx->init.parity);
+        uart_obj[type].uart.Init.HwFlowCtl      = UART_HWCONTROL_NONE;
+        uart_obj[type].uart.Init.Mode           = (type == BSP_UART_TYPE_CLI) ? UART_MODE_TX_RX : UART_MODE_RX;
+        uart_obj[type].uart.Init.OverSampling   = HAL_UART_OVERSAMPLING_GET(uart_obj[type].ctx->init.baudrate);
+
+        if (!uart_obj[type].ctx->init.lin_enabled)
+            hal_res = HAL_UART_Init(&uart_obj[type].uart);
+        else
+            hal_res = HAL_LIN_Init(&uart_obj[type].uart, UART_LINBREAKDETECTLENGTH_11B);
+
+        if (hal_res != HAL_OK) {
+            res = RES_NOK;
+            break;
+        }
+
+        hal_res = HAL_UART_RegisterRxEventCallback(&uart_obj[type].uart, __uart_rx_callback);
+
+        if (hal_res == HAL_OK && uart_obj[type].ctx->tx_buff)
+            hal_res = HAL_UART_RegisterCallback(&uart_obj[type].uart, HAL_UART_TX_COMPLETE_CB_ID, __uart_tx_callback);
+
+        if (hal_res != HAL_OK) {
+            res = RES_NOK;
+            break;
+        }
+
+        res = bsp_uart_start(type);
+
+        if (res != RES_OK)
+            break;
+
+    } while(0);
+
+    if (res != RES_OK) {
+        bsp_uart_deinit(type);
+    }
+
+    return res;
+}
+
+/* Deinitialization of BSP UART instance, see header file for details */
+uint8_t bsp_uart_deinit(enum uart_type type)
+{
+    if (!UART_TYPE_VALID(type))
+        return RES_INVALID_PAR;
+
+    uint8_t res = RES_OK;
+    HAL_StatusTypeDef hal_res = HAL_OK;
+
+    if (uart_obj[type].ctx) {
+        hal_res = HAL_UART_DMAStop(&uart_obj[type].uart);
+
+        if (hal_res != HAL_OK)
+            return RES_NOK;
+
+        hal_res = HAL_UART_DeInit(&uart_obj[type].uart);
+
+        if (hal_res != HAL_OK)
+            return RES_NOK;
+
+        res = __uart_msp_deinit(type);
+
+        if (res != RES_OK)
+            return res;
+
+        uart_obj[type].ctx = NULL;
+    }
+
+    return res;
+}
+
+/** UART IRQ handler
+ * 
+ * The function is called from NVIC UART interrupts, processes receiption,  
+ * errors and LIN break detection
+ * 
+ * \param[in] type BSP UART type
+ */
+static void __uart_irq_handler(enum uart_type type)
+{
+    if (!UART_TYPE_VALID(type) || !uart_obj[type].ctx)
+        return;
+
+    uint32_t error = 0;
+    USART_TypeDef *instance = uart_obj[type].uart.Instance;
+
+    /* Workaround if UART error occurred before DMA receiver is enabled (see UART_Start_Receive_DMA) */
+    if (!HAL_IS_BIT_SET(instance->CR3, USART_CR3_DMAR)) {
+        // ORE flag is proccesed separately in HAL_UART_IRQHandler
+        if (!(instance->SR & USART_SR_ORE)) {
+            if (instance->SR & (USART_SR_PE | USART_SR_FE | USART_SR_NE)) {
+                // Clear mentioned errors
+                __HAL_UART_CLEAR_PEFLAG(&uart_obj[type].uart);
+                return;
+            }
+        }
+    }
+
+    /* Process LIN break detection if enabled */
+    if (LL_USART_IsEnabledLIN(instance) && LL_USART_IsEnabledIT_LBD(instance)) {
+        if (LL_USART_IsActiveFlag_LBD(instance)) {
+            uart_obj[type].ctx->frame_error = false;
+            LL_USART_ClearFlag_LBD(instance);
+
+            if (uart_obj[type].ctx->init.lin_break_isr_cb)
+                uart_obj[type].ctx->init.lin_break_isr_cb(type, uart_obj[type].ctx->init.params);
+        }
+
+        /* If after occured frame error LIN break is not detected 
+           generates frame error */
+        if (uart_obj[type].ctx->frame_error) {
+            error = BSP_UART_ERROR_FE;
+            uart_obj[type].ctx->frame_error = false;
+        } else {
+            if (LL_USART_IsActiveFlag_FE(instance)) {
+                if (LL_USART_IsActiveFlag_RXNE(instance)) {
+                    return;
+                } else {
+                    uart_obj[type].ctx->frame_error = true;
+                    LL_USART_ClearFlag_FE(instance);
+                }
+            }
+        }
+    }
+
+    HAL_UART_IRQHandler(&uart_obj[type].uart);
+
+    if ((uart_obj[type].uart.ErrorCode & BSP_UART_ERRORS_ALL) | error)
+        __uart_error_callback(type, (uart_obj[type].uart.ErrorCode & BSP_UART_ERRORS_ALL) | error);
+}
+
+/** NVIC UART4 IRQ handler */
+void UART4_IRQHandler(void)
+{
+    __uart_irq_handler(BSP_UART_TYPE_CLI);
+}
+
+/** NVIC USART2 IRQ handler */
+void USART2_IRQHandler(void)
+{
+    __uart_irq_handler(BSP_UART_TYPE_RS232_TX);
+}
+
+/** NVIC USART3 IRQ handler */
+void USART3_IRQHandler(void)
+{
+    __uart_irq_handler(BSP_UART_TYPE_RS232_RX);
+}
+
+/** NVIC DMA1 (Stream 1) IRQ handler */
+void DMA1_Stream1_IRQHandler(void)
+{
+    HAL_DMA_IRQHandler(uart_obj[BSP_UART_TYPE_RS232_RX].uart.hdmarx);
+}
+
+/** NVIC DMA1 (Stream 2) IRQ handler */
+void DMA1_Stream2_IRQHandler(void)
+{
+    HAL_DMA_IRQHandler(uart_obj[BSP_UART_TYPE_CLI].uart.hdmarx);
+}
+
+/** NVIC DMA1 (Stream 4) IRQ handler */
+void DMA1_Stream4_IRQHandler(void)
+{
+    HAL_DMA_IRQHandler(uart_obj[BSP_UART_TYPE_CLI].uart.hdmatx);
+}
+
+/** NVIC DMA1 (Stream 5) IRQ handler */
+void DMA1_Stream5_IRQHandler(void)
+{
+    HAL_DMA_IRQHandler(uart_obj[BSP_UART_TYPE_RS232_TX].uart.hdmarx);
+}
+
 /** @} */
\ No newline at end of file
@@ -0,0 +1,399 @@
+/**
+\file
+\author JavaLandau
+\copyright MIT License
+\brief Lock-free ring buffer
+
+The file includes lock-free ring buffer with single producer & single consumer
+*/
+
+/**
+ * \defgroup spsc_ring SPSC ring
+ * \brief Lock-free ring buffer with single producer & single consumer
+ * \ingroup common_lib
+ *
+ * Producer and consumer may run in different contexts (thread & interrupt, DMA & thread)
+ * without critical sections: \ref spsc_ring::head is written only by producer,
+ * \ref spsc_ring::tail is advanced by consumer over read elements and by compare-and-swap
+ * over lost ones, so each element is either consumed or counted in \ref spsc_ring::dropped
+ * exactly once. Indexes are free-running and masked by power-of-two size, so full and empty
+ * rings are distinguished without spare element. Producer may be restarted by \ref spsc_ring_restart
+ * while consumer holds peeked elements, \ref spsc_ring_consume reports them as lost
+ * @{
+ */
+
+#ifndef __SPSC_RING_H__
+#define __SPSC_RING_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include "common.h"
+
+/** MACRO Memory barrier of the ring
+ *
+ * Orders accesses to elements and indexes of the ring, DMA is an observer as well
+ * \note Can be redefined before inclusion of the header, e.g. for tests on host
+*/
+#ifndef SPSC_RING_BARRIER
+#define SPSC_RING_BARRIER()     __DMB()
+#endif
+
+#ifndef SPSC_RING_CAS
+/** Compare-and-swap of index of the ring by exclusive access
+ *
+ * \param[in,out] ptr index
+ * \param[in] old expected value of the index
+ * \param[in] value new value of the index
+ * \return true if the index is swapped false otherwise
+ */
+static inline bool __spsc_ring_cas(volatile uint32_t *ptr, uint32_t old, uint32_t value)
+{
+    do {
+        if (__LDREXW(ptr) != old) {
+            __CLREX();
+            return false;
+        }
+    } while (__STREXW(value, ptr));
+
+    return true;
+}
+
+/** MACRO Compare-and-swap of index of the ring
+ *
+ * \note Can be redefined before inclusion of the header, e.g. for tests on host
+ *
+ * \param[in,out] PTR pointer to index
+ * \param[in] OLD expected value of the index
+ * \param[in] NEW new value of the index
+ * \return true if the index is swapped false otherwise
+*/
+#define SPSC_RING_CAS(PTR, OLD, NEW)    __spsc_ring_cas(PTR, OLD, NEW)
+#endif
+
+/** MACRO Check ring size
+ *
+ * The macro checks whether \p X is valid size of the ring: non-zero power of two
+ *
+ * \param[in] X count of elements
+ * \return true if size is valid false otherwise
+*/
+#define SPSC_RING_SIZE_VALID(X) ((X) && !((X) & ((X) - 1)))
+
+/// Ring buffer with single producer & single consumer
+struct spsc_ring {
+    uint8_t             *buff;          ///< Storage of elements
+    uint32_t            size;           ///< Count of elements in \ref buff, power of two
+    uint32_t            elem_size;      ///< Size of element in bytes
+    volatile uint32_t   head;           ///< Count of produced elements, written by producer only
+    volatile uint32_t   tail;           ///< Count of consumed or lost elements, advanced by compare-and-swap over lost ones
+    volatile uint32_t   held;           ///< Value of \ref tail at the last peek, written by consumer only
+    volatile uint32_t   dropped;        ///< Count of lost elements, increased by compare-and-swap
+    volatile uint32_t   high_water;     ///< Maximum count of elements in the ring, written by producer only
+};
+
+/** Initialization of the ring
+ *
+ * \param[out] ring the ring
+ * \param[in] buff storage of \p size elements
+ * \param[in] size count of elements, power of two
+ * \param[in] elem_size size of element in bytes
+ * \return \ref RES_OK on success error otherwise
+ */
+static inline uint8_t spsc_ring_init(struct spsc_ring *ring, void *buff, uint32_t size, uint32_t elem_size)
+{
+    if (!ring || !buff || !elem_size || !SPSC_RING_SIZE_VALID(size))
+        return RES_INVALID_PAR;
+
+    memset(ring, 0, sizeof(struct spsc_ring));
+    ring->buff = (uint8_t*)buff;
+    ring->size = size;
+    ring->elem_size = elem_size;
+
+    return RES_OK;
+}
+
+/** Increase of count of lost elements
+ *
+ * \param[in,out] ring the ring
+ * \param[in] cnt count of lost elements
+ */
+static inline void __spsc_ring_dropped_add(struct spsc_ring *ring, uint32_t cnt)
+{
+    uint32_t dropped;
+
+    do {
+        dropped = ring->dropped;
+    } while (cnt && !SPSC_RING_CAS(&ring->dropped, dropped, dropped + cnt));
+}
+
+/** Claim of unread elements as lost
+ *
+ * The function advances \ref spsc_ring::tail up to \p pos, unread elements  
+ * up to \ref spsc_ring::head are counted in \ref spsc_ring::dropped
+ *
+ * \param[in,out] ring the ring
+ * \param[in] pos position of the first element which is not lost
+ * \return count of lost elements
+ */
+static inline uint32_t __spsc_ring_claim(struct spsc_ring *ring, uint32_t pos)
+{
+    while (true) {
+        uint32_t tail = ring->tail;
+
+        if ((int32_t)(pos - tail) <= 0)
+            return 0;
+
+        uint32_t head = ring->head;
+        uint32_t end = ((int32_t)(pos - head) > 0) ? head : pos;
+
+        if (SPSC_RING_CAS(&ring->tail, tail, pos)) {
+            uint32_t lost = ((int32_t)(end - tail) > 0) ? (end - tail) : 0;
+
+            __spsc_ring_dropped_add(ring, lost);
+            return lost;
+        }
+    }
+}
+
+/** Restart of the ring by producer
+ *
+ * Unread elements are counted as lost, the next element is written at the beginning  
+ * of \ref spsc_ring::buff, so write-through producer restarted from the beginning  
+ * of its buffer stays in sync with \ref spsc_ring::head. Consumer may hold peeked elements,  
+ * \ref spsc_ring_consume reports them as lost. \ref spsc_ring::dropped & \ref spsc_ring::high_water  
+ * are kept until \ref spsc_ring_init
+ * \note Producer should be stopped, the function is called from its context
+ *
+ * \param[in,out] ring the ring
+ */
+static inline void spsc_ring_restart(struct spsc_ring *ring)
+{
+    uint32_t head = (ring->head + ring->size - 1) & ~(ring->size - 1);
+
+    /* Elements are claimed before the new head is published, so consumer never reads the gap */
+    __spsc_ring_claim(ring, head);
+    SPSC_RING_BARRIER();
+    ring->head = head;
+}
+
+/** Count of elements in the ring
+ *
+ * \note It may exceed size of the ring for write-through producer, see \ref spsc_ring_produced
+ *
+ * \param[in] ring the ring
+ * \return count of elements
+ */
+static inline uint32_t spsc_ring_used(const struct spsc_ring *ring)
+{
+    uint32_t head = ring->head;
+
+    /* Head is loaded before tail claimed by restart of producer, see \ref spsc_ring_restart */
+    SPSC_RING_BARRIER();
+
+    uint32_t tail = ring->tail;
+
+    return ((int32_t)(head - tail) > 0) ? (head - tail) : 0;
+}
+
+/** Count of free elements in the ring
+ *
+ * \param[in] ring the ring
+ * \return count of free elements
+ */
+static inline uint32_t spsc_ring_free(const struct spsc_ring *ring)
+{
+    uint32_t used = spsc_ring_used(ring);
+
+    return (used < ring->size) ? (ring->size - used) : 0;
+}
+
+/** Update of high-water mark by producer
+ *
+ * \param[in,out] ring the ring
+ * \param[in] used count of elements in the ring
+ */
+static inline void __spsc_ring_high_water_update(struct spsc_ring *ring, uint32_t used)
+{
+    used = MIN(used, ring->size);
+
+    if (used > ring->high_water)
+        ring->high_water = used;
+}
+
+/** Push of elements into the ring by producer
+ *
+ * Elements which do not fit in the ring are counted in \ref spsc_ring::dropped
+ *
+ * \param[in,out] ring the ring
+ * \param[in] data pushed elements
+ * \param[in] cnt count of \p data elements
+ * \return count of pushed elements
+ */
+static inline uint32_t spsc_ring_push(struct spsc_ring *ring, const void *data, uint32_t cnt)
+{
+    uint32_t head = ring->head;
+    uint32_t used = head - ring->tail;
+    uint32_t pushed = MIN(cnt, (used < ring->size) ? (ring->size - used) : 0);
+    uint32_t pos = head & (ring->size - 1);
+    uint32_t first = MIN(pushed, ring->size - pos);
+
+    /* Tail is loaded before elements are written, so elements still read by consumer are not overwritten */
+    SPSC_RING_BARRIER();
+
+    memcpy(ring->buff + pos * ring->elem_size, data, first * ring->elem_size);
+    memcpy(ring->buff, (const uint8_t*)data + first * ring->elem_size, (pushed - first) * ring->elem_size);
+
+    /* Elements are written before they are published */
+    SPSC_RING_BARRIER();
+
+    ring->head = head + pushed;
+    __spsc_ring_dropped_add(ring, cnt - pushed);
+    __spsc_ring_high_water_update(ring, used + pushed);
+
+    return pushed;
+}
+
+/** Commit of elements written into the ring in place by producer
+ *
+ * Used by write-through producer (e.g. circular DMA) which writes elements
+ * into \ref spsc_ring::buff on its own regardless of free space, so unread elements
+ * overwritten by producer are claimed as lost before the new elements are published
+ *
+ * \param[in,out] ring the ring
+ * \param[in] cnt count of written elements
+ * \return count of unread elements overwritten by \p cnt elements
+ */
+static inline uint32_t spsc_ring_produced(struct spsc_ring *ring, uint32_t cnt)
+{
+    uint32_t head = ring->head;
+    uint32_t lost = __spsc_ring_claim(ring, head + cnt - ring->size);
+
+    SPSC_RING_BARRIER();
+
+    ring->head = head + cnt;
+    __spsc_ring_high_water_update(ring, head + cnt - ring->tail);
+
+    return lost;
+}
+
+/** Notice of elements written in place by write-through producer but not committed yet
+ *
+ * Write-through producer overwrites unread elements before \ref spsc_ring_produced,  
+ * so consumer claims them as lost by the current write position of producer  
+ * after reading of peeked elements and before \ref spsc_ring_consume
+ *
+ * \param[in,out] ring the ring
+ * \param[in] pos free-running write position of producer, not less than \ref spsc_ring::head
+ * \return count of unread elements overwritten by producer
+ */
+static inline uint32_t spsc_ring_written(struct spsc_ring *ring, uint32_t pos)
+{
+    return __spsc_ring_claim(ring, pos - ring->size);
+}
+
+/** Peek of elements in place of the ring by consumer
+ *
+ * Elements wrapped around the end of \ref spsc_ring::buff are returned as the second segment
+ *
+ * \param[in,out] ring the ring
+ * \param[out] data segments of elements, the second one is NULL if unused
+ * \param[out] len count of elements in the segments
+ * \return count of elements in both segments
+ */
+static inline uint32_t spsc_ring_peek(struct spsc_ring *ring, const void *data[2], uint32_t len[2])
+{
+    uint32_t head = ring->head;
+
+    /* Head is loaded before tail claimed by producer, see \ref spsc_ring_produced */
+    SPSC_RING_BARRIER();
+
+    uint32_t tail = ring->tail;
+    uint32_t used = ((int32_t)(head - tail) > 0) ? (head - tail) : 0;
+
+    ring->held = tail;
+
+    /* Head is loaded before elements are read */
+    SPSC_RING_BARRIER();
+
+    uint32_t pos = tail & (ring->size - 1);
+
+    len[0] = MIN(used, ring->size - pos);
+    len[1] = used - len[0];
+    data[0] = ring->buff + pos * ring->elem_size;
+    data[1] = len[1] ? ring->buff : NULL;
+
+    return used;
+}
+
+/** Consuming of elements peeked by consumer
+ *
+ * Peeked elements claimed as lost by producer (or by \ref spsc_ring_written) since the peek  
+ * are counted in \ref spsc_ring::dropped and reported by \p lost, they are the first ones  
+ * of the peeked elements and their data read by consumer is invalid
+ *
+ * \param[in,out] ring the ring
+ * \param[in] cnt count of consumed elements from the beginning of peeked ones
+ * \param[out] lost count of the first \p cnt elements which are lost, may be NULL
+ * \return \ref RES_OK on success error otherwise
+ */
+static inline uint8_t spsc_ring_consume(struct spsc_ring *ring, uint32_t cnt, uint32_t *lost)
+{
+    uint32_t held = ring->held;
+
+    if (cnt > (ring->head - held))
+        return RES_INVALID_PAR;
+
+    /* Elements are read before they are freed for producer */
+    SPSC_RING_BARRIER();
+
+    while (true) {
+        uint32_t tail = ring->tail;
+        uint32_t claimed = ((int32_t)(tail - held) > 0) ? (tail - held) : 0;
+
+        if (claimed >= cnt || SPSC_RING_CAS(&ring->tail, tail, held + cnt)) {
+            if (lost)
+                *lost = MIN(claimed, cnt);
+
+            break;
+        }
+    }
+
+    ring->held = held + cnt;
+
+    return RES_OK;
+}
+
+/** Pop of elements from the ring by consumer
+ *
+ * \param[in,out] ring the ring
+ * \param[out] data popped elements
+ * \param[in] cnt maximum count of \p data elements
+ * \return count of popped elements
+ */
+static inline uint32_t spsc_ring_pop(struct spsc_ring *ring, void *data, uint32_t cnt)
+{
+    const void *seg[2] = {NULL};
+    uint32_t len[2] = {0};
+
+    spsc_ring_peek(ring, seg, len);
+
+    len[0] = MIN(len[0], cnt);
+    len[1] = MIN(len[1], cnt - len[0]);
+
+    memcpy(data, seg[0], len[0] * ring->elem_size);
+    memcpy((uint8_t*)data + len[0] * ring->elem_size, seg[1] ? seg[1] : ring->buff, len[1] * ring->elem_size);
+
+    uint32_t lost = 0;
+    spsc_ring_consume(ring, len[0] + len[1], &lost);
+
+    /* Lost elements are the first ones */
+    if (lost)
+        memmove(data, (uint8_t*)data + lost * ring->elem_size, (len[0] + len[1] - lost) * ring->elem_size);
+
+    return len[0] + len[1] - lost;
+}
+
+/** @} */
+
+#endif //__SPSC_RING_H__
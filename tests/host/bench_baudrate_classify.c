@@ -0,0 +1,143 @@
+/**
+\file
+\author JavaLandau
+\copyright MIT License
+\brief Benchmark of classification of pulses by baudrate
+
+The benchmark measures cycles per classified pulse: float classification of the initial firmware  
+(division & multiplications per candidate baudrate) against integer search over tick windows  
+precomputed by \ref sniffer_rs232_init, both at the default tolerance and timer clock
+*/
+
+#include "sniffer_rs232.c"
+#include "host_test.h"
+#include <stdlib.h>
+
+/// Count of classified pulses per run
+#define PULSES_CNT      (1 << 16)
+
+/// Count of runs
+#define RUNS_CNT        (50)
+
+/// Widths of pulses in ticks
+static uint32_t pulses[PULSES_CNT];
+
+/** Float classification of width of a bit of the initial firmware
+ * 
+ * \param[in] len_bit width of a bit in ticks of the timer at 1 MHz * tolerance
+ * \return baudrate value in bods on success, 0 otherwise
+ */
+static uint32_t float_baudrate_get(uint32_t len_bit)
+{
+    const float tolerance = (float)config.baudrate_tolerance / 100.0f;
+
+    if (!len_bit)
+        return 0;
+
+    float calc_baud = (float)(1000000 * config.baudrate_tolerance) / (float)len_bit;
+
+    uint32_t i = 0;
+    for (; i < ARRAY_SIZE(baudrates_list); i++) {
+        float baud = (float)baudrates_list[i];
+
+        if ((calc_baud >= (1 - tolerance) * baud) && ((calc_baud <= (1 + tolerance) * baud)))
+            break;
+    }
+
+    return (i != ARRAY_SIZE(baudrates_list)) ? baudrates_list[i] : 0;
+}
+
+/** Integer classification of width of a bit over precomputed tick windows
+ * 
+ * \param[in] len_bit width of a bit in ticks
+ * \return baudrate value in bods on success, 0 otherwise
+ */
+static uint32_t window_baudrate_get(uint32_t len_bit)
+{
+    return __sniffer_rs232_baudrate_get(len_bit, 1);
+}
+
+/** Nearest window by linear scan over all windows, reference of the binary search
+ * 
+ * \param[in] len width of a bit in 1/(2^\ref LEN_FRAC_BITS) of ticks
+ * \return window of the nearest baudrate
+ */
+static const struct baud_window *linear_window_nearest_get(uint32_t len)
+{
+    const struct baud_window *nearest = NULL;
+    uint32_t min_diff = UINT32_MAX;
+
+    for (uint32_t i = 0; i < baud_windows_cnt; i++) {
+        uint32_t diff = (len > baud_windows[i].len_nom) ? (len - baud_windows[i].len_nom) : (baud_windows[i].len_nom - len);
+
+        if (diff < min_diff) {
+            min_diff = diff;
+            nearest = &baud_windows[i];
+        }
+    }
+
+    return nearest;
+}
+
+/** Measurement of classification
+ * 
+ * \param[in] name name of classification
+ * \param[in] classify classification routine
+ * \return cycles per classified pulse
+ */
+static double bench(const char *name, uint32_t (*classify)(uint32_t))
+{
+    volatile uint32_t sink = 0;
+    uint32_t classified = 0;
+
+    for (uint32_t i = 0; i < PULSES_CNT; i++)
+        classified += classify(pulses[i]) ? 1 : 0;
+
+    uint64_t start = host_cycles();
+
+    for (uint32_t run = 0; run < RUNS_CNT; run++) {
+        for (uint32_t i = 0; i < PULSES_CNT; i++)
+            sink += classify(pulses[i]);
+    }
+
+    double cycles = (double)(host_cycles() - start) / ((double)RUNS_CNT * PULSES_CNT);
+    printf("%-8s: %6.1f cycles per pulse, %u/%u pulses classified\n", name, cycles, classified, PULSES_CNT);
+
+    (void)sink;
+    return cycles;
+}
+
+int main(void)
+{
+    struct sniffer_rs232_config sniffer_config = SNIFFER_RS232_CONFIG_DEFAULT();
+    HOST_CHECK(sniffer_rs232_init(&sniffer_config) == RES_OK);
+    HOST_CHECK(alg_tim_freq == 1000000 * config.baudrate_tolerance);
+
+    /* Widths of 1..3 bits of known baudrates spread over twice the tolerance */
+    srand(1);
+    for (uint32_t i = 0; i < PULSES_CNT; i++) {
+        uint32_t baudrate = baudrates_list[rand() % ARRAY_SIZE(baudrates_list)];
+        double spread = 1.0 + (double)((rand() % 401) - 200) * config.baudrate_tolerance / 10000.0;
+
+        pulses[i] = (uint32_t)((double)alg_tim_freq / baudrate * spread) * (1 + rand() % 3);
+    }
+
+    /* Both classifications agree on single bits well inside the tolerance */
+    for (uint32_t i = 0; i < ARRAY_SIZE(baudrates_list); i++) {
+        uint32_t len_bit = (alg_tim_freq + baudrates_list[i] / 2) / baudrates_list[i];
+        HOST_CHECK(window_baudrate_get(len_bit) == baudrates_list[i]);
+        HOST_CHECK(float_baudrate_get(len_bit) == baudrates_list[i]);
+    }
+
+    /* Binary search finds the same window as linear scan */
+    for (uint32_t i = 0; i < PULSES_CNT; i++) {
+        uint32_t len = pulses[i] << LEN_FRAC_BITS;
+        HOST_CHECK(__sniffer_rs232_baud_window_nearest_get(len) == linear_window_nearest_get(len));
+    }
+
+    double float_cycles = bench("float", float_baudrate_get);
+    double window_cycles = bench("windows", window_baudrate_get);
+    printf("speedup : %.1fx\n", float_cycles / window_cycles);
+
+    return HOST_TEST_RESULT();
+}
@@ -0,0 +1,165 @@
+/**
+\file
+\author JavaLandau
+\copyright MIT License
+\brief Benchmark of reception of RS-232 lines by BSP UART
+
+The benchmark measures for each UART format of RS-232 lines:
+- bytes of receive buffer masked per cycle: per-word selection of word size & runtime mask
+  of the initial monitoring loop against copying routine of the span specialised for the format
+- maximum burst before overflow of receive buffer of the static storage of the line,
+  DMA is simulated by writing into receive buffer & callback by data reception
+*/
+
+#include "bsp_uart.c"
+#include "host_test.h"
+
+/// Count of words committed by simulated DMA at once, half of receive buffer as by half transfer event
+#define CHUNK_DIV       (2)
+
+/// Count of runs of masking
+#define RUNS_CNT        (20000)
+
+/// Baudrate used for duration of maximum burst
+#define BURST_BAUDRATE  (115200)
+
+/// UART format of the benchmark
+struct bench_format {
+    const char *name;           ///< Name of the format
+    enum uart_wordlen wordlen;  ///< Word length
+    enum uart_parity parity;    ///< Parity type
+};
+
+/// Words masked by data bits
+static uint16_t words[BSP_UART_RS232_RX_SIZE * sizeof(uint16_t)];
+
+/// Count of overflows of receive buffer
+static uint32_t overflow_cnt = 0;
+
+/** Callback for overflow of receive buffer
+ *
+ * \param[in] type BSP UART type
+ * \param[in] params unused
+ */
+static void overflow_cb(enum uart_type type, void *params)
+{
+    overflow_cnt++;
+}
+
+/** Simulated DMA reception of words
+ *
+ * \param[in] type BSP UART type
+ * \param[in] cnt count of received words
+ */
+static void dma_receive(enum uart_type type, uint32_t cnt)
+{
+    struct spsc_ring *ring = &uart_obj[type].ctx->rx_ring;
+    uint32_t pos = ((ring->head + cnt - 1) & (ring->size - 1)) + 1;
+
+    for (uint32_t i = 0; i < cnt; i++) {
+        uint32_t idx = (ring->head + i) & (ring->size - 1);
+
+        if (ring->elem_size == sizeof(uint16_t))
+            ((uint16_t*)ring->buff)[idx] = (uint16_t)(0x1A5 + i);
+        else
+            ring->buff[idx] = (uint8_t)(0xA5 + i);
+    }
+
+    /* Counter of circular DMA is reloaded at the end of the buffer */
+    uart_obj[type].uart.hdmarx->Instance->NDTR = ring->size - (pos & (ring->size - 1));
+    uart_obj[type].uart.RxEventType = (pos == ring->size || pos == ring->size / 2) ? HAL_UART_RXEVENT_HT : HAL_UART_RXEVENT_IDLE;
+    __uart_rx_callback(&uart_obj[type].uart, (uint16_t)pos);
+}
+
+/** Masking of received words of the initial monitoring loop
+ *
+ * \param[out] dst masked words
+ * \param[in] src received words
+ * \param[in] word_size size of word of \p src in bytes
+ * \param[in] len count of words
+ * \param[in] data_mask mask of data bits
+ */
+static void mask_runtime(uint16_t *dst, const void *src, uint8_t word_size, uint16_t len, uint16_t data_mask)
+{
+    for (uint16_t i = 0; i < len; i++)
+        dst[i] = data_mask & ((word_size == sizeof(uint8_t)) ? ((const uint8_t*)src)[i] : ((const uint16_t*)src)[i]);
+}
+
+int main(void)
+{
+    const struct bench_format formats[] = {
+        {"8N1", BSP_UART_WORDLEN_8, BSP_UART_PARITY_NONE},
+        {"7E1", BSP_UART_WORDLEN_8, BSP_UART_PARITY_EVEN},
+        {"7N1", BSP_UART_WORDLEN_7, BSP_UART_PARITY_NONE},
+        {"8E1", BSP_UART_WORDLEN_9, BSP_UART_PARITY_EVEN},
+        {"9N1", BSP_UART_WORDLEN_9, BSP_UART_PARITY_NONE},
+    };
+
+    const enum uart_type type = BSP_UART_TYPE_RS232_TX;
+
+    for (uint32_t f = 0; f < ARRAY_SIZE(formats); f++) {
+        struct uart_init_ctx init = {.baudrate = BURST_BAUDRATE, .wordlen = formats[f].wordlen, .parity = formats[f].parity,
+                                     .stopbits = BSP_UART_STOPBITS_1, .overflow_isr_cb = overflow_cb};
+
+        /* The largest receive buffer fitting in static storage of the line */
+        uint8_t word_size = __uart_rx_word_size_get(type, &init);
+        init.rx_size = sizeof(uart_ram_rs232_tx.rx_buff) / word_size;
+
+        HOST_CHECK(bsp_uart_init(type, &init) == RES_OK);
+
+        /* Maximum burst: words are received without reading until overflow */
+        overflow_cnt = 0;
+        uint32_t burst = 0;
+
+        while (!overflow_cnt) {
+            dma_receive(type, 1);
+            burst++;
+        }
+
+        burst--;
+        HOST_CHECK(burst == init.rx_size);
+
+        HOST_CHECK(bsp_uart_start(type) == RES_OK);
+        overflow_cnt = 0;
+
+        /* Masking of the half of receive buffer committed by each half transfer event */
+        uint64_t cycles[2] = {0};
+        uint64_t bytes = 0;
+        uint16_t data_mask = bsp_uart_data_mask_get(type);
+        struct uart_rx_span span;
+
+        for (uint32_t run = 0; run < RUNS_CNT; run++) {
+            dma_receive(type, init.rx_size / CHUNK_DIV);
+            HOST_CHECK(bsp_uart_read_acquire(type, &span, 0) == RES_OK);
+
+            uint64_t start = host_cycles();
+            for (uint32_t i = 0; i < ARRAY_SIZE(span.data); i++)
+                mask_runtime(&words[i ? span.len[0] : 0], span.data[i], span.word_size, span.len[i], data_mask);
+            cycles[0] += host_cycles() - start;
+
+            uint16_t check = words[span.len[0] + span.len[1] - 1];
+
+            start = host_cycles();
+            span.copy(words, span.data[0], span.len[0]);
+            span.copy(&words[span.len[0]], span.data[1], span.len[1]);
+            cycles[1] += host_cycles() - start;
+
+            HOST_CHECK(check == words[span.len[0] + span.len[1] - 1]);
+
+            bytes += (span.len[0] + span.len[1]) * span.word_size;
+            uint16_t lost = 0;
+            HOST_CHECK(bsp_uart_read_release(type, span.len[0] + span.len[1], &lost) == RES_OK);
+            HOST_CHECK(!lost);
+        }
+
+        HOST_CHECK(!overflow_cnt);
+
+        printf("%s: %u B words, burst %4u words (%5.1f ms at %u bods), runtime mask %5.2f B/cycle, specialised %5.2f B/cycle\n",
+               formats[f].name, word_size, burst, burst * bsp_uart_char_time_get(type) / 1000000.0, BURST_BAUDRATE,
+               (double)bytes / cycles[0], (double)bytes / cycles[1]);
+
+        HOST_CHECK(bsp_uart_deinit(type) == RES_OK);
+    }
+
+    return HOST_TEST_RESULT();
+}
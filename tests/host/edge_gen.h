@@ -0,0 +1,83 @@
+/**
+\file
+\author JavaLandau
+\copyright MIT License
+\brief Generator of synthetic edges of RS-232 line
+
+The file includes generator of timestamps of edges of UART frames with random data  
+as they are captured by the timer of the algorithm
+*/
+
+#ifndef __EDGE_GEN_H__
+#define __EDGE_GEN_H__
+
+#include <stdint.h>
+#include <stdlib.h>
+
+/// Parameters of synthetic UART traffic
+struct edge_gen_params {
+    double tick_freq;           ///< Frequency of the capturing timer in Hz
+    double baudrate;            ///< Actual baudrate of the line in bods (may differ from nominal one)
+    uint8_t data_bits;          ///< Count of data bits (5..9)
+    uint8_t parity;             ///< Parity: 0 - none, 1 - even, 2 - odd
+    uint8_t stop_bits;          ///< Count of stop bits
+    uint32_t frames;            ///< Count of generated frames
+    double idle_bits;           ///< IDLE between frames is randomly 0, 1 or 2 times of \ref idle_bits bits
+    double jitter_ticks;        ///< Peak-to-peak uniform jitter of captured edges in ticks
+    unsigned seed;              ///< Seed of random data & jitter
+};
+
+/** Generation of timestamps of edges
+ * 
+ * The line starts in IDLE (upper) level, so the first edge is falling one
+ * 
+ * \param[out] buff timestamps of edges in ticks
+ * \param[in] max maximum count of edges in \p buff
+ * \param[in] params parameters of UART traffic
+ * \return count of generated edges
+ */
+static inline uint32_t edge_gen(uint32_t *buff, uint32_t max, const struct edge_gen_params *params)
+{
+    double time = 1000.0;
+    double len_bit = params->tick_freq / params->baudrate;
+    int level = 1;
+    uint32_t cnt = 0;
+
+    srand(params->seed);
+
+    for (uint32_t frame = 0; frame < params->frames && cnt < max; frame++) {
+        int bits[16];
+        int bits_cnt = 0;
+        int ones = 0;
+        unsigned data = (unsigned)rand();
+
+        bits[bits_cnt++] = 0;
+
+        for (int i = 0; i < params->data_bits; i++) {
+            bits[bits_cnt] = (data >> i) & 1;
+            ones += bits[bits_cnt++];
+        }
+
+        if (params->parity)
+            bits[bits_cnt++] = (params->parity == 1) ? (ones & 1) : !(ones & 1);
+
+        for (int i = 0; i < params->stop_bits; i++)
+            bits[bits_cnt++] = 1;
+
+        for (int i = 0; i < bits_cnt; i++) {
+            if (bits[i] != level && cnt < max) {
+                double jitter = params->jitter_ticks * ((double)rand() / RAND_MAX - 0.5);
+                buff[cnt++] = (uint32_t)(time + jitter);
+                level = bits[i];
+            }
+
+            time += len_bit;
+        }
+
+        time += len_bit * params->idle_bits * (rand() % 3);
+    }
+
+    return cnt;
+}
+
+#endif //__EDGE_GEN_H__
@@ -0,0 +1,67 @@
+/**
+\file
+\author JavaLandau
+\copyright MIT License
+\brief Utils of host tests
+
+The file includes checks and time measurement for host tests & benchmarks
+*/
+
+#ifndef __HOST_TEST_H__
+#define __HOST_TEST_H__
+
+#include <stdio.h>
+#include <stdint.h>
+#include <time.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+/// Count of failed checks of the test
+static uint32_t host_test_failures = 0;
+
+/** MACRO Check of the test
+ * 
+ * The macro counts & prints failed check, the test goes on
+ * 
+ * \param[in] COND checked condition
+*/
+#define HOST_CHECK(COND)    do { \
+                                if (!(COND)) { \
+                                    host_test_failures++; \
+                                    printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #COND); \
+                                } \
+                            } while (0)
+
+/** MACRO Result of the test
+ * 
+ * \return exit code of the test: 0 if all checks are passed, 1 otherwise
+*/
+#define HOST_TEST_RESULT()  (host_test_failures ? 1 : 0)
+
+/** Time in ns
+ * 
+ * \return monotonic time in ns
+ */
+static inline uint64_t host_time_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (uint64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+/** Count of CPU cycles
+ * 
+ * \return time stamp counter on x86, time in ns otherwise
+ */
+static inline uint64_t host_cycles(void)
+{
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    return host_time_ns();
+#endif
+}
+
+#endif //__HOST_TEST_H__
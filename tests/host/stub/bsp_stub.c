@@ -0,0 +1,59 @@
+/**
+\file
+\author JavaLandau
+\copyright MIT License
+\brief Host stub of BSP modules
+
+The file implements BSP functions used by the firmware modules which are not built  
+for a test, all functions are weak, so a test including the BSP module overrides them
+*/
+
+#include "common.h"
+#include "bsp_rcc.h"
+#include "bsp_uart.h"
+
+/// Weak attribute of stub functions
+#define STUB_WEAK   __attribute__((weak))
+
+/// Frequency of TIM internal clock on APB1 at HCLK 180 MHz
+#define STUB_APB1_TIM_FREQ  (90000000)
+
+STUB_WEAK uint32_t bsp_rcc_apb_timer_freq_get(TIM_TypeDef *instance)
+{
+    return STUB_APB1_TIM_FREQ;
+}
+
+STUB_WEAK uint32_t bsp_rcc_us_get(void)
+{
+    return 0;
+}
+
+STUB_WEAK uint8_t bsp_uart_init(enum uart_type type, struct uart_init_ctx *init)
+{
+    return RES_OK;
+}
+
+STUB_WEAK uint8_t bsp_uart_deinit(enum uart_type type)
+{
+    return RES_OK;
+}
+
+STUB_WEAK uint8_t bsp_uart_start(enum uart_type type)
+{
+    return RES_OK;
+}
+
+STUB_WEAK uint8_t bsp_uart_stop(enum uart_type type)
+{
+    return RES_OK;
+}
+
+STUB_WEAK uint8_t bsp_uart_read_acquire(enum uart_type type, struct uart_rx_span *span, uint32_t tmt_ms)
+{
+    return RES_TIMEOUT;
+}
+
+STUB_WEAK uint8_t bsp_uart_read_release(enum uart_type type, uint16_t len, uint16_t *lost)
+{
+    return RES_OK;
+}
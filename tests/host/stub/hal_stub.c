@@ -0,0 +1,306 @@
+/**
+\file
+\author JavaLandau
+\copyright MIT License
+\brief Host stub of STM32 HAL
+
+The file implements STM32 HAL functions used by the firmware modules as no-operations,  
+all functions are weak, so a test can override any of them
+*/
+
+#include "stm32f4xx_hal.h"
+#include "stm32f4xx_ll_rcc.h"
+#include "stm32f4xx_ll_usart.h"
+
+/// Weak attribute of stub functions
+#define STUB_WEAK   __attribute__((weak))
+
+GPIO_TypeDef stub_gpio[3];
+TIM_TypeDef stub_tim[8];
+USART_TypeDef stub_usart[5];
+DMA_Stream_TypeDef stub_dma1_stream[8];
+DWT_Type stub_dwt;
+
+STUB_WEAK void HAL_GPIO_Init(GPIO_TypeDef *arg0, GPIO_InitTypeDef *arg1)
+{
+}
+
+STUB_WEAK void HAL_GPIO_DeInit(GPIO_TypeDef *arg0, uint32_t arg1)
+{
+}
+
+STUB_WEAK uint32_t HAL_GetTick(void)
+{
+    static uint32_t tick = 0;
+
+    return tick++;
+}
+
+STUB_WEAK void HAL_NVIC_ClearPendingIRQ(IRQn_Type arg0)
+{
+}
+
+STUB_WEAK void HAL_NVIC_EnableIRQ(IRQn_Type arg0)
+{
+}
+
+STUB_WEAK void HAL_NVIC_DisableIRQ(IRQn_Type arg0)
+{
+}
+
+STUB_WEAK void HAL_NVIC_SetPriority(IRQn_Type arg0, uint32_t arg1, uint32_t arg2)
+{
+}
+
+STUB_WEAK void HAL_NVIC_SystemReset(void)
+{
+}
+
+STUB_WEAK void HAL_Init(void)
+{
+}
+
+STUB_WEAK void HAL_IncTick(void)
+{
+}
+
+STUB_WEAK uint32_t HAL_RCC_GetHCLKFreq(void)
+{
+    return 180000000;
+}
+
+STUB_WEAK uint32_t HAL_RCC_GetPCLK1Freq(void)
+{
+    return 45000000;
+}
+
+STUB_WEAK uint32_t HAL_RCC_GetSysClockFreq(void)
+{
+    return 180000000;
+}
+
+STUB_WEAK uint32_t __get_PRIMASK(void)
+{
+    return 0;
+}
+
+STUB_WEAK void __set_PRIMASK(uint32_t arg0)
+{
+}
+
+STUB_WEAK HAL_StatusTypeDef HAL_EXTI_SetConfigLine(EXTI_HandleTypeDef *arg0, EXTI_ConfigTypeDef *arg1)
+{
+    return HAL_OK;
+}
+
+STUB_WEAK void HAL_EXTI_ClearPending(EXTI_HandleTypeDef *arg0, uint32_t arg1)
+{
+}
+
+STUB_WEAK HAL_StatusTypeDef HAL_EXTI_ClearConfigLine(EXTI_HandleTypeDef *arg0)
+{
+    return HAL_OK;
+}
+
+STUB_WEAK HAL_StatusTypeDef HAL_DMA_Init(DMA_HandleTypeDef *arg0)
+{
+    return HAL_OK;
+}
+
+STUB_WEAK HAL_StatusTypeDef HAL_DMA_DeInit(DMA_HandleTypeDef *arg0)
+{
+    return HAL_OK;
+}
+
+STUB_WEAK void HAL_DMA_IRQHandler(DMA_HandleTypeDef *arg0)
+{
+}
+
+STUB_WEAK HAL_StatusTypeDef HAL_DMA_Start(DMA_HandleTypeDef *arg0, uint32_t arg1, uint32_t arg2, uint32_t arg3)
+{
+    return HAL_OK;
+}
+
+STUB_WEAK HAL_StatusTypeDef HAL_DMA_Abort(DMA_HandleTypeDef *arg0)
+{
+    return HAL_OK;
+}
+
+STUB_WEAK HAL_StatusTypeDef HAL_TIM_RegisterCallback(TIM_HandleTypeDef *arg0, HAL_TIM_CallbackIDTypeDef arg1, void (*arg2)(TIM_HandleTypeDef*))
+{
+    return HAL_OK;
+}
+
+STUB_WEAK HAL_StatusTypeDef HAL_TIM_Base_Init(TIM_HandleTypeDef *arg0)
+{
+    return HAL_OK;
+}
+
+STUB_WEAK HAL_StatusTypeDef HAL_TIM_Base_DeInit(TIM_HandleTypeDef *arg0)
+{
+    return HAL_OK;
+}
+
+STUB_WEAK HAL_StatusTypeDef HAL_TIM_Base_Start(TIM_HandleTypeDef *arg0)
+{
+    return HAL_OK;
+}
+
+STUB_WEAK HAL_StatusTypeDef HAL_TIM_Base_Stop(TIM_HandleTypeDef *arg0)
+{
+    return HAL_OK;
+}
+
+STUB_WEAK HAL_StatusTypeDef HAL_TIM_Base_Start_IT(TIM_HandleTypeDef *arg0)
+{
+    return HAL_OK;
+}
+
+STUB_WEAK HAL_StatusTypeDef HAL_TIM_Base_Stop_IT(TIM_HandleTypeDef *arg0)
+{
+    return HAL_OK;
+}
+
+STUB_WEAK HAL_StatusTypeDef HAL_TIM_IC_Init(TIM_HandleTypeDef *arg0)
+{
+    return HAL_OK;
+}
+
+STUB_WEAK HAL_StatusTypeDef HAL_TIM_IC_DeInit(TIM_HandleTypeDef *arg0)
+{
+    return HAL_OK;
+}
+
+STUB_WEAK HAL_StatusTypeDef HAL_TIM_IC_ConfigChannel(TIM_HandleTypeDef *arg0, TIM_IC_InitTypeDef *arg1, uint32_t arg2)
+{
+    return HAL_OK;
+}
+
+STUB_WEAK HAL_StatusTypeDef HAL_TIM_IC_Start_DMA(TIM_HandleTypeDef *arg0, uint32_t arg1, uint32_t *arg2, uint16_t arg3)
+{
+    return HAL_OK;
+}
+
+STUB_WEAK HAL_StatusTypeDef HAL_TIM_IC_Stop_DMA(TIM_HandleTypeDef *arg0, uint32_t arg1)
+{
+    return HAL_OK;
+}
+
+STUB_WEAK void HAL_TIM_IRQHandler(TIM_HandleTypeDef *arg0)
+{
+}
+
+STUB_WEAK HAL_StatusTypeDef HAL_UART_RegisterCallback(void *arg0, int arg1, void (*arg2)(UART_HandleTypeDef*))
+{
+    return HAL_OK;
+}
+
+STUB_WEAK HAL_StatusTypeDef HAL_UART_Init(UART_HandleTypeDef *huart)
+{
+    huart->gState = HAL_UART_STATE_READY;
+    return HAL_OK;
+}
+
+STUB_WEAK HAL_StatusTypeDef HAL_LIN_Init(UART_HandleTypeDef *huart, uint32_t arg1)
+{
+    huart->gState = HAL_UART_STATE_READY;
+    return HAL_OK;
+}
+
+STUB_WEAK HAL_StatusTypeDef HAL_UART_DeInit(UART_HandleTypeDef *huart)
+{
+    huart->gState = HAL_UART_STATE_RESET;
+    return HAL_OK;
+}
+
+STUB_WEAK HAL_StatusTypeDef HAL_UART_DMAStop(UART_HandleTypeDef *arg0)
+{
+    return HAL_OK;
+}
+
+STUB_WEAK HAL_StatusTypeDef HAL_UART_AbortTransmit(UART_HandleTypeDef *arg0)
+{
+    return HAL_OK;
+}
+
+STUB_WEAK HAL_StatusTypeDef HAL_UART_Transmit_DMA(UART_HandleTypeDef *arg0, const uint8_t *arg1, uint16_t arg2)
+{
+    return HAL_OK;
+}
+
+STUB_WEAK HAL_StatusTypeDef HAL_UARTEx_ReceiveToIdle_DMA(UART_HandleTypeDef *arg0, uint8_t *arg1, uint16_t arg2)
+{
+    return HAL_OK;
+}
+
+STUB_WEAK HAL_UART_RxEventTypeTypeDef HAL_UARTEx_GetRxEventType(UART_HandleTypeDef *arg0)
+{
+    return arg0->RxEventType;
+}
+
+STUB_WEAK HAL_StatusTypeDef HAL_UART_RegisterRxEventCallback(UART_HandleTypeDef *arg0, void (*arg1)(UART_HandleTypeDef*, uint16_t))
+{
+    return HAL_OK;
+}
+
+STUB_WEAK void HAL_UART_IRQHandler(UART_HandleTypeDef *arg0)
+{
+}
+
+STUB_WEAK HAL_StatusTypeDef HAL_FLASH_Unlock(void)
+{
+    return HAL_OK;
+}
+
+STUB_WEAK HAL_StatusTypeDef HAL_FLASH_Lock(void)
+{
+    return HAL_OK;
+}
+
+STUB_WEAK HAL_StatusTypeDef HAL_FLASHEx_Erase(FLASH_EraseInitTypeDef *arg0, uint32_t *arg1)
+{
+    return HAL_OK;
+}
+
+STUB_WEAK HAL_StatusTypeDef HAL_FLASH_Program(uint32_t arg0, uint32_t arg1, uint64_t arg2)
+{
+    return HAL_OK;
+}
+
+STUB_WEAK uint32_t LL_RCC_GetTIMPrescaler(void)
+{
+    return 0;
+}
+
+STUB_WEAK uint32_t LL_USART_IsEnabledLIN(USART_TypeDef *USARTx)
+{
+    return 0;
+}
+
+STUB_WEAK uint32_t LL_USART_IsEnabledIT_LBD(USART_TypeDef *USARTx)
+{
+    return 0;
+}
+
+STUB_WEAK uint32_t LL_USART_IsActiveFlag_LBD(USART_TypeDef *USARTx)
+{
+    return 0;
+}
+
+STUB_WEAK uint32_t LL_USART_IsActiveFlag_FE(USART_TypeDef *USARTx)
+{
+    return 0;
+}
+
+STUB_WEAK uint32_t LL_USART_IsActiveFlag_RXNE(USART_TypeDef *USARTx)
+{
+    return 0;
+}
+
+STUB_WEAK void LL_USART_ClearFlag_LBD(USART_TypeDef *USARTx)
+{
+}
+
+STUB_WEAK void LL_USART_ClearFlag_FE(USART_TypeDef *USARTx)
+{
+}
@@ -0,0 +1,257 @@
+/**
+\file
+\author JavaLandau
+\copyright MIT License
+\brief Host stub of STM32 HAL
+
+The file declares subset of STM32F4 HAL used by the firmware modules built for host tests,  
+functions are implemented by hal_stub.c
+*/
+
+#ifndef __STM32F4XX_HAL_H__
+#define __STM32F4XX_HAL_H__
+
+#include <stdint.h>
+#include <stddef.h>
+#define __IO volatile
+typedef enum {HAL_OK=0,HAL_ERROR,HAL_BUSY,HAL_TIMEOUT} HAL_StatusTypeDef;
+typedef int IRQn_Type;
+enum { EXTI3_IRQn=9, EXTI4_IRQn, EXTI9_5_IRQn, DMA1_Stream0_IRQn, DMA1_Stream1_IRQn, DMA1_Stream2_IRQn, DMA1_Stream3_IRQn, DMA1_Stream4_IRQn, DMA1_Stream5_IRQn, DMA1_Stream6_IRQn, UART4_IRQn, USART2_IRQn, USART3_IRQn, TIM5_IRQn, TIM7_IRQn, TIM2_IRQn, TIM6_DAC_IRQn };
+typedef struct { volatile uint32_t MODER,OTYPER,OSPEEDR,PUPDR,IDR,ODR,BSRR,LCKR,AFR[2]; } GPIO_TypeDef;
+typedef struct { volatile uint32_t CR1,CR2,SMCR,DIER,SR,EGR,CCMR1,CCMR2,CCER,CNT,PSC,ARR,RCR,CCR1,CCR2,CCR3,CCR4,BDTR,DCR,DMAR,OR; } TIM_TypeDef;
+typedef struct { volatile uint32_t SR,DR,BRR,CR1,CR2,CR3,GTPR; } USART_TypeDef;
+typedef struct { volatile uint32_t CR,NDTR,PAR,M0AR,M1AR,FCR; } DMA_Stream_TypeDef;
+typedef struct { volatile uint32_t CYCCNT; volatile uint32_t CTRL; } DWT_Type;
+/* Peripherals are host objects, see hal_stub.c */
+extern GPIO_TypeDef stub_gpio[3];
+extern TIM_TypeDef stub_tim[8];
+extern USART_TypeDef stub_usart[5];
+extern DMA_Stream_TypeDef stub_dma1_stream[8];
+extern DWT_Type stub_dwt;
+#define GPIOA (&stub_gpio[0])
+#define GPIOB (&stub_gpio[1])
+#define GPIOC (&stub_gpio[2])
+#define TIM1 (&stub_tim[1])
+#define TIM2 (&stub_tim[2])
+#define TIM5 (&stub_tim[5])
+#define TIM6 (&stub_tim[6])
+#define TIM7 (&stub_tim[7])
+#define UART4 (&stub_usart[4])
+#define USART2 (&stub_usart[2])
+#define USART3 (&stub_usart[3])
+#define DMA1_Stream0 (&stub_dma1_stream[0])
+#define DMA1_Stream1 (&stub_dma1_stream[1])
+#define DMA1_Stream2 (&stub_dma1_stream[2])
+#define DMA1_Stream3 (&stub_dma1_stream[3])
+#define DMA1_Stream4 (&stub_dma1_stream[4])
+#define DMA1_Stream5 (&stub_dma1_stream[5])
+#define DMA1_Stream6 (&stub_dma1_stream[6])
+#define DWT (&stub_dwt)
+#define GPIO_PIN_0 0x1u
+#define GPIO_PIN_1 0x2u
+#define GPIO_PIN_3 0x8u
+#define GPIO_PIN_5 0x20u
+typedef struct { uint32_t Pin,Mode,Pull,Speed,Alternate; } GPIO_InitTypeDef;
+#define GPIO_MODE_INPUT 0
+#define GPIO_MODE_AF_PP 2
+#define GPIO_MODE_IT_RISING_FALLING 3
+#define GPIO_PULLUP 1
+#define GPIO_NOPULL 0
+#define GPIO_SPEED_FREQ_HIGH 2
+#define GPIO_SPEED_FREQ_VERY_HIGH 3
+#define GPIO_AF7_USART2 7
+#define GPIO_AF7_USART3 7
+#define GPIO_AF8_UART4 8
+#define GPIO_AF2_TIM5 2
+#define GPIO_AF1_TIM2 1
+void HAL_GPIO_Init(GPIO_TypeDef*, GPIO_InitTypeDef*);
+void HAL_GPIO_DeInit(GPIO_TypeDef*, uint32_t);
+uint32_t HAL_GetTick(void);
+void HAL_NVIC_ClearPendingIRQ(IRQn_Type);
+void HAL_NVIC_EnableIRQ(IRQn_Type);
+void HAL_NVIC_DisableIRQ(IRQn_Type);
+void HAL_NVIC_SetPriority(IRQn_Type, uint32_t, uint32_t);
+void HAL_NVIC_SystemReset(void);
+void HAL_Init(void);
+void HAL_IncTick(void);
+uint32_t HAL_RCC_GetHCLKFreq(void);
+uint32_t HAL_RCC_GetPCLK1Freq(void);
+uint32_t HAL_RCC_GetSysClockFreq(void);
+#define __NOP() do{}while(0)
+#define __DMB() do{}while(0)
+/* Exclusive access of single-threaded host: store always succeeds */
+#define __LDREXW(p) (*(p))
+#define __STREXW(v, p) ((*(p) = (v)), 0u)
+#define __CLREX() do{}while(0)
+#define __DSB() do{}while(0)
+#define __disable_irq() do{}while(0)
+#define __enable_irq() do{}while(0)
+uint32_t __get_PRIMASK(void);
+void __set_PRIMASK(uint32_t);
+#define __HAL_RCC_GPIOA_IS_CLK_DISABLED() 0
+#define __HAL_RCC_GPIOC_IS_CLK_DISABLED() 0
+#define __HAL_RCC_GPIOA_CLK_ENABLE() do{}while(0)
+#define __HAL_RCC_GPIOC_CLK_ENABLE() do{}while(0)
+#define __HAL_RCC_DMA1_IS_CLK_DISABLED() 0
+#define __HAL_RCC_DMA1_CLK_ENABLE() do{}while(0)
+#define __HAL_RCC_TIM5_CLK_ENABLE() do{}while(0)
+#define __HAL_RCC_TIM5_CLK_DISABLE() do{}while(0)
+#define __HAL_RCC_TIM6_CLK_ENABLE() do{}while(0)
+#define __HAL_RCC_TIM6_CLK_DISABLE() do{}while(0)
+#define __HAL_RCC_UART4_CLK_ENABLE() do{}while(0)
+#define __HAL_RCC_UART4_CLK_DISABLE() do{}while(0)
+#define __HAL_RCC_USART2_CLK_ENABLE() do{}while(0)
+#define __HAL_RCC_USART2_CLK_DISABLE() do{}while(0)
+#define __HAL_RCC_USART3_CLK_ENABLE() do{}while(0)
+#define __HAL_RCC_USART3_CLK_DISABLE() do{}while(0)
+#define __HAL_GPIO_EXTI_CLEAR_IT(x) do{}while(0)
+#define IS_TIM_INSTANCE(x) 1
+/* EXTI */
+typedef struct { uint32_t Line; void *cb; } EXTI_HandleTypeDef;
+typedef struct { uint32_t Line,Mode,Trigger,GPIOSel; } EXTI_ConfigTypeDef;
+#define EXTI_LINE_3 3
+#define EXTI_LINE_5 5
+#define EXTI_MODE_INTERRUPT 1
+#define EXTI_TRIGGER_RISING_FALLING 3
+#define EXTI_GPIOA 0
+#define EXTI_GPIOC 2
+HAL_StatusTypeDef HAL_EXTI_SetConfigLine(EXTI_HandleTypeDef*, EXTI_ConfigTypeDef*);
+void HAL_EXTI_ClearPending(EXTI_HandleTypeDef*, uint32_t);
+HAL_StatusTypeDef HAL_EXTI_ClearConfigLine(EXTI_HandleTypeDef*);
+/* DMA */
+typedef struct { uint32_t Channel,Direction,PeriphInc,MemInc,PeriphDataAlignment,MemDataAlignment,Mode,Priority,FIFOMode,FIFOThreshold,MemBurst,PeriphBurst; } DMA_InitTypeDef;
+typedef struct __DMA_HandleTypeDef { DMA_Stream_TypeDef *Instance; DMA_InitTypeDef Init; void *Parent; uint32_t State; } DMA_HandleTypeDef;
+HAL_StatusTypeDef HAL_DMA_Init(DMA_HandleTypeDef*);
+HAL_StatusTypeDef HAL_DMA_DeInit(DMA_HandleTypeDef*);
+void HAL_DMA_IRQHandler(DMA_HandleTypeDef*);
+HAL_StatusTypeDef HAL_DMA_Start(DMA_HandleTypeDef*, uint32_t, uint32_t, uint32_t);
+HAL_StatusTypeDef HAL_DMA_Abort(DMA_HandleTypeDef*);
+#define __HAL_DMA_GET_COUNTER(h) ((h)->Instance->NDTR)
+#define DMA_CHANNEL_4 4
+#define DMA_CHANNEL_6 6
+#define DMA_MEMORY_TO_PERIPH 1
+#define DMA_PERIPH_TO_MEMORY 0
+#define DMA_PINC_DISABLE 0
+#define DMA_MINC_ENABLE 1
+#define DMA_PDATAALIGN_BYTE 0
+#define DMA_PDATAALIGN_HALFWORD 1
+#define DMA_PDATAALIGN_WORD 2
+#define DMA_MDATAALIGN_BYTE 0
+#define DMA_MDATAALIGN_HALFWORD 1
+#define DMA_MDATAALIGN_WORD 2
+#define DMA_NORMAL 0
+#define DMA_CIRCULAR 1
+#define DMA_PRIORITY_LOW 0
+#define DMA_PRIORITY_VERY_HIGH 3
+#define DMA_FIFOMODE_DISABLE 0
+#define DMA_FIFO_THRESHOLD_FULL 3
+#define DMA_MBURST_INC4 1
+#define DMA_MBURST_SINGLE 0
+#define DMA_PBURST_INC4 1
+#define DMA_PBURST_SINGLE 0
+/* TIM */
+typedef struct { uint32_t Prescaler,CounterMode,Period,ClockDivision,RepetitionCounter,AutoReloadPreload; } TIM_Base_InitTypeDef;
+typedef struct { uint32_t ICPolarity,ICSelection,ICPrescaler,ICFilter; } TIM_IC_InitTypeDef;
+typedef struct __TIM_HandleTypeDef { TIM_TypeDef *Instance; TIM_Base_InitTypeDef Init; DMA_HandleTypeDef *hdma[7]; uint32_t State; } TIM_HandleTypeDef;
+typedef enum { HAL_TIM_BASE_MSPINIT_CB_ID, HAL_TIM_BASE_MSPDEINIT_CB_ID, HAL_TIM_IC_MSPINIT_CB_ID, HAL_TIM_IC_MSPDEINIT_CB_ID, HAL_TIM_PERIOD_ELAPSED_CB_ID } HAL_TIM_CallbackIDTypeDef;
+HAL_StatusTypeDef HAL_TIM_RegisterCallback(TIM_HandleTypeDef*, HAL_TIM_CallbackIDTypeDef, void (*)(TIM_HandleTypeDef*));
+HAL_StatusTypeDef HAL_TIM_Base_Init(TIM_HandleTypeDef*);
+HAL_StatusTypeDef HAL_TIM_Base_DeInit(TIM_HandleTypeDef*);
+HAL_StatusTypeDef HAL_TIM_Base_Start(TIM_HandleTypeDef*);
+HAL_StatusTypeDef HAL_TIM_Base_Stop(TIM_HandleTypeDef*);
+HAL_StatusTypeDef HAL_TIM_Base_Start_IT(TIM_HandleTypeDef*);
+HAL_StatusTypeDef HAL_TIM_Base_Stop_IT(TIM_HandleTypeDef*);
+HAL_StatusTypeDef HAL_TIM_IC_Init(TIM_HandleTypeDef*);
+HAL_StatusTypeDef HAL_TIM_IC_DeInit(TIM_HandleTypeDef*);
+HAL_StatusTypeDef HAL_TIM_IC_ConfigChannel(TIM_HandleTypeDef*, TIM_IC_InitTypeDef*, uint32_t);
+HAL_StatusTypeDef HAL_TIM_IC_Start_DMA(TIM_HandleTypeDef*, uint32_t, uint32_t*, uint16_t);
+HAL_StatusTypeDef HAL_TIM_IC_Stop_DMA(TIM_HandleTypeDef*, uint32_t);
+void HAL_TIM_IRQHandler(TIM_HandleTypeDef*);
+#define TIM_CHANNEL_4 0xC
+#define TIM_DMA_ID_CC4 4
+#define TIM_INPUTCHANNELPOLARITY_BOTHEDGE 0xA
+#define TIM_ICSELECTION_DIRECTTI 1
+#define TIM_ICPSC_DIV1 0
+#define TIM_COUNTERMODE_UP 0
+#define TIM_CLOCKDIVISION_DIV1 0
+#define TIM_AUTORELOAD_PRELOAD_DISABLE 0
+#define TIM_IT_UPDATE 1
+#define __HAL_TIM_GET_COUNTER(h) ((h)->Instance->CNT)
+#define __HAL_TIM_ENABLE_IT(h,i) do{}while(0)
+#define __HAL_TIM_CLEAR_FLAG(h,i) do{}while(0)
+#define __HAL_LINKDMA(h, f, d) do{ (h)->f = &(d); (d).Parent = (h);}while(0)
+/* UART */
+typedef struct { uint32_t BaudRate,WordLength,StopBits,Parity,Mode,HwFlowCtl,OverSampling; } UART_InitTypeDef;
+typedef struct __UART_HandleTypeDef { USART_TypeDef *Instance; UART_InitTypeDef Init; DMA_HandleTypeDef *hdmatx,*hdmarx; uint32_t gState; uint32_t ErrorCode; __IO uint32_t RxEventType; } UART_HandleTypeDef;
+#define HAL_UART_STATE_RESET 0
+#define HAL_UART_STATE_READY 0x20
+#define HAL_UART_TX_COMPLETE_CB_ID 0x01
+HAL_StatusTypeDef HAL_UART_RegisterCallback(void*, int, void (*)(UART_HandleTypeDef*));
+#define HAL_UART_ERROR_PE 1
+#define HAL_UART_ERROR_NE 2
+#define HAL_UART_ERROR_FE 4
+#define HAL_UART_ERROR_ORE 8
+#define HAL_UART_ERROR_DMA 16
+#define UART_WORDLENGTH_8B 0
+#define UART_WORDLENGTH_9B 1
+#define UART_STOPBITS_1 0
+#define UART_STOPBITS_2 1
+#define UART_PARITY_NONE 0
+#define UART_PARITY_EVEN 1
+#define UART_PARITY_ODD 2
+#define UART_HWCONTROL_NONE 0
+#define UART_MODE_RX 1
+#define UART_MODE_TX_RX 3
+#define UART_OVERSAMPLING_16 0
+#define UART_OVERSAMPLING_8 0x8000
+#define UART_IT_LBD 1
+#define UART_LINBREAKDETECTLENGTH_11B 1
+#define USART_CR3_DMAR 0x40
+#define USART_CR3_DMAT 0x80
+#define USART_SR_PE 1
+#define USART_SR_FE 2
+#define USART_SR_NE 4
+#define USART_SR_ORE 8
+#define USART_SR_TC 0x40
+#define READ_BIT(R,B) ((R)&(B))
+#define SET_BIT(R,B) ((R) |= (B))
+#define CLEAR_BIT(R,B) ((R) &= ~(B))
+#define USART_CR1_RE 0x4
+#define HAL_IS_BIT_SET(R,B) (((R)&(B))!=0)
+#define __HAL_UART_ENABLE_IT(h,i) do{}while(0)
+#define __HAL_UART_CLEAR_PEFLAG(h) do{}while(0)
+HAL_StatusTypeDef HAL_UART_Init(UART_HandleTypeDef*);
+HAL_StatusTypeDef HAL_LIN_Init(UART_HandleTypeDef*, uint32_t);
+HAL_StatusTypeDef HAL_UART_DeInit(UART_HandleTypeDef*);
+HAL_StatusTypeDef HAL_UART_DMAStop(UART_HandleTypeDef*);
+HAL_StatusTypeDef HAL_UART_AbortTransmit(UART_HandleTypeDef*);
+HAL_StatusTypeDef HAL_UART_Transmit_DMA(UART_HandleTypeDef*, const uint8_t*, uint16_t);
+HAL_StatusTypeDef HAL_UARTEx_ReceiveToIdle_DMA(UART_HandleTypeDef*, uint8_t*, uint16_t);
+typedef uint32_t HAL_UART_RxEventTypeTypeDef;
+#define HAL_UART_RXEVENT_TC 0
+#define HAL_UART_RXEVENT_HT 1
+#define HAL_UART_RXEVENT_IDLE 2
+HAL_UART_RxEventTypeTypeDef HAL_UARTEx_GetRxEventType(UART_HandleTypeDef*);
+HAL_StatusTypeDef HAL_UART_RegisterRxEventCallback(UART_HandleTypeDef*, void (*)(UART_HandleTypeDef*, uint16_t));
+void HAL_UART_IRQHandler(UART_HandleTypeDef*);
+/* FLASH / CRC */
+typedef struct { uint32_t TypeErase,Banks,Sector,NbSectors,VoltageRange; } FLASH_EraseInitTypeDef;
+#define FLASH_BANK_1 1
+#define FLASH_VOLTAGE_RANGE_3 3
+#define FLASH_SECTOR_6 6
+#define FLASH_SECTOR_7 7
+#define FLASH_TYPEERASE_SECTORS 0
+#define FLASH_TYPEPROGRAM_BYTE 0
+#define FLASH_TYPEPROGRAM_WORD 2
+HAL_StatusTypeDef HAL_FLASH_Unlock(void);
+HAL_StatusTypeDef HAL_FLASH_Lock(void);
+HAL_StatusTypeDef HAL_FLASHEx_Erase(FLASH_EraseInitTypeDef*, uint32_t*);
+HAL_StatusTypeDef HAL_FLASH_Program(uint32_t, uint32_t, uint64_t);
+#define __HAL_TIM_ENABLE(h) ((h)->Instance->CR1 |= 1U)
+#ifndef WRITE_REG
+#define WRITE_REG(REG, VAL) ((REG) = (VAL))
+#endif
+#define UART_BRR_SAMPLING16(_PCLK_, _BAUD_) ((_PCLK_)/(_BAUD_))
+#define UART_BRR_SAMPLING8(_PCLK_, _BAUD_) ((_PCLK_)/(_BAUD_))
+
+#endif //__STM32F4XX_HAL_H__
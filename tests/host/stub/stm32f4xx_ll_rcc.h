@@ -0,0 +1,15 @@
+/**
+\file
+\author JavaLandau
+\copyright MIT License
+\brief Host stub of STM32 LL RCC
+*/
+
+#ifndef __STM32F4XX_LL_RCC_H__
+#define __STM32F4XX_LL_RCC_H__
+
+#include "stm32f4xx_hal.h"
+
+uint32_t LL_RCC_GetTIMPrescaler(void);
+
+#endif //__STM32F4XX_LL_RCC_H__
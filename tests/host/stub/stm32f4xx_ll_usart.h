@@ -0,0 +1,21 @@
+/**
+\file
+\author JavaLandau
+\copyright MIT License
+\brief Host stub of STM32 LL USART
+*/
+
+#ifndef __STM32F4XX_LL_USART_H__
+#define __STM32F4XX_LL_USART_H__
+
+#include "stm32f4xx_hal.h"
+
+uint32_t LL_USART_IsEnabledLIN(USART_TypeDef *USARTx);
+uint32_t LL_USART_IsEnabledIT_LBD(USART_TypeDef *USARTx);
+uint32_t LL_USART_IsActiveFlag_LBD(USART_TypeDef *USARTx);
+uint32_t LL_USART_IsActiveFlag_FE(USART_TypeDef *USARTx);
+uint32_t LL_USART_IsActiveFlag_RXNE(USART_TypeDef *USARTx);
+void LL_USART_ClearFlag_LBD(USART_TypeDef *USARTx);
+void LL_USART_ClearFlag_FE(USART_TypeDef *USARTx);
+
+#endif //__STM32F4XX_LL_USART_H__
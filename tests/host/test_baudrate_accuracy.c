@@ -0,0 +1,96 @@
+/**
+\file
+\author JavaLandau
+\copyright MIT License
+\brief Test of accuracy of baudrate detection
+
+The test runs baudrate calculation over synthetic edges captured by DMA for all known baudrates  
+up to \ref SNIFFER_RS232_BAUDRATE_HIGH_MAX, both resolutions of the timer and both types  
+of baudrate calculation, actual baudrate differs from the nominal one up to 2%.  
+Baudrate should be detected on every stream, measured baudrate error should match the actual one
+*/
+
+#include "sniffer_rs232.c"
+#include "host_test.h"
+#include "edge_gen.h"
+#include <math.h>
+
+/// Count of streams per baudrate & error
+#define STREAMS_CNT         (10)
+
+/// Maximum error of measured baudrate for \ref RS232_BAUDRATE_CALC_HISTOGRAM in ppm
+#define HIST_MAX_ERROR_PPM  (10000)
+
+/** Maximum error of measured baudrate for \ref RS232_BAUDRATE_CALC_MIN_WIDTH in ppm,  
+ * the narrowest widths are biased by jitter: 4 ticks of ~30 ticks per bit at 3 Mbaud */
+#define MIN_MAX_ERROR_PPM   (50000)
+
+int main(void)
+{
+    const uint32_t baudrates[] = {2400, 9600, 19200, 57600, 115200, 230400, 460800, 921600, 1500000, 2000000, 3000000};
+    const double errors[] = {-0.02, 0.0, 0.02};
+
+    for (uint32_t high = 0; high < 2; high++) {
+        for (uint32_t calc = 0; calc < RS232_BAUDRATE_CALC_MAX; calc++) {
+            struct sniffer_rs232_config sniffer_config = SNIFFER_RS232_CONFIG_DEFAULT();
+            sniffer_config.high_resolution = high;
+            sniffer_config.baudrate_calc_type = calc;
+            HOST_CHECK(sniffer_rs232_init(&sniffer_config) == RES_OK);
+
+            uint32_t detected = 0, total = 0;
+            double max_error_ppm = 0;
+
+            for (uint32_t i = 0; i < ARRAY_SIZE(baudrates); i++) {
+                if (baudrates[i] > __sniffer_rs232_baudrate_max_get())
+                    continue;
+
+                for (uint32_t e = 0; e < ARRAY_SIZE(errors); e++) {
+                    for (uint32_t s = 0; s < STREAMS_CNT; s++) {
+                        /* Capture jitter is a few cycles of the timer clock */
+                        struct edge_gen_params params = {.tick_freq = alg_tim_freq, .baudrate = baudrates[i] * (1 + errors[e]),
+                                                         .data_bits = 8, .parity = 1, .stop_bits = 1, .frames = 200,
+                                                         .idle_bits = (s & 1) ? 2 : 0, .jitter_ticks = high ? 4.0 : 1.0,
+                                                         .seed = s * 31 + i};
+
+                        memset(tx_buffer, 0, sizeof(tx_buffer));
+                        tx_cnt = edge_gen(tx_buffer, BUFFER_SIZE, &params);
+
+                        struct baud_calc_ctx ctx = {.cnt = &tx_cnt, .buffer = tx_buffer, .armed = true, .min_len_bit = UINT32_MAX};
+
+                        while (!ctx.done) {
+                            if (calc == RS232_BAUDRATE_CALC_HISTOGRAM)
+                                __sniffer_rs232_line_baudrate_hist_calc(&ctx);
+                            else
+                                __sniffer_rs232_line_baudrate_calc(&ctx);
+                        }
+
+                        total++;
+                        HOST_CHECK(ctx.baudrate == baudrates[i]);
+
+                        if (ctx.baudrate != baudrates[i])
+                            continue;
+
+                        detected++;
+                        __sniffer_rs232_baud_info_update(BSP_UART_TYPE_RS232_TX, &ctx, ctx.baudrate);
+
+                        /* Measured baudrate is reported only if averaged */
+                        if (!baud_info[BSP_UART_TYPE_RS232_TX].meas_baudrate)
+                            continue;
+
+                        double error_ppm = fabs(baud_info[BSP_UART_TYPE_RS232_TX].error_ppm - errors[e] * 1000000);
+                        max_error_ppm = fmax(max_error_ppm, error_ppm);
+                    }
+                }
+            }
+
+            const uint32_t max_ppm = (calc == RS232_BAUDRATE_CALC_HISTOGRAM) ? HIST_MAX_ERROR_PPM : MIN_MAX_ERROR_PPM;
+            HOST_CHECK(max_error_ppm <= max_ppm);
+
+            printf("%-5s %-9s up to %7u bods: detected %3u/%u, max error of measured baudrate %5.0f ppm\n",
+                   high ? "high" : "std", (calc == RS232_BAUDRATE_CALC_HISTOGRAM) ? "histogram" : "min width",
+                   __sniffer_rs232_baudrate_max_get(), detected, total, max_error_ppm);
+        }
+    }
+
+    return HOST_TEST_RESULT();
+}
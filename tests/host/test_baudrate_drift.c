@@ -0,0 +1,93 @@
+/**
+\file
+\author JavaLandau
+\copyright MIT License
+\brief Test of measurement of baudrate drift
+
+The test feeds EXTI handler of RS-232 TX line by synthetic 8E1 edges of baudrates drifted  
+from the nominal ones by up to 4.5% during drift tracking, both resolutions of the timer.  
+Baudrate measured by \ref sniffer_rs232_drift_get in each window should be within  
+\ref DRIFT_MAX_ERROR_PPM of the actual one, so drift of \ref CONFIG_DRIFT_THRESHOLD_MIN  
+is not caused by measurement error alone
+*/
+
+#include "sniffer_rs232.c"
+#include "config.h"
+#include "host_test.h"
+#include "edge_gen.h"
+#include <math.h>
+
+/// Maximum error of measured baudrate in ppm
+#define DRIFT_MAX_ERROR_PPM     (1000)
+
+/// Count of windows of drift tracking per baudrate & drift
+#define WINDOWS_CNT             (5)
+
+/// Timestamps of edges of one window
+static uint32_t edges[DRIFT_EDGES_CNT];
+
+int main(void)
+{
+    const uint32_t baudrates[] = {9600, 115200, 460800};
+    const double drifts[] = {-0.045, -0.02, -0.005, 0.0, 0.005, 0.02, 0.045};
+
+    _Static_assert(2 * DRIFT_MAX_ERROR_PPM <= CONFIG_DRIFT_THRESHOLD_MIN, "Drift threshold is within measurement error");
+
+    for (uint32_t high = 0; high < 2; high++) {
+        struct sniffer_rs232_config sniffer_config = SNIFFER_RS232_CONFIG_DEFAULT();
+        sniffer_config.high_resolution = high;
+        HOST_CHECK(sniffer_rs232_init(&sniffer_config) == RES_OK);
+
+        uint32_t measured = 0, total = 0;
+        double max_error_ppm = 0;
+
+        /* Line is at upper level when tracking & each window are started */
+        GPIOA->IDR |= GPIO_PIN_3;
+        HOST_CHECK(sniffer_rs232_drift_start() == RES_OK);
+
+        for (uint32_t i = 0; i < ARRAY_SIZE(baudrates); i++) {
+            for (uint32_t d = 0; d < ARRAY_SIZE(drifts); d++) {
+                for (uint32_t w = 0; w < WINDOWS_CNT; w++) {
+                    double actual = baudrates[i] * (1 + drifts[d]);
+                    struct edge_gen_params params = {.tick_freq = alg_tim_freq, .baudrate = actual,
+                                                     .data_bits = 8, .parity = 1, .stop_bits = 1, .frames = DRIFT_EDGES_CNT,
+                                                     .idle_bits = (w & 1) ? 2 : 0, .jitter_ticks = high ? 4.0 : 1.0,
+                                                     .seed = w * 31 + d * 7 + i};
+
+                    uint32_t cnt = edge_gen(edges, DRIFT_EDGES_CNT, &params);
+
+                    /* EXTI interrupt of the line is disabled when the window is full */
+                    for (uint32_t e = 0; e < cnt && tx_stats.edges_cnt < DRIFT_EDGES_CNT; e++) {
+                        alg_tim.Instance->CNT = edges[e];
+                        EXTI3_IRQHandler();
+                    }
+
+                    HOST_CHECK(tx_stats.edges_cnt == DRIFT_EDGES_CNT);
+
+                    uint32_t baudrate = 0;
+                    HOST_CHECK(sniffer_rs232_drift_get(BSP_UART_TYPE_RS232_TX, &baudrate) == RES_OK);
+                    HOST_CHECK(!tx_stats.edges_cnt);
+
+                    total++;
+                    HOST_CHECK(baudrate);
+
+                    if (!baudrate)
+                        continue;
+
+                    measured++;
+                    double error_ppm = fabs(baudrate - actual) * 1000000 / actual;
+                    max_error_ppm = fmax(max_error_ppm, error_ppm);
+                }
+            }
+        }
+
+        HOST_CHECK(sniffer_rs232_drift_stop() == RES_OK);
+        HOST_CHECK(max_error_ppm <= DRIFT_MAX_ERROR_PPM);
+
+        printf("%-5s drift up to %.1f%% of %u..%u bods: measured %u/%u windows, max error of measured baudrate %4.0f ppm, minimum threshold %u ppm\n",
+               high ? "high" : "std", drifts[ARRAY_SIZE(drifts) - 1] * 100, baudrates[0], baudrates[ARRAY_SIZE(baudrates) - 1],
+               measured, total, max_error_ppm, CONFIG_DRIFT_THRESHOLD_MIN);
+    }
+
+    return HOST_TEST_RESULT();
+}
@@ -0,0 +1,200 @@
+/**
+\file
+\author JavaLandau
+\copyright MIT License
+\brief Stress test of SPSC ring
+
+The test runs producer & consumer of \ref spsc_ring in different threads:
+write-through producer acting as DMA with restarts as by \ref bsp_uart_start,
+and pushing producer as thread writing into sent buffer. Consumer holds peeked
+elements while producer goes on, data of elements which are not reported as lost
+should be intact, each produced element is either received or dropped
+*/
+
+/* Barrier & compare-and-swap of the ring between threads of the host */
+#define SPSC_RING_BARRIER()             __atomic_thread_fence(__ATOMIC_SEQ_CST)
+#define SPSC_RING_CAS(PTR, OLD, NEW)    __atomic_compare_exchange_n(PTR, &(uint32_t){OLD}, NEW, false, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST)
+
+#include "spsc_ring.h"
+#include "host_test.h"
+#include <pthread.h>
+#include <sched.h>
+
+/// Count of elements in the ring
+#define RING_SIZE       (256)
+
+/// Count of elements produced per run
+#define PRODUCED_CNT    (10000000)
+
+/// Maximum count of elements produced at once
+#define CHUNK_MAX       (37)
+
+/// Count of elements produced between restarts of write-through producer
+#define RESTART_PERIOD  (100003)
+
+/// Types of producer
+enum producer_type {
+    PRODUCER_WRITE_THROUGH = 0,     ///< DMA writing elements in place regardless of consumer, see \ref spsc_ring_produced
+    PRODUCER_PUSH,                  ///< Thread pushing elements if they fit, see \ref spsc_ring_push
+    PRODUCER_MAX                    ///< Count of producer types
+};
+
+static uint32_t buff[RING_SIZE];                ///< Storage of the ring
+static struct spsc_ring ring;                   ///< The ring
+static enum producer_type producer_type;        ///< Type of producer of the run
+static uint32_t producer_burst;                 ///< Count of elements produced before producer yields
+static volatile bool producer_done;             ///< Flag whether producer is finished
+static volatile uint32_t produced;              ///< Count of produced elements
+static volatile uint32_t restarts;              ///< Count of restarts of write-through producer
+static uint32_t write_pos;                      ///< Free-running write position of write-through producer
+
+/** Producer thread
+ *
+ * Write-through producer writes free-running index of the element as its value,
+ * pushing producer writes sequence number of the element
+ *
+ * \param[in] arg unused
+ * \return NULL
+ */
+static void *producer(void *arg)
+{
+    uint32_t chunk[CHUNK_MAX];
+    uint32_t seq = 0, burst = 0, restart = 0;
+
+    while (seq < PRODUCED_CNT) {
+        uint32_t cnt = 1 + (seq * 7) % CHUNK_MAX;
+
+        if (producer_type == PRODUCER_WRITE_THROUGH) {
+            /* DMA is stopped & restarted from the beginning of the buffer */
+            if (restart >= RESTART_PERIOD) {
+                restart = 0;
+                spsc_ring_restart(&ring);
+                __atomic_store_n(&write_pos, ring.head, __ATOMIC_SEQ_CST);
+                restarts++;
+            }
+
+            uint32_t pos = ring.head;
+
+            /* Write position is published before the element is overwritten, as DMA counter */
+            for (uint32_t i = 0; i < cnt; i++) {
+                __atomic_store_n(&write_pos, pos + i + 1, __ATOMIC_RELAXED);
+                __atomic_thread_fence(__ATOMIC_SEQ_CST);
+                __atomic_store_n(&buff[(pos + i) & (RING_SIZE - 1)], pos + i, __ATOMIC_RELAXED);
+            }
+
+            spsc_ring_produced(&ring, cnt);
+            restart += cnt;
+        } else {
+            for (uint32_t i = 0; i < cnt; i++)
+                chunk[i] = seq + i;
+
+            spsc_ring_push(&ring, chunk, cnt);
+        }
+
+        seq += cnt;
+
+        if ((burst += cnt) >= producer_burst) {
+            burst = 0;
+            sched_yield();
+        }
+    }
+
+    produced = seq;
+    producer_done = true;
+
+    return NULL;
+}
+
+int main(void)
+{
+    const uint32_t bursts[] = {64, RING_SIZE - 16, 4096};
+
+    for (uint32_t type = 0; type < PRODUCER_MAX; type++) {
+        for (uint32_t b = 0; b < ARRAY_SIZE(bursts); b++) {
+            producer_type = type;
+            producer_burst = bursts[b];
+            producer_done = false;
+            restarts = 0;
+            write_pos = 0;
+            HOST_CHECK(spsc_ring_init(&ring, buff, RING_SIZE, sizeof(uint32_t)) == RES_OK);
+
+            pthread_t thread;
+            HOST_CHECK(!pthread_create(&thread, NULL, producer, NULL));
+
+            uint64_t received = 0;
+            uint32_t expected = 0, invalid = 0, release_errors = 0, dropped = 0, dropped_decreased = 0;
+            uint32_t words[RING_SIZE];
+
+            while (true) {
+                bool done = producer_done;
+                const void *data[2] = {NULL};
+                uint32_t len[2] = {0};
+
+                uint32_t cnt = spsc_ring_peek(&ring, data, len);
+                uint32_t idx = ring.held;
+
+                for (uint32_t s = 0; s < 2; s++) {
+                    for (uint32_t i = 0; i < len[s]; i++)
+                        words[s ? len[0] + i : i] = __atomic_load_n((const uint32_t*)data[s] + i, __ATOMIC_RELAXED);
+                }
+
+                /* Elements are held by consumer while producer goes on */
+                if (cnt && !(received & 0xF))
+                    sched_yield();
+
+                /* Elements overwritten after they are read are lost as well */
+                if (producer_type == PRODUCER_WRITE_THROUGH) {
+                    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+                    spsc_ring_written(&ring, __atomic_load_n(&write_pos, __ATOMIC_RELAXED));
+                }
+
+                uint32_t lost = 0;
+                if (spsc_ring_consume(&ring, cnt, &lost) != RES_OK)
+                    release_errors++;
+
+                for (uint32_t i = lost; i < cnt; i++) {
+                    if (producer_type == PRODUCER_WRITE_THROUGH) {
+                        /* Element which is not lost is exactly the one written at its position */
+                        if (words[i] != idx + i)
+                            invalid++;
+                    } else {
+                        /* Pushed elements are lost only if they do not fit */
+                        if ((int32_t)(words[i] - expected) < 0)
+                            invalid++;
+
+                        expected = words[i] + 1;
+                    }
+                }
+
+                received += cnt - lost;
+
+                if (ring.dropped < dropped)
+                    dropped_decreased++;
+                dropped = ring.dropped;
+
+                if (done && !spsc_ring_used(&ring))
+                    break;
+
+                if (!cnt)
+                    sched_yield();
+            }
+
+            pthread_join(thread, NULL);
+
+            HOST_CHECK(!invalid);
+            HOST_CHECK(!release_errors);
+            HOST_CHECK(!dropped_decreased);
+            HOST_CHECK(ring.high_water <= RING_SIZE);
+            HOST_CHECK(received + ring.dropped == produced);
+
+            if (producer_type == PRODUCER_WRITE_THROUGH)
+                HOST_CHECK(restarts);
+
+            printf("%-13s burst %4u: received %8llu, dropped %8u, restarts %3u, invalid %u, high-water %u/%u\n",
+                   (producer_type == PRODUCER_PUSH) ? "push" : "write-through", producer_burst,
+                   (unsigned long long)received, ring.dropped, restarts, invalid, ring.high_water, RING_SIZE);
+        }
+    }
+
+    return HOST_TEST_RESULT();
+}
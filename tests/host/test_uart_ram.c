@@ -0,0 +1,173 @@
+/**
+\file
+\author JavaLandau
+\copyright MIT License
+\brief Test of static RAM of BSP UART instances
+
+The test prints static RAM of each BSP UART instance: struct uart_ram_cli & struct uart_ram_rs232  
+checked against BSP_UART_RAM_CLI & BSP_UART_RAM_RS232 at build time. Sizes are of the host build,  
+buffers are the same on target, context & STM32 HAL DMA instances are listed in linker map file of the firmware  
+
+Then the test runs init/reinit/deinit cycles over all UART formats & buffer sizes and checks that:
+- malloc is never called (the test is linked with --wrap=malloc)
+- context, buffers & DMA instances always point at static storage of the instance
+- DMA RX data alignment follows word size of receive buffer
+- buffers exceeding static storage are rejected
+*/
+
+#include "bsp_uart.c"
+#include "host_test.h"
+#include <stdlib.h>
+
+/// Count of init/reinit/deinit cycles
+#define CYCLES_CNT      (200000)
+
+/// Count of calls of malloc
+static uint32_t malloc_cnt = 0;
+
+void *__real_malloc(size_t size);
+
+/** Wrapper of malloc counting calls
+ * 
+ * \param[in] size size of allocated memory
+ * \return allocated memory
+ */
+void *__wrap_malloc(size_t size)
+{
+    malloc_cnt++;
+    return __real_malloc(size);
+}
+
+/// UART format of the test
+struct test_format {
+    enum uart_wordlen wordlen;  ///< Word length
+    enum uart_parity parity;    ///< Parity type
+};
+
+/// UART formats of the test
+static const struct test_format formats[] = {
+    {BSP_UART_WORDLEN_7, BSP_UART_PARITY_NONE},
+    {BSP_UART_WORDLEN_8, BSP_UART_PARITY_NONE},
+    {BSP_UART_WORDLEN_8, BSP_UART_PARITY_EVEN},
+    {BSP_UART_WORDLEN_9, BSP_UART_PARITY_ODD},
+    {BSP_UART_WORDLEN_9, BSP_UART_PARITY_NONE},
+};
+
+/** Random power of 2 not greater than \p max
+ * 
+ * \param[in] max maximum value, power of 2
+ * \return random power of 2 from 1 to \p max
+ */
+static uint32_t rand_pow2(uint32_t max)
+{
+    uint32_t bits = 0;
+
+    while ((1u << (bits + 1)) <= max)
+        bits++;
+
+    return 1u << (rand() % (bits + 1));
+}
+
+/** Check of attached BSP UART instance
+ * 
+ * \param[in] type BSP UART type
+ * \param[in] init initializing context of the instance
+ */
+static void check_attached(enum uart_type type, const struct uart_init_ctx *init)
+{
+    const struct uart_ctx *ram_ctx = (type == BSP_UART_TYPE_CLI) ? &uart_ram_cli.ctx :
+                                     (type == BSP_UART_TYPE_RS232_TX) ? &uart_ram_rs232_tx.ctx : &uart_ram_rs232_rx.ctx;
+    const DMA_HandleTypeDef *hdma_rx = (type == BSP_UART_TYPE_CLI) ? &uart_ram_cli.hdma_rx :
+                                       (type == BSP_UART_TYPE_RS232_TX) ? &uart_ram_rs232_tx.hdma_rx : &uart_ram_rs232_rx.hdma_rx;
+    const struct uart_ctx *ctx = uart_obj[type].ctx;
+
+    HOST_CHECK(ctx == ram_ctx);
+    HOST_CHECK(ctx->rx_buff == uart_obj[type].rx_buff);
+    HOST_CHECK(ctx->rx_ring.size == init->rx_size);
+    HOST_CHECK(uart_obj[type].uart.hdmarx == hdma_rx);
+    HOST_CHECK(hdma_rx->Parent == &uart_obj[type].uart);
+
+    if (type == BSP_UART_TYPE_CLI) {
+        HOST_CHECK(ctx->tx_buff == uart_ram_cli.tx_buff);
+        HOST_CHECK(ctx->tx_ring.size == init->tx_size);
+        HOST_CHECK(uart_obj[type].uart.hdmatx == &uart_ram_cli.hdma_tx);
+    } else {
+        HOST_CHECK(!ctx->tx_buff);
+        HOST_CHECK(!uart_obj[type].uart.hdmatx);
+    }
+
+    uint32_t align = (ctx->rx_word_size == sizeof(uint16_t)) ? DMA_MDATAALIGN_HALFWORD : DMA_MDATAALIGN_BYTE;
+    HOST_CHECK(hdma_rx->Init.MemDataAlignment == align);
+    HOST_CHECK(ctx->rx_word_size == __uart_rx_word_size_get(type, init));
+}
+
+int main(void)
+{
+    printf("CLI    : %5zu B, buffers %5zu B, context & DMA %4zu B, limit BSP_UART_RAM_CLI   %5u B\n",
+           sizeof(struct uart_ram_cli), sizeof(uart_ram_cli.rx_buff) + sizeof(uart_ram_cli.tx_buff),
+           sizeof(struct uart_ram_cli) - sizeof(uart_ram_cli.rx_buff) - sizeof(uart_ram_cli.tx_buff), (unsigned)BSP_UART_RAM_CLI);
+    printf("RS-232 : %5zu B, buffers %5zu B, context & DMA %4zu B, limit BSP_UART_RAM_RS232 %5u B, per line\n",
+           sizeof(struct uart_ram_rs232), sizeof(uart_ram_rs232_tx.rx_buff),
+           sizeof(struct uart_ram_rs232) - sizeof(uart_ram_rs232_tx.rx_buff), (unsigned)BSP_UART_RAM_RS232);
+
+    uint32_t attached = 0, reinit = 0, rejected = 0;
+
+    srand(1);
+    for (uint32_t cycle = 0; cycle < CYCLES_CNT; cycle++) {
+        enum uart_type type = (enum uart_type)(cycle % BSP_UART_TYPE_MAX);
+        const struct test_format *format = &formats[rand() % ARRAY_SIZE(formats)];
+        struct uart_init_ctx init = {.baudrate = 115200, .stopbits = BSP_UART_STOPBITS_1};
+
+        if (type == BSP_UART_TYPE_CLI) {
+            init.wordlen = BSP_UART_WORDLEN_8;
+            init.parity = BSP_UART_PARITY_NONE;
+            init.tx_size = rand_pow2(sizeof(uart_ram_cli.tx_buff));
+        } else {
+            init.wordlen = format->wordlen;
+            init.parity = format->parity;
+        }
+
+        uint8_t word_size = __uart_rx_word_size_get(type, &init);
+        init.rx_size = rand_pow2(uart_obj[type].rx_buff_size / word_size);
+
+        bool was_attached = (uart_obj[type].ctx != NULL);
+
+        /* Buffers exceeding static storage are rejected, attached instance is kept */
+        if (!(rand() % 8)) {
+            struct uart_init_ctx over = init;
+
+            if (type == BSP_UART_TYPE_CLI && (rand() % 2))
+                over.tx_size = 2 * sizeof(uart_ram_cli.tx_buff);
+            else
+                over.rx_size = 2 * uart_obj[type].rx_buff_size / word_size;
+
+            HOST_CHECK(bsp_uart_init(type, &over) == RES_OVERFLOW);
+            HOST_CHECK((uart_obj[type].ctx != NULL) == was_attached);
+            rejected++;
+        }
+
+        HOST_CHECK(bsp_uart_init(type, &init) == RES_OK);
+        check_attached(type, &init);
+
+        if (was_attached)
+            reinit++;
+        else
+            attached++;
+
+        if (!(rand() % 3)) {
+            HOST_CHECK(bsp_uart_deinit(type) == RES_OK);
+            HOST_CHECK(!uart_obj[type].ctx);
+            HOST_CHECK(uart_obj[type].uart.gState == HAL_UART_STATE_RESET);
+        }
+    }
+
+    for (uint32_t type = 0; type < BSP_UART_TYPE_MAX; type++)
+        HOST_CHECK(bsp_uart_deinit((enum uart_type)type) == RES_OK);
+
+    HOST_CHECK(!malloc_cnt);
+
+    printf("%u cycles: %u inits, %u reinits, %u oversized buffers rejected, %u malloc calls\n",
+           CYCLES_CNT, attached, reinit, rejected, malloc_cnt);
+
+    return HOST_TEST_RESULT();
+}
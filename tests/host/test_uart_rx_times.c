@@ -0,0 +1,307 @@
+/**
+\file
+\author JavaLandau
+\copyright MIT License
+\brief Test of arrival times of words received by BSP UART
+
+RS-232 line at 9600 8N1 is simulated: words are written into receive buffer as by DMA RX  
+and callback by data reception is called by half & full transfer events at the end of the last word  
+and by idle event one character time later. Arrival times given by \ref bsp_uart_rx_times_get  
+are compared with true ones (end of stop bit):
+- clamping of reconstructed times of a chunk against the end of the previous chunk
+- words of chunks whose timestamps are lost by overflow of timestamps ring
+- words left after overrun of receive buffer
+- random bursts & idle gaps read at random moments, with overruns of receive buffer
+*/
+
+#include "bsp_uart.c"
+#include "host_test.h"
+#include <stdlib.h>
+
+/// Baudrate of the line
+#define LINE_BAUDRATE   (9600)
+
+/// Size of receive buffer in words
+#define LINE_RX_SIZE    (256)
+
+/// Character time of 8N1 frame in ns
+#define LINE_CHAR_NS    (10ull * 1000000000 / LINE_BAUDRATE)
+
+/// Maximum error of arrival time in us, times are integer us
+#define TIME_ERROR_MAX  (2)
+
+/// Count of words of random line
+#define RANDOM_WORDS    (400000)
+
+/// Simulated RS-232 TX line
+static const enum uart_type type = BSP_UART_TYPE_RS232_TX;
+
+/// Current time in ns
+static uint64_t now_ns = 0;
+
+/// Count of words written by simulated DMA RX
+static uint32_t dma_pos = 0;
+
+/// True arrival times of words in us by position of receive buffer
+static uint32_t true_us[RANDOM_WORDS + 4 * LINE_RX_SIZE];
+
+/// Maximum error of arrival time in us
+static uint32_t error_max = 0;
+
+/// Count of checked words
+static uint32_t checked_cnt = 0;
+
+/* Microsecond timer of BSP RCC is driven by the test */
+uint32_t bsp_rcc_us_get(void)
+{
+    return (uint32_t)(now_ns / 1000);
+}
+
+/** Callback by data reception at the current DMA RX position
+ * 
+ * \param[in] event STM32 HAL reception event
+ */
+static void line_event(uint32_t event)
+{
+    uint32_t pos = ((dma_pos - 1) & (LINE_RX_SIZE - 1)) + 1;
+
+    uart_obj[type].uart.RxEventType = event;
+    __uart_rx_callback(&uart_obj[type].uart, (uint16_t)pos);
+}
+
+/** Reception of words going back to back
+ * 
+ * Half & full transfer events come at the end of stop bit of the word filling in  
+ * the half of receive buffer
+ * 
+ * \param[in] cnt count of words
+ */
+static void line_words(uint32_t cnt)
+{
+    struct spsc_ring *ring = &uart_obj[type].ctx->rx_ring;
+
+    for (uint32_t i = 0; i < cnt; i++) {
+        now_ns += LINE_CHAR_NS;
+
+        ring->buff[dma_pos & (LINE_RX_SIZE - 1)] = (uint8_t)dma_pos;
+        true_us[dma_pos] = bsp_rcc_us_get();
+        dma_pos++;
+
+        uart_obj[type].uart.hdmarx->Instance->NDTR = LINE_RX_SIZE - (dma_pos & (LINE_RX_SIZE - 1));
+
+        if (!(dma_pos & (LINE_RX_SIZE / 2 - 1)))
+            line_event((dma_pos & (LINE_RX_SIZE - 1)) ? HAL_UART_RXEVENT_HT : HAL_UART_RXEVENT_TC);
+    }
+}
+
+/** Idle line after the last word
+ * 
+ * Idle event comes after one character time of idle line
+ * 
+ * \param[in] gap_ns duration of idle line in ns, not less than character time
+ */
+static void line_idle(uint64_t gap_ns)
+{
+    now_ns += LINE_CHAR_NS;
+    line_event(HAL_UART_RXEVENT_IDLE);
+    now_ns += gap_ns - LINE_CHAR_NS;
+}
+
+/** Read of all received words with check of arrival times
+ * 
+ * Words overwritten by DMA RX before they are committed are reported as lost by release,  
+ * their times are checked as well since they are given by their positions
+ * 
+ * \param[out] time_us arrival times of read words, may be NULL
+ * \param[in] check flag whether arrival times are compared with true ones
+ * \return count of read words which are not lost
+ */
+static uint32_t line_read(uint32_t *time_us, bool check)
+{
+    static uint32_t __time_us[LINE_RX_SIZE];
+    struct uart_rx_span span;
+
+    if (!time_us)
+        time_us = __time_us;
+
+    if (bsp_uart_rx_buffer_is_empty(type))
+        return 0;
+
+    HOST_CHECK(bsp_uart_read_acquire(type, &span, 0) == RES_OK);
+
+    uint32_t first = uart_obj[type].ctx->rx_ring.held;
+    uint16_t len = span.len[0] + span.len[1];
+
+    HOST_CHECK(bsp_uart_rx_times_get(type, time_us, len) == RES_OK);
+
+    for (uint16_t i = 0; check && i < len; i++) {
+        uint32_t error = (time_us[i] > true_us[first + i]) ? (time_us[i] - true_us[first + i]) : (true_us[first + i] - time_us[i]);
+
+        error_max = MAX(error_max, error);
+        checked_cnt++;
+
+        HOST_CHECK(!i || time_us[i] >= time_us[i - 1]);
+    }
+
+    uint16_t lost = 0;
+    HOST_CHECK(bsp_uart_read_release(type, len, &lost) == RES_OK);
+
+    return len - lost;
+}
+
+/** Start of the line with empty buffers */
+static void line_start(void)
+{
+    struct uart_init_ctx init = {.baudrate = LINE_BAUDRATE, .wordlen = BSP_UART_WORDLEN_8, .parity = BSP_UART_PARITY_NONE,
+                                 .stopbits = BSP_UART_STOPBITS_1, .rx_size = LINE_RX_SIZE};
+
+    dma_pos = 0;
+    HOST_CHECK(bsp_uart_deinit(type) == RES_OK);
+    HOST_CHECK(bsp_uart_init(type, &init) == RES_OK);
+    uart_obj[type].uart.hdmarx->Instance->NDTR = LINE_RX_SIZE;
+    HOST_CHECK(bsp_uart_char_time_get(type) == LINE_CHAR_NS);
+}
+
+/** Times of a chunk going back further than the end of the previous chunk are clamped to it */
+static void test_clamp(void)
+{
+    uint32_t time_us[LINE_RX_SIZE];
+
+    line_start();
+    now_ns = 1000000;
+
+    line_words(1);
+    line_idle(LINE_CHAR_NS);
+    uint32_t prev_us = ((struct uart_rx_stamp*)uart_obj[type].ctx->rx_stamps.buff)[0].time_us;
+
+    /* 10 words are stamped 4 character times after the previous chunk, faster than  
+       the nominal character time allows (e.g. by baudrate deviation of transmitter) */
+    uint32_t first = dma_pos;
+    for (uint32_t i = 0; i < 10; i++) {
+        uart_obj[type].ctx->rx_ring.buff[dma_pos & (LINE_RX_SIZE - 1)] = (uint8_t)dma_pos;
+        dma_pos++;
+    }
+
+    now_ns += 3 * LINE_CHAR_NS;
+    uart_obj[type].uart.hdmarx->Instance->NDTR = LINE_RX_SIZE - dma_pos;
+    line_idle(LINE_CHAR_NS);
+    uint32_t end_us = ((struct uart_rx_stamp*)uart_obj[type].ctx->rx_stamps.buff)[1].time_us;
+
+    HOST_CHECK(line_read(time_us, false) == 11);
+
+    for (uint32_t i = 0; i < 10; i++) {
+        uint32_t back_us = (uint32_t)((9 - i) * LINE_CHAR_NS / 1000);
+        uint32_t expected = (back_us < end_us - prev_us) ? (end_us - back_us) : prev_us;
+
+        HOST_CHECK(time_us[first + i] == expected);
+    }
+
+    HOST_CHECK(time_us[first] == prev_us);
+    HOST_CHECK(time_us[first + 9] == end_us);
+}
+
+/** Words of chunks whose timestamps are lost get the time of reading */
+static void test_stamps_lost(void)
+{
+    uint32_t time_us[LINE_RX_SIZE];
+    const uint32_t chunks = UART_RX_STAMPS_SIZE + 8;
+
+    line_start();
+
+    for (uint32_t i = 0; i < chunks; i++) {
+        line_words(1);
+        line_idle(5 * LINE_CHAR_NS);
+    }
+
+    HOST_CHECK(uart_obj[type].ctx->rx_stamps.dropped == chunks - UART_RX_STAMPS_SIZE);
+    HOST_CHECK(line_read(time_us, false) == chunks);
+
+    for (uint32_t i = 0; i < chunks; i++) {
+        if (i < UART_RX_STAMPS_SIZE)
+            HOST_CHECK(time_us[i] - true_us[i] <= TIME_ERROR_MAX);
+        else
+            HOST_CHECK(time_us[i] == bsp_rcc_us_get());
+    }
+
+    /* Timestamps are available again after release */
+    line_words(3);
+    line_idle(2 * LINE_CHAR_NS);
+    error_max = checked_cnt = 0;
+    HOST_CHECK(line_read(NULL, true) == 3);
+    HOST_CHECK(error_max <= TIME_ERROR_MAX);
+}
+
+/** Words left after overrun of receive buffer keep their times */
+static void test_overrun(void)
+{
+    line_start();
+
+    line_words(LINE_RX_SIZE + 44);
+    line_idle(2 * LINE_CHAR_NS);
+
+    HOST_CHECK(uart_obj[type].ctx->rx_ring.dropped == 44);
+    HOST_CHECK(uart_obj[type].ctx->rx_ring.tail == 44);
+
+    error_max = checked_cnt = 0;
+    HOST_CHECK(line_read(NULL, true) == LINE_RX_SIZE);
+    HOST_CHECK(error_max <= TIME_ERROR_MAX);
+}
+
+/** Random bursts & idle gaps read at random moments */
+static void test_random(void)
+{
+    line_start();
+    srand(1);
+    error_max = checked_cnt = 0;
+
+    uint32_t read_cnt = 0;
+
+    while (dma_pos < RANDOM_WORDS) {
+        uint32_t burst_max = (rand() % 4) ? 16 : 600;
+        uint32_t burst = 1 + (uint32_t)rand() % burst_max;
+        burst = MIN(burst, RANDOM_WORDS - dma_pos);
+
+        /* Reader runs between half & full transfer events of long bursts */
+        while (burst) {
+            uint32_t cnt = 1 + (uint32_t)rand() % (LINE_RX_SIZE / 2);
+            cnt = MIN(burst, cnt);
+
+            line_words(cnt);
+            burst -= cnt;
+
+            if (!(rand() % 3) || uart_obj[type].ctx->rx_stamps.head - uart_obj[type].ctx->rx_stamps.tail >= UART_RX_STAMPS_SIZE - 2)
+                read_cnt += line_read(NULL, true);
+        }
+
+        uint64_t gap_ns = (2 + rand() % 50) * LINE_CHAR_NS;
+        line_idle(gap_ns + rand() % LINE_CHAR_NS);
+
+        if (!(rand() % 3) || uart_obj[type].ctx->rx_stamps.head - uart_obj[type].ctx->rx_stamps.tail >= UART_RX_STAMPS_SIZE - 2)
+            read_cnt += line_read(NULL, true);
+    }
+
+    read_cnt += line_read(NULL, true);
+
+    struct spsc_ring *ring = &uart_obj[type].ctx->rx_ring;
+
+    HOST_CHECK(!uart_obj[type].ctx->rx_stamps.dropped);
+    HOST_CHECK(ring->dropped);
+    HOST_CHECK(read_cnt + ring->dropped == dma_pos);
+    HOST_CHECK(checked_cnt >= read_cnt);
+    HOST_CHECK(error_max <= TIME_ERROR_MAX);
+
+    printf("random line at %u bods: %u words, %u read, %u lost by overrun, %u times checked, max error %u us\n",
+           LINE_BAUDRATE, dma_pos, read_cnt, ring->dropped, checked_cnt, error_max);
+}
+
+int main(void)
+{
+    test_clamp();
+    test_stamps_lost();
+    test_overrun();
+    test_random();
+
+    HOST_CHECK(bsp_uart_deinit(type) == RES_OK);
+
+    return HOST_TEST_RESULT();
+}